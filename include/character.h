@@ -44,6 +44,15 @@ Character* character_create(Id id);
  */
 Status character_destroy(Character* character);
 
+/**
+ * @brief Creates a new character with the same fields as a given one
+ * @author Abraham Martín
+ *
+ * @param character Pointer to the character to be copied
+ * @return Pointer to the copy, or NULL if there was an ERROR
+ */
+Character* character_copy(const Character* character);
+
 /**
  * @brief Establishes the character´s friendly state
  * @author Carlos Méndez
@@ -242,4 +242,18 @@ void test1_character_get_following();
  */
 void test2_character_get_following();
 
+/**
+ * @test Test function for copying a character
+ * @pre Character with a name and health
+ * @post The copy has the same id, name and health
+ */
+void test1_character_copy();
+
+/**
+ * @test Test function for copying a NULL character
+ * @pre NULL character
+ * @post Output == NULL
+ */
+void test2_character_copy();
+
 #endif
\ No newline at end of file
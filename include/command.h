@@ -22,7 +22,7 @@
  * @def N_CMD
  * @brief Defines the number of available commands
  */
-#define N_CMD 15
+#define N_CMD 17
 
 /**
  * @brief CommandType
@@ -36,7 +36,7 @@ typedef enum { CMDS, CMDL } CommandType;
  *
  * This struct stores all the information related to a commandCode.
  */
-typedef enum { NO_CMD = -1, UNKNOWN, EXIT, TAKE, DROP, CHAT, ATTACK, MOVE, INSPECT, USE, RECRUIT, ABANDON, OPEN, SAVE, LOAD } CommandCode;
+typedef enum { NO_CMD = -1, UNKNOWN, EXIT, TAKE, DROP, CHAT, ATTACK, MOVE, INSPECT, USE, RECRUIT, ABANDON, OPEN, SAVE, LOAD, UNDO, REDO } CommandCode;
 
 /**
  * @brief Command
@@ -62,6 +62,16 @@ Command* command_create(void);
  */
 Status command_destroy(Command* command);
 
+/**
+ * @brief Makes a command hold the same code, argument and success as another one
+ * @author Abraham Martín
+ *
+ * @param command Pointer to the command that is overwritten
+ * @param source Pointer to the command to be copied
+ * @return OK if the command could be copied, ERROR otherwise
+ */
+Status command_copy(Command* command, const Command* source);
+
 /**
  * @brief Sets de code of a command
  * @author Abraham Martín
@@ -118,6 +128,16 @@ Status command_get_success(const Command* command);
  */
 Status command_get_user_input(Command* command);
 
+/**
+ * @brief Fills a command from a line of text, as if the user had typed it
+ * @author Abraham Martín
+ *
+ * @param command Command to store the input
+ * @param input Line with the command and its argument, it is modified by strtok
+ * @return OK if the command could be set, and ERROR otherwise
+ */
+Status command_parse(Command* command, char* input);
+
 /**
  * @brief Sets the arg field of a given command
  * @author Abraham Martín
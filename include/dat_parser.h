@@ -0,0 +1,122 @@
+/**
+ * @brief It defines the dat parser module, that reads the records of a .dat file without copying them
+ *
+ * @file dat_parser.h
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 16-05-2025
+ * @copyright GNU Public License
+ */
+
+#ifndef DAT_PARSER_H
+#define DAT_PARSER_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "types.h"
+
+/**
+ * @brief Dat_parser
+ *
+ * This struct holds the whole contents of a .dat file and the position of the parser in it. A record is a line
+ * that starts with "#x:", where x tells the kind of record, and its fields are separated by '|'.
+ */
+typedef struct _Dat_parser Dat_parser;
+
+/**
+ * @brief Maps a file in memory and prepares a parser to read it
+ * @author Abraham Martín
+ *
+ * @param filename Name of the file
+ * @return Pointer to the created Dat_parser, or NULL if the file could not be read
+ */
+Dat_parser *dat_parser_create(const char *filename);
+
+/**
+ * @brief Frees the memory used by the given parser and releases the file
+ * @author Abraham Martín
+ *
+ * @param parser Pointer to the parser it has to free
+ * @return OK if it could be destroyed, ERROR otherwise
+ */
+Status dat_parser_destroy(Dat_parser *parser);
+
+/**
+ * @brief Moves the parser to the next record of the file, skipping any other line
+ * @author Abraham Martín
+ *
+ * @param parser Pointer to a parser
+ * @return The letter of the record ('s' for "#s:"), or '\0' when there are no more records
+ */
+char dat_parser_next_record(Dat_parser *parser);
+
+/**
+ * @brief Moves the parser back to the beginning of the file, so its records can be walked again
+ * @author Abraham Martín
+ *
+ * @param parser Pointer to a parser
+ */
+void dat_parser_rewind(Dat_parser *parser);
+
+/**
+ * @brief Retrieves the next field of the current record as a slice of the file, which stays valid until the parser
+ * is destroyed. The field is not terminated: it ends at the '|' or the newline that follows it, so a number can be
+ * read with atol straight away. Empty fields are skipped
+ * @author Abraham Martín
+ *
+ * @param parser Pointer to a parser
+ * @param length Pointer where the number of characters of the field is returned, or NULL
+ * @return Pointer to the first character of the field, or NULL if the record has no more fields
+ */
+const char *dat_parser_next_field(Dat_parser *parser, int *length);
+
+/**
+ * @brief Copies the last field returned by the parser into a buffer, for the setters that need a string of their
+ * own. The copy is cut if the field does not fit
+ * @author Abraham Martín
+ *
+ * @param parser Pointer to a parser
+ * @param buffer Buffer where the field is copied, terminated
+ * @param size Number of bytes of the buffer
+ * @return Pointer to the buffer, or NULL if there was any error
+ */
+char *dat_parser_copy_field(const Dat_parser *parser, char *buffer, int size);
+
+/**
+ * @brief Retrieves the length of the last field returned by the parser
+ * @author Abraham Martín
+ *
+ * @param parser Pointer to a parser
+ * @return Number of characters of the field, or -1 if there was any error
+ */
+int dat_parser_get_field_length(const Dat_parser *parser);
+
+/**
+ * @brief Retrieves the line of the file where the current record is
+ * @author Abraham Martín
+ *
+ * @param parser Pointer to a parser
+ * @return Number of the line starting at 1, or -1 if there was any error
+ */
+int dat_parser_get_line(const Dat_parser *parser);
+
+/**
+ * @brief Retrieves the column where the last field starts, or where the record ends if there were no more fields
+ * @author Abraham Martín
+ *
+ * @param parser Pointer to a parser
+ * @return Number of the column starting at 1, or -1 if there was any error
+ */
+int dat_parser_get_column(const Dat_parser *parser);
+
+/**
+ * @brief Prints an error message through stderr with the file, line and column where the parser is
+ * @author Abraham Martín
+ *
+ * @param parser Pointer to a parser
+ * @param message Description of the error
+ */
+void dat_parser_error(const Dat_parser *parser, const char *message);
+
+#endif
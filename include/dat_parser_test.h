@@ -0,0 +1,119 @@
+/**
+ * @brief It declares the tests for the dat parser module
+ *
+ * @file dat_parser_test.h
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 16-05-2025
+ * @copyright GNU Public License
+ */
+
+#ifndef DAT_PARSER_TEST_H
+#define DAT_PARSER_TEST_H
+
+/**
+ * @test Test parser creation
+ * @pre A file with one record
+ * @post Non NULL pointer to a parser
+ */
+void test1_dat_parser_create();
+
+/**
+ * @test Test parser creation with a missing file
+ * @pre The file does not exist
+ * @post Output == NULL
+ */
+void test2_dat_parser_create();
+
+/**
+ * @test Test function for moving to the next record
+ * @pre A file with a "#s:" record
+ * @post Output == 's'
+ */
+void test1_dat_parser_next_record();
+
+/**
+ * @test Test function for moving to the next record skipping other lines
+ * @pre A file with a comment, an empty line and a "#l:" record
+ * @post Output == 'l' and then '\0'
+ */
+void test2_dat_parser_next_record();
+
+/**
+ * @test Test function for reading the fields of a record
+ * @pre Record "#o:5|Leaf|12|"
+ * @post The fields are "5", "Leaf" and "12" with their lengths, and then NULL
+ */
+void test1_dat_parser_next_field();
+
+/**
+ * @test Test function for reading a record with empty fields
+ * @pre Record "#c:1||Ant|"
+ * @post The fields are "1" and "Ant"
+ */
+void test2_dat_parser_next_field();
+
+/**
+ * @test Test function for reading the last field of a file without a final newline
+ * @pre File "#p:2|mouse"
+ * @post The second field is "mouse"
+ */
+void test3_dat_parser_next_field();
+
+/**
+ * @test Test function for the fields of a record not going into the next one
+ * @pre Records "#s:1" and "#s:2"
+ * @post The first record has one field
+ */
+void test4_dat_parser_next_field();
+
+/**
+ * @test Test function for retrieving the length of a field
+ * @pre Record "#o:5|Leaf|"
+ * @post The length of the second field is 4
+ */
+void test1_dat_parser_get_field_length();
+
+/**
+ * @test Test function for retrieving the line of a record
+ * @pre The record is in the third line
+ * @post Output == 3
+ */
+void test1_dat_parser_get_line();
+
+/**
+ * @test Test function for retrieving the column of a field
+ * @pre Record "#o:5|Leaf|"
+ * @post The column of the second field is 6
+ */
+void test1_dat_parser_get_column();
+
+/**
+ * @test Test function for retrieving the column when the record has no more fields
+ * @pre Record "#o:5|"
+ * @post The column after the last field is 6
+ */
+void test2_dat_parser_get_column();
+
+/**
+ * @test Test function for walking the records again from the beginning
+ * @pre File with the records "#s:" and "#o:", both are read and the parser is rewound
+ * @post The next record is the first one again, on line 1
+ */
+void test1_dat_parser_rewind();
+
+/**
+ * @test Test function for copying the last field
+ * @pre Record "#o:5|Leaf|12|", the second field is copied
+ * @post The copy is "Leaf"
+ */
+void test1_dat_parser_copy_field();
+
+/**
+ * @test Test function for copying a field into a buffer too small for it
+ * @pre Record "#o:5|Leaf|12|", the second field is copied into 3 bytes
+ * @post The copy is "Le"
+ */
+void test2_dat_parser_copy_field();
+
+#endif
@@ -11,6 +11,7 @@
 #ifndef GAME_H
 #define GAME_H
 
+#include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
 
@@ -19,38 +20,33 @@
 #include "link.h"
 #include "object.h"
 #include "player.h"
+#include "rng.h"
 #include "space.h"
 #include "types.h"
 
 /**
- * @def MAX_SPACES
- * @brief Defines the maximum number of spaces in the game
+ * @def MAX_LOG_LINE
+ * @brief Defines the size of a log line: the command, its argument and the name of the player
  */
-#define MAX_SPACES 50
+#define MAX_LOG_LINE (3 * WORD_SIZE)
 
 /**
- * @def MAX_OBJECTS
- * @brief Defines the maximum number of objects in the game
+ * @def MAX_DRAWS
+ * @brief Defines the number of random numbers of a turn that are recorded, so the turn can be replayed
  */
-#define MAX_OBJECTS 50
+#define MAX_DRAWS 8
 
 /**
- * @def MAX_CHARACTERS
- * @brief Defines the maximum number of characterss in the game
+ * @def GAME_DEFAULT_SEED
+ * @brief Defines the seed of the random numbers of a game until another one is set
  */
-#define MAX_CHARACTERS 50
+#define GAME_DEFAULT_SEED 1
 
 /**
- * @def MAX_PLAYERS
- * @brief Defines the size ofthe player's array
+ * @def GAME_MAX_UNDO
+ * @brief Defines the number of turns that can be undone, the oldest ones are forgotten
  */
-#define MAX_PLAYERS 8
-
-/**
- * @def MAX_LINKS
- * @brief Defines the maximum number of links in the game
- */
-#define MAX_LINKS 200
+#define GAME_MAX_UNDO 64
 
 /**
  * @brief Game
@@ -59,14 +55,40 @@
  */
 typedef struct _Game Game;
 
+/**
+ * @brief Game_capacity
+ *
+ * Number of entities of each kind a game is expected to hold. The game grows past it when needed,
+ * it only saves the intermediate reallocations.
+ */
+typedef struct _Game_capacity {
+        int n_spaces;     /**< Expected number of spaces*/
+        int n_objects;    /**< Expected number of objects*/
+        int n_characters; /**< Expected number of characters*/
+        int n_links;      /**< Expected number of links*/
+        int n_players;    /**< Expected number of players*/
+} Game_capacity;
+
+/**
+ * @brief Game_hash
+ *
+ * Hash of 64 bits of the state of a game, kept in two halves of 32 bits so it is the same whatever the size of long.
+ * Two games in the same state have the same hash.
+ */
+typedef struct _Game_hash {
+        unsigned long high; /**< Upper 32 bits*/
+        unsigned long low;  /**< Lower 32 bits*/
+} Game_hash;
+
 /**
  * @brief Initializes all the fields of the game to 0
  * @author Carlos Méndez
  *
  * @param game Pointer to pointer to the game being created
+ * @param capacity Number of entities to make room for, or NULL to let the game grow as they are added
  * @return OK if everyting went well and ERROR otherwise
  */
-Status game_create(Game** game);
+Status game_create(Game** game, const Game_capacity* capacity);
 
 /**
  * @brief Creates the game and spaces from the file description
@@ -87,6 +109,17 @@ Status game_create_from_file(Game** game, char* filename);
  */
 Status game_destroy(Game* game);
 
+/**
+ * @brief Creates a game with the same state as a given one, which can be played apart from it (to look ahead or try
+ * a command) without changing the original. The turns recorded are not copied
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game to be copied
+ * @param clone Pointer where the pointer to the copy is stored
+ * @return OK if the game could be copied and ERROR otherwise
+ */
+Status game_clone(const Game* game, Game** clone);
+
 /**
  * @brief Gets the number of players in the game
  * @author Carlos Méndez
@@ -178,11 +211,12 @@ Id game_get_player_location(const Game* game);
  * @brief Sets the player's damage
  * @author Carlos Méndez
  *
- * @param player Pointer to the game being played
+ * @param game Pointer to the game being played
+ * @param player Pointer to a player of the game
  * @param damage The new damage that the player will deal
- * @return id The player´s id location or NO_ID if something went wrong
+ * @return OK if everything went well, ERROR otherwise
  */
-Status game_set_player_damage(Player* player, int damage);
+Status game_set_player_damage(Game* game, Player* player, int damage);
 
 /**
  * @brief Gives the player currently playing
@@ -320,7 +354,7 @@ Status game_add_object(Game* game, Object* object);
 Id game_get_object_location(const Game* game, Id id);
 
 /**
- * @brief Establishes the location of an object
+ * @brief Establishes the location of an object, taking it out of the space where it was before
  * @author Carlos Méndez
  *
  * @param game Pointer to the game
@@ -330,6 +364,16 @@ Id game_get_object_location(const Game* game, Id id);
  */
 Status game_set_object_location(Game* game, Id object_id, Id space_id);
 
+/**
+ * @brief Takes an object out of the space where it is
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param object_id Object ID
+ * @return The ID of the object, or NO_ID if it was not in any space
+ */
+Id game_del_object_location(Game* game, Id object_id);
+
 /**
  * @brief Retrieves the location of an object by its name
  * @author Carlos Méndez
@@ -390,6 +434,17 @@ const char* game_get_description_of_current_object(const Game* game, const char*
  */
 Id game_get_object_open_from_name(const Game* game, char* object_name);
 
+/**
+ * @brief Renames an object, keeping the name lookups up to date
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param id Id of the object
+ * @param name New name of the object
+ * @return OK if the object could be renamed, ERROR otherwise
+ */
+Status game_set_object_name(Game* game, Id id, char* name);
+
 /**
  * @brief Retrieves the number of characters in the game
  * @author Carlos Méndez
@@ -430,6 +485,16 @@ Character* game_get_character_from_id(const Game* game, Id character_id);
  */
 Status game_set_character_location(Game* game, Id loc, Id character_id);
 
+/**
+ * @brief Takes a character out of the space where it is
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param character_id Character ID
+ * @return The ID of the character, or NO_ID if it was not in any space
+ */
+Id game_del_character_location(Game* game, Id character_id);
+
 /**
  * @brief Retrieves the location of a character
  * @author Carlos Méndez
@@ -450,13 +515,34 @@ Id game_get_character_location(const Game* game, Id character_id);
 int game_get_n_characters_following_current_player(const Game* game);
 
 /**
- * @brief Returns an array of Ids of all the characters recruited by the currently active player
+ * @brief Gives read access to the Ids of all the characters recruited by the currently active player
  * @author Carlos Méndez
  *
  * @param game Pointer to the game
- * @return The array with the Ids or NULL if there was an error
+ * @return The set with the Ids, to be walked with a Set_iterator, or NULL if there was an error
+ */
+const Set* game_get_characters_following_current_player(const Game* game);
+
+/**
+ * @brief Makes a character follow a player, or no player at all
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param character_id Character ID
+ * @param player_id ID of the player to follow, or NO_ID to stop following
+ * @return OK if the character could be changed, ERROR otherwise
+ */
+Status game_set_character_following(Game* game, Id character_id, Id player_id);
+
+/**
+ * @brief Moves every character recruited by the currently active player to a space
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param location ID of the space
+ * @return OK if all of them could be moved, ERROR otherwise
  */
-Id* game_get_characters_following_current_player(const Game* game);
+Status game_set_followers_location(Game* game, Id location);
 
 /**
  * @brief Handles character attack event
@@ -538,7 +624,7 @@ int game_get_character_index_from_name(const Game* game, char* name);
  * @param name Name of the character
  * @return TRUE, FALSE otherwise
  */
-Status game_set_character_new_health(const Game* game, int new_health, char* name);
+Status game_set_character_new_health(Game* game, int new_health, char* name);
 
 /**
  * @brief Gets character health from name
@@ -560,6 +646,17 @@ int game_get_character_health_from_name(const Game* game, char* name);
  */
 Character* game_get_character_from_name(Game* game, char* name);
 
+/**
+ * @brief Renames a character, keeping the name lookups up to date
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param id Id of the character
+ * @param name New name of the character
+ * @return OK if the character could be renamed, ERROR otherwise
+ */
+Status game_set_character_name(Game* game, Id id, char* name);
+
 /**
  * @brief Returns the number of spaces in the game
  * @author Carlos Méndez
@@ -585,9 +682,10 @@ Space* game_get_space_from_index(Game* game, int index);
  *
  * @param game Pointer to the game
  * @param space_id ID of the space
- * @param list Buffer to store the object list
+ * @param list Buffer to store the object list, it is left untouched if there are no objects to show
+ * @param size Number of bytes of list, a longer list is cut
  */
-void game_get_object_list_at_space(const Game* game, Id space_id, char* list);
+void game_get_object_list_at_space(const Game* game, Id space_id, char* list, int size);
 
 /**
  * @brief Gives the space given its Id
@@ -599,6 +697,17 @@ void game_get_object_list_at_space(const Game* game, Id space_id, char* list);
  */
 Space* game_get_space(const Game* game, Id id);
 
+/**
+ * @brief Sets whether a space has been discovered
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param space_id Id of the space
+ * @param discovered TRUE once a player has been in the space
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_set_space_discovered(Game* game, Id space_id, Bool discovered);
+
 /**
  * @brief Add a new space to the game
  * @author Abraham Martín
@@ -709,6 +818,30 @@ Status game_add_link(Game* game, Link* link);
  */
 Id game_get_link(const Game* game, Id space_id, Direction direction);
 
+/**
+ * @brief Changes where a link goes, keeping the adjacency of the spaces up to date
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param link_id Id of the link
+ * @param origin Id of the space the link leaves from
+ * @param destination Id of the space the link leads to
+ * @param direction Direction the link takes from its origin
+ * @return OK if the link could be changed, ERROR otherwise
+ */
+Status game_set_link_connection(Game* game, Id link_id, Id origin, Id destination, Direction direction);
+
+/**
+ * @brief Opens or closes a link of the game
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param link_id Id of the link
+ * @param open TRUE to open it, FALSE to close it
+ * @return OK if the link could be changed, ERROR otherwise
+ */
+Status game_set_link_open(Game* game, Id link_id, Bool open);
+
 /**
  * @brief Retrieves a link given its name
  * @author Carlos Méndez
@@ -726,8 +859,40 @@ Link* game_get_link_from_name(const Game* game, char* name);
  *
  * @param game Pointer to the game
  * @param info Buffer to store the game information
+ * @param size Number of bytes of info, longer information is cut
+ */
+void game_get_info(const Game* game, char* info, int size);
+
+/**
+ * @brief Computes a signature that changes whenever what game_get_info shows may have changed, so the caller can skip
+ * building it. It only counts the changes of the state and reads the last command, whatever the size of the world
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @return The signature, equal signatures mean (almost surely) equal information
+ */
+unsigned long game_get_info_signature(const Game* game);
+
+/**
+ * @brief Computes a signature of everything game_get_info reads, walking every entity. It is only meant to check
+ * game_get_info_signature while debugging
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @return The signature, equal signatures mean (almost surely) equal information
+ */
+unsigned long game_compute_info_signature(const Game* game);
+
+/**
+ * @brief Computes a signature of what the map shows about a space: whether it is discovered, its drawing, the
+ * objects, the enemy and the other players in it
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param space_id Id of the space, it may be NO_ID
+ * @return The signature, equal signatures mean (almost surely) an equal drawing of the space
  */
-void game_get_info(const Game* game, char* info);
+unsigned long game_get_space_signature(const Game* game, Id space_id);
 
 /**
  * @brief Passes the turn to the next alive player
@@ -755,14 +920,43 @@ const char* game_get_current_player_gdesc(const Game* game);
 int game_get_current_turn(const Game* game);
 
 /**
- * @brief Updates log-file if requested with the result of the last command
+ * @brief Gets the number of players still in the game, the ones that take turns
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game being played
+ * @return The number of players alive, or -1 if there was any error
+ */
+int game_get_n_alive_players(const Game* game);
+
+/**
+ * @brief Gets the player whose turn comes some turns after the current one
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game being played
+ * @param offset Number of turns from the current one, 0 for the current player, less than the number of players alive
+ * @return The player, or NULL if there was any error
+ */
+Player* game_get_player_in_turn(const Game* game, int offset);
+
+/**
+ * @brief Builds the log line of the last command, without the newline
  * @author Abraham Martín
  *
  * @param game Pointer to the game being played
- * @param file name of an open file descriptor
+ * @param line String where the line is written
+ * @param size Size of line, MAX_LOG_LINE is enough for any command
+ * @return OK if the whole line fitted, ERROR otherwise
  */
+Status game_get_recent_log(const Game* game, char* line, int size);
 
-void game_write_recent_log(const Game* game, const char* file);
+/**
+ * @brief Prints the log line of the last command to an open stream
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game being played
+ * @param f Stream where the line is printed
+ */
+void game_print_recent_log(const Game* game, FILE* f);
 
 /**
  * @brief Outputs the information of the game´s fields
@@ -778,10 +972,11 @@ void game_print(const Game* game);
  *
  * @param game Pointer to the game being played
  * @param id The space id
- * @param first_row An input/output string corresponding with the first row
- * @param second_row An input/output string coreesponding with the second row
+ * @param first_row Buffer to store the first row
+ * @param second_row Buffer to store the second row
+ * @param size Number of bytes of each row, longer rows are cut
  */
-void game_get_players_row_at_space(const Game* game, Id id, char* first_row, char* second_row);
+void game_get_players_row_at_space(const Game* game, Id id, char* first_row, char* second_row, int size);
 
 /**
  * @brief Sets the mode of the game
@@ -812,6 +1007,202 @@ Status game_set_turn(Game* game, int turn);
  */
 int game_get_turn(Game* game);
 
+/**
+ * @brief Draws a random number from the generator of the game and records it among the draws of the current turn.
+ * While a turn is being replayed the forced draws are returned instead, the generator advancing all the same
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game being played
+ * @param n Number of possible values
+ * @return A number between 0 and n - 1, or 0 if there was any error
+ */
+int game_random(Game* game, int n);
+
+/**
+ * @brief Seeds the random numbers of a game. Two games with the same seed draw the same numbers
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game being played
+ * @param seed Any number
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_set_seed(Game* game, unsigned long seed);
+
+/**
+ * @brief Gets the state of the random numbers of a game, so it can be saved
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game being played
+ * @param state Array where the words of the state are copied
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_get_random_state(const Game* game, unsigned long state[RNG_STATE_SIZE]);
+
+/**
+ * @brief Sets the state of the random numbers of a game, as it was saved. The game goes on drawing the numbers the
+ * saved one would have drawn
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game being played
+ * @param state Words of the state
+ * @return OK if everything went well, ERROR if the state is not valid
+ */
+Status game_set_random_state(Game* game, const unsigned long state[RNG_STATE_SIZE]);
+
+/**
+ * @brief Gets the hash of the state of a game: where the players, objects and characters are, the health of the
+ * players and characters, the objects each player carries, the player each character follows, which links are open
+ * and whose turn it is. It is kept up to date as the game changes, so getting it takes no time
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param hash Pointer where the hash is stored
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_get_state_hash(const Game* game, Game_hash* hash);
+
+/**
+ * @brief Computes the hash of the state of a game going through every entity. It always equals the one given by
+ * game_get_state_hash, it is meant to check it
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param hash Pointer where the hash is stored
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_compute_state_hash(const Game* game, Game_hash* hash);
+
+/**
+ * @brief Forgets the draws recorded so far, as a new turn starts
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game being played
+ */
+void game_reset_draws(Game* game);
+
+/**
+ * @brief Gets the number of random numbers drawn in the current turn (up to MAX_DRAWS are recorded)
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game being played
+ * @return The number of draws, or -1 if there was any error
+ */
+int game_get_n_draws(const Game* game);
+
+/**
+ * @brief Gets the random numbers drawn in the current turn
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game being played
+ * @return Array with game_get_n_draws numbers, or NULL if there was any error
+ */
+const int* game_get_draws(const Game* game);
+
+/**
+ * @brief Sets the numbers game_random returns next, one per call, instead of drawing new ones
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game being played
+ * @param draws Numbers to return, they are copied
+ * @param n_draws Number of draws, up to MAX_DRAWS, 0 to go back to drawing new numbers
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_set_forced_draws(Game* game, const int* draws, int n_draws);
+
+/**
+ * @brief Starts recording the changes of a new turn. The turn recorded before, if it changed anything, becomes the
+ * last one game_undo undoes, and the turns undone can no longer be redone
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game being played
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_begin_turn(Game* game);
+
+/**
+ * @brief Undoes every change recorded since game_begin_turn, so a command that fails leaves nothing behind. The
+ * changes done afterwards go on being recorded in the same turn
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game being played
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_rollback_turn(Game* game);
+
+/**
+ * @brief Undoes the last turn recorded, random numbers included, by going back over its changes, up to
+ * GAME_MAX_UNDO turns
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game being played
+ * @return OK if a turn was undone, ERROR if there is none to undo
+ */
+Status game_undo(Game* game);
+
+/**
+ * @brief Does again the last turn undone, as long as no other turn has changed the game since
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game being played
+ * @return OK if a turn was redone, ERROR if there is none to redo
+ */
+Status game_redo(Game* game);
+
+/**
+ * @brief Forgets the turns recorded, the game cannot go back before this point. Nothing is recorded until the next
+ * game_begin_turn
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game being played
+ */
+void game_forget_history(Game* game);
+
+/**
+ * @brief Sets a value of the rules, kept outside the game, recording the change in the turn so undoing the turn
+ * restores it too
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game being played
+ * @param value Pointer to the value, it must last as long as the turns recorded
+ * @param new_value The new value
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_set_rule_value(Game* game, int* value, int new_value);
+
+/**
+ * @brief Sets a flag of the rules, kept outside the game, recording the change in the turn so undoing the turn
+ * restores it too
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game being played
+ * @param flag Pointer to the flag, it must last as long as the turns recorded
+ * @param new_flag The new value
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_set_rule_flag(Game* game, Bool* flag, Bool new_flag);
+
+/**
+ * @brief Writes the whole state of a game to a binary snapshot: every entity with its current values, what lies in
+ * each space, the players alive, the turn and the state of the random numbers. Every number is a native long, so the snapshot is only valid in
+ * machines like the one that wrote it
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param f Stream open for writing in binary mode
+ * @return OK if everything was written, ERROR otherwise
+ */
+Status game_write_snapshot(const Game* game, FILE* f);
+
+/**
+ * @brief Creates a game from a snapshot written by game_write_snapshot
+ * @author Abraham Martín
+ *
+ * @param game Pointer to pointer to the game being created, NULL if it fails
+ * @param f Stream open for reading in binary mode, at the start of the snapshot
+ * @return OK if everything went well, ERROR if the snapshot is damaged or was written by another version or machine
+ */
+Status game_read_snapshot(Game** game, FILE* f);
+
 /**
  * @brief Saves a game
  * @author Jorge Ochoa
@@ -16,57 +16,9 @@
 #include "types.h"
 
 /**
- * @brief Reads from a file the spaces that need to be created
- * @author Jorge Ochoa
- *
- * @param game Pointer to pointer to the game being played
- * @param file File name of the .dat for reading data
- * @return OK if everything goes well and ERROR if it couldnt complete its task
- */
-Status game_management_load_spaces(Game **game, char *file);
-
-/**
- * @brief Reads from a file the objects that need to be created
- * @author Jorge Ochoa
- *
- * @param game Pointer to pointer to the game being played
- * @param file File name of the .dat for reading data
- * @return OK if everything goes well and ERROR if it couldnt complete its task
- */
-Status game_management_load_objects(Game **game, char *file);
-
-/**
- * @brief Reads from a file the characters that need to be created
- * @author Jorge Ochoa
- *
- * @param game Pointer to pointer to the game being played
- * @param file File name of the .dat for reading data
- * @return OK if everything goes well and ERROR if it couldnt complete its task
- */
-Status game_management_load_characters(Game **game, char *file);
-
-/**
- * @brief Reads from a file the links that need to be created
- * @author Jorge Ochoa
- *
- * @param game Pointer to pointer to the game being played
- * @param file File name of the .dat for reading data
- * @return OK if everything goes well and ERROR if it couldnt complete its task
- */
-Status game_management_load_links(Game **game, char *file);
-
-/**
- * @brief Reads from a file the players that need to be created
- * @author Jorge Ochoa
- *
- * @param game Pointer to pointer to the game being played
- * @param file File name of the .dat for reading data
- * @return OK if everything goes well and ERROR if it couldnt complete its task
- */
-Status game_management_load_players(Game **game, char *file);
-
-/**
- * @brief Reads from a file all the information to load the game
+ * @brief Creates a game and reads from a file all the information to load it, in a single pass. The records are
+ * counted first, walking only the line starts, so the game is created with room for all of them. The objects,
+ * characters and players whose space comes later in the file are placed once the whole file has been read
  * @author Jorge Ochoa
  *
  * @param game Pointer to pointer to the game being created
@@ -8,9 +8,23 @@
  * @copyright GNU Public License
  */
 
+#ifndef GAME_RULES_H
+#define GAME_RULES_H
+
 #include "game.h"
 #include "types.h"
 
+/**
+ * @brief Rule_state
+ *
+ * This struct stores what the rules remember from one turn to the next, as passed to game_rule_update.
+ */
+typedef struct _Rule_state {
+        int turn;            /**< Number of the turn being played, starting at 1*/
+        int times_feeded;    /**< Times the queen ant has been fed*/
+        Bool spider_is_dead; /**< TRUE when the spider enemy is defeated*/
+} Rule_state;
+
 /**
  * @brief Implements function that checks if the game rules are activated
  * @author Carlos Méndez
@@ -78,3 +92,5 @@ Status game_rule_ant_invasion(Game* game);
  * @return OK if everything went well, ERROR otherwise
  */
 Status game_rule_attack_with_fangs(Game* game);
+
+#endif
@@ -14,6 +14,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "set.h"
 #include "types.h"
 
 /**
@@ -40,6 +41,16 @@ Inventory *inventory_create(void);
  */
 Status inventory_destroy(Inventory *inventory);
 
+/**
+ * @brief Makes an inventory hold the same objects and have the same size as another one
+ * @author Abraham Martín
+ *
+ * @param inventory Pointer to the inventory that is overwritten
+ * @param source Pointer to the inventory to be copied
+ * @return OK if the inventory could be copied, ERROR otherwise
+ */
+Status inventory_copy(Inventory *inventory, const Inventory *source);
+
 /**
  * @brief It gets the maximum number of objects an inventory can hold
  * @author Carlos Méndez
@@ -78,6 +89,15 @@ Status inventory_set_max_objs(Inventory *inventory, int n);
  */
 Id inventory_get_object_id_at_index(const Inventory *inventory, int index);
 
+/**
+ * @brief It gives read access to the set of object ids of the inventory, so they can be walked with a Set_iterator
+ * @author Carlos Méndez
+ *
+ * @param inventory Pointer to an inventory
+ * @return Pointer to the set of object ids or NULL if an error occurs
+ */
+const Set *inventory_get_objects(const Inventory *inventory);
+
 /**
  * @brief It adds an object ID to the inventory
  * @author Carlos Méndez
@@ -98,6 +118,17 @@ Status inventory_add_object(Inventory *inventory, Id id);
  */
 Id inventory_del_object(Inventory *inventory, Id id);
 
+/**
+ * @brief It moves an object ID to a given position of the inventory
+ * @author Abraham Martín
+ *
+ * @param inventory Pointer to an inventory
+ * @param id ID of the object to be moved
+ * @param index New position of the object
+ * @return OK if everything goes well or ERROR if an error occurs
+ */
+Status inventory_move_object(Inventory *inventory, Id id, int index);
+
 /**
  * @brief It states if an object ID is in the inventory
  * @author Carlos Méndez
@@ -144,4 +144,32 @@ void test2_inventory_has_object();
  */
 void test3_inventory_has_object();
 
+/**
+ * @test Test function for copying an inventory into another one
+ * @pre Inventory of size 3 with one object
+ * @post The copy has size 3 and the same object
+ */
+void test1_inventory_copy();
+
+/**
+ * @test Test function for copying a NULL inventory
+ * @pre NULL source inventory
+ * @post Output == ERROR
+ */
+void test2_inventory_copy();
+
+/**
+ * @test Test function for moving an object to another position
+ * @pre Inventory with the objects 8 and 9, the last one is moved to the first position
+ * @post The objects swap their positions
+ */
+void test1_inventory_move_object();
+
+/**
+ * @test Test function for moving an object to another position
+ * @pre Position out of the inventory
+ * @post Output == ERROR
+ */
+void test2_inventory_move_object();
+
 #endif
\ No newline at end of file
@@ -0,0 +1,97 @@
+/**
+ * @brief It defines the journal module, an append-only record of every turn played that lets a session be
+ * recovered after the program dies
+ *
+ * @file journal.h
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 23-05-2025
+ * @copyright GNU Public License
+ */
+
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include "game.h"
+#include "game_rules.h"
+#include "types.h"
+
+/**
+ * @def JOURNAL_SNAPSHOT_RECORDS
+ * @brief Defines the number of records after which the journal is compacted into a snapshot
+ */
+#define JOURNAL_SNAPSHOT_RECORDS 1000
+
+/**
+ * @brief Journal
+ *
+ * This struct stores the journal file, the snapshot file next to it and how many records have been written.
+ */
+typedef struct _Journal Journal;
+
+/**
+ * @brief Opens a journal, creating its file if it does not exist. The snapshot is kept in a file with the same
+ * name followed by ".snap"
+ * @author Abraham Martín
+ *
+ * @param file_name Name of the journal file
+ * @return Pointer to the journal, or NULL if the file could not be opened
+ */
+Journal *journal_open(const char *file_name);
+
+/**
+ * @brief Closes the journal and frees it
+ * @author Abraham Martín
+ *
+ * @param journal Pointer to the journal
+ */
+void journal_close(Journal *journal);
+
+/**
+ * @brief Rebuilds the game the journal records: it starts from the snapshot if there is one, or from the world file
+ * otherwise, and replays every record written after it. A record cut short by a crash is dropped
+ * @author Abraham Martín
+ *
+ * @param journal Pointer to the journal
+ * @param game Pointer to pointer to the game being created, NULL if it fails
+ * @param world_file Name of the world the session started from
+ * @param state Pointer where the state of the rules after the last record is stored
+ * @return OK if everything went well, ERROR if the game could not be created or a record did not have the outcome it
+ * recorded
+ */
+Status journal_recover(Journal *journal, Game **game, char *world_file, Rule_state *state);
+
+/**
+ * @brief Appends the record of the turn just played: the command, its argument, the random numbers drawn and the
+ * outcome. Every JOURNAL_SNAPSHOT_RECORDS records the journal is compacted
+ * @author Abraham Martín
+ *
+ * @param journal Pointer to the journal
+ * @param game Pointer to the game, after game_actions_update and game_rule_update
+ * @param state Pointer to the state of the rules for the next turn
+ * @return OK if the record was written, ERROR otherwise
+ */
+Status journal_append(Journal *journal, Game *game, const Rule_state *state);
+
+/**
+ * @brief Writes a snapshot of the game and empties the journal, so recovering does not replay those records. The
+ * game forgets the turns it could undo, as the game recovered from the snapshot would not have them
+ * @author Abraham Martín
+ *
+ * @param journal Pointer to the journal
+ * @param game Pointer to the game, as left by the last record
+ * @param state Pointer to the state of the rules for the next turn
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status journal_compact(Journal *journal, Game *game, const Rule_state *state);
+
+/**
+ * @brief Gets the number of records of the session, including those compacted into the snapshot
+ * @author Abraham Martín
+ *
+ * @param journal Pointer to the journal
+ * @return The number of records, or -1 if there was any error
+ */
+long journal_get_n_records(const Journal *journal);
+
+#endif
@@ -38,6 +38,15 @@ Link *link_create(Id id);
  */
 Status link_destroy(Link *link);
 
+/**
+ * @brief Creates a new link with the same fields as a given one
+ * @author Abraham Martín
+ *
+ * @param link Pointer to the link to be copied
+ * @return Pointer to the copy, or NULL if there was an ERROR
+ */
+Link *link_copy(const Link *link);
+
 /**
  * @brief Sets the ID of a link
  * @author Jorge Ochoa
@@ -245,4 +245,18 @@ void test1_link_get_open();
  */
 void test2_link_get_open();
 
+/**
+ * @test Test function for copying a link
+ * @pre Open link with an origin
+ * @post The copy has the same id, origin and open status
+ */
+void test1_link_copy();
+
+/**
+ * @test Test function for copying a NULL link
+ * @pre NULL link
+ * @post Output == NULL
+ */
+void test2_link_copy();
+
 #endif
@@ -0,0 +1,83 @@
+/**
+ * @brief It defines the logger module, that keeps the log records in memory and writes them to the log file in
+ * large batches
+ *
+ * @file logger.h
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 22-05-2025
+ * @copyright GNU Public License
+ */
+
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include "types.h"
+
+/**
+ * @def LOGGER_BUFFER_SIZE
+ * @brief Defines the number of bytes kept in memory before they are written to the file
+ */
+#define LOGGER_BUFFER_SIZE 65536
+
+/**
+ * @def LOGGER_FLUSH_SECONDS
+ * @brief Defines the number of seconds after which the records kept in memory are written even if the buffer is
+ * not full
+ */
+#define LOGGER_FLUSH_SECONDS 2
+
+/**
+ * @brief Logger
+ *
+ * This struct stores the file of the log and the records not written yet.
+ */
+typedef struct _Logger Logger;
+
+/**
+ * @brief Creates a logger that appends to a file
+ * @author Abraham Martín
+ *
+ * @param file_name Name of the log file, it is created if it does not exist
+ * @return Pointer to the logger, or NULL if the file could not be opened
+ */
+Logger *logger_create(const char *file_name);
+
+/**
+ * @brief Writes the pending records and frees the logger
+ * @author Abraham Martín
+ *
+ * @param logger Pointer to the logger
+ */
+void logger_destroy(Logger *logger);
+
+/**
+ * @brief Adds a record to the log as one line. It is only written to the file when the buffer is full or the
+ * records have waited LOGGER_FLUSH_SECONDS. A NULL logger (logging disabled) ignores the record
+ * @author Abraham Martín
+ *
+ * @param logger Pointer to the logger, or NULL
+ * @param record Text of the record, without the newline
+ * @return OK if the record was kept or written, or the logger is NULL, ERROR otherwise
+ */
+Status logger_append(Logger *logger, const char *record);
+
+/**
+ * @brief Writes every pending record to the file
+ * @author Abraham Martín
+ *
+ * @param logger Pointer to the logger, or NULL
+ * @return OK if everything was written, or the logger is NULL, ERROR otherwise
+ */
+Status logger_flush(Logger *logger);
+
+/**
+ * @brief Gets the number of bytes waiting to be written
+ * @author Abraham Martín
+ *
+ * @param logger Pointer to the logger
+ * @return The number of pending bytes, or -1 if there was any error
+ */
+int logger_get_pending(const Logger *logger);
+
+#endif
@@ -0,0 +1,77 @@
+/**
+ * @brief It declares the tests for the logger module
+ *
+ * @file logger_test.h
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 22-05-2025
+ * @copyright GNU Public License
+ */
+
+#ifndef LOGGER_TEST_H
+#define LOGGER_TEST_H
+
+/**
+ * @test Test logger creation
+ * @pre A file name that can be written
+ * @post Non NULL pointer to a logger
+ */
+void test1_logger_create();
+
+/**
+ * @test Test logger creation without a file
+ * @pre File name = NULL
+ * @post Output == NULL
+ */
+void test2_logger_create();
+
+/**
+ * @test Test function for adding a record
+ * @pre Record "Take Leaf: OK (ant)"
+ * @post Output == OK and the record is pending, with its newline
+ */
+void test1_logger_append();
+
+/**
+ * @test Test function for adding a record to a disabled logger
+ * @pre Logger = NULL
+ * @post Output == OK
+ */
+void test2_logger_append();
+
+/**
+ * @test Test function for adding a record that does not fit in the buffer
+ * @pre The buffer is almost full
+ * @post Output == OK and only the new record is pending
+ */
+void test3_logger_append();
+
+/**
+ * @test Test function for writing the pending records
+ * @pre Two records added
+ * @post Output == OK, nothing is pending and the file holds both lines
+ */
+void test1_logger_flush();
+
+/**
+ * @test Test function for writing the pending records of a disabled logger
+ * @pre Logger = NULL
+ * @post Output == OK
+ */
+void test2_logger_flush();
+
+/**
+ * @test Test that destroying the logger writes the pending records
+ * @pre One record added
+ * @post The file holds the line
+ */
+void test1_logger_destroy();
+
+/**
+ * @test Test function for getting the pending bytes
+ * @pre Logger = NULL
+ * @post Output == -1
+ */
+void test1_logger_get_pending();
+
+#endif
@@ -0,0 +1,122 @@
+/**
+ * @brief It defines the map module, a hash table that associates an Id to a value
+ *
+ * @file map.h
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 10-05-2025
+ * @copyright GNU Public License
+ */
+
+#ifndef MAP_H
+#define MAP_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "types.h"
+
+/**
+ * @brief Map
+ *
+ * This struct stores pairs of an Id (the key) and a long (the value). Keys are unique.
+ */
+typedef struct _Map Map;
+
+/**
+ * @brief Allocates memory for an empty map
+ * @author Abraham Martín
+ *
+ * @return Pointer to the created Map, or NULL if there was an error
+ */
+Map *map_create(void);
+
+/**
+ * @brief Frees the memory used by the given map
+ * @author Abraham Martín
+ *
+ * @param m Pointer to the map it has to free
+ * @return OK if it could be destroyed, ERROR otherwise
+ */
+Status map_destroy(Map *m);
+
+/**
+ * @brief Makes a map hold the same keys and values as another one
+ * @author Abraham Martín
+ *
+ * @param m Pointer to the map that is overwritten
+ * @param source Pointer to the map to be copied
+ * @return OK if the map could be copied, ERROR otherwise
+ */
+Status map_copy(Map *m, const Map *source);
+
+/**
+ * @brief Retrieves the number of keys stored in a given map
+ * @author Abraham Martín
+ *
+ * @param m Pointer to a map
+ * @return Number of keys, or -1 if there was any error
+ */
+int map_get_n_keys(const Map *m);
+
+/**
+ * @brief Associates a value to a key, replacing the previous value if the key was already there
+ * @author Abraham Martín
+ *
+ * @param m Pointer to a map
+ * @param key Id used as key, it can't be NO_ID
+ * @param value Value to be stored
+ * @return OK if the pair could be stored, ERROR otherwise
+ */
+Status map_set(Map *m, Id key, long value);
+
+/**
+ * @brief Retrieves the value associated to a key
+ * @author Abraham Martín
+ *
+ * @param m Pointer to a map
+ * @param key Id to look for
+ * @return The value of the key, or NO_ID if the key is not in the map
+ */
+long map_get(const Map *m, Id key);
+
+/**
+ * @brief It asserts whether a key belongs to the map
+ * @author Abraham Martín
+ *
+ * @param m Pointer to a map
+ * @param key Id to look for
+ * @return TRUE if the key is in the map, FALSE otherwise
+ */
+Bool map_has(const Map *m, Id key);
+
+/**
+ * @brief Removes a key and its value from the map
+ * @author Abraham Martín
+ *
+ * @param m Pointer to a map
+ * @param key Id to be removed
+ * @return OK if the key was removed, ERROR if it was not in the map
+ */
+Status map_del(Map *m, Id key);
+
+/**
+ * @brief Makes room for a number of keys, so they can be stored without the table growing again
+ * @author Abraham Martín
+ *
+ * @param m Pointer to a map
+ * @param n_keys Number of keys the map has to hold
+ * @return OK if the memory could be reserved, ERROR otherwise
+ */
+Status map_reserve(Map *m, int n_keys);
+
+/**
+ * @brief Removes every key of the map, keeping its memory for later use
+ * @author Abraham Martín
+ *
+ * @param m Pointer to a map
+ * @return OK if the map could be cleared, ERROR otherwise
+ */
+Status map_clear(Map *m);
+
+#endif
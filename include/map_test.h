@@ -0,0 +1,119 @@
+/**
+ * @brief It declares the tests for the map module
+ *
+ * @file map_test.h
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 10-05-2025
+ * @copyright GNU Public License
+ */
+
+#ifndef MAP_TEST_H
+#define MAP_TEST_H
+
+/**
+ * @test Test map creation
+ * @pre No parameters
+ * @post Non NULL pointer to an empty map
+ */
+void test1_map_create();
+
+/**
+ * @test Test function for storing a pair in a map
+ * @pre Valid key
+ * @post Output == OK
+ */
+void test1_map_set();
+
+/**
+ * @test Test function for storing a pair with an invalid key
+ * @pre key == NO_ID
+ * @post Output == ERROR
+ */
+void test2_map_set();
+
+/**
+ * @test Test function for overwriting the value of a key
+ * @pre Key stored twice with different values
+ * @post The map has one key and the last value
+ */
+void test3_map_set();
+
+/**
+ * @test Test function for retrieving a value
+ * @pre Key stored with value 7
+ * @post Output == 7
+ */
+void test1_map_get();
+
+/**
+ * @test Test function for retrieving a missing key
+ * @pre Empty map
+ * @post Output == NO_ID
+ */
+void test2_map_get();
+
+/**
+ * @test Test function for retrieving from a NULL map
+ * @pre NULL map
+ * @post Output == NO_ID
+ */
+void test3_map_get();
+
+/**
+ * @test Test function for removing a key
+ * @pre Key stored in the map
+ * @post Output == OK and the key is no longer in the map
+ */
+void test1_map_del();
+
+/**
+ * @test Test function for removing a missing key
+ * @pre Empty map
+ * @post Output == ERROR
+ */
+void test2_map_del();
+
+/**
+ * @test Test function for storing and removing many keys
+ * @pre MANY_KEYS keys stored, the even ones are removed
+ * @post Only the odd keys keep their values
+ */
+void test3_map_del();
+
+/**
+ * @test Test function for clearing a map
+ * @pre Map with keys
+ * @post The map is empty
+ */
+void test1_map_clear();
+
+/**
+ * @test Test function for making room in a map with keys
+ * @pre Map with two keys, room reserved for MANY_KEYS
+ * @post Output == OK and both keys keep their values
+ */
+void test1_map_reserve();
+
+/**
+ * @test Test function for making room in a NULL map
+ * @pre NULL map
+ * @post Output == ERROR
+ */
+void test2_map_reserve();
+
+/**
+ * @test Test function for copying a map into another one
+ * @pre Map with MANY_KEYS keys copied into a map with other key
+ * @post The copy holds the same keys and values and not the old key
+ */
+void test1_map_copy();
+
+/**
+ * @test Test function for copying a NULL map
+ * @pre NULL source map
+ * @post Output == ERROR
+ */
+void test2_map_copy();
+
+#endif
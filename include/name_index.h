@@ -0,0 +1,108 @@
+/**
+ * @brief It defines the name index module, a hash table that associates a name to an Id ignoring case
+ *
+ * @file name_index.h
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 12-05-2025
+ * @copyright GNU Public License
+ */
+
+#ifndef NAME_INDEX_H
+#define NAME_INDEX_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "types.h"
+
+/**
+ * @brief Name_index
+ *
+ * This struct stores pairs of a name (the key) and an Id. The names are stored in lowercase, so "Beetle"
+ * and "beetle" are the same key. Several ids may have the same name, each with a sequence number, and the name
+ * resolves to the id of the lowest one.
+ */
+typedef struct _Name_index Name_index;
+
+/**
+ * @brief Allocates memory for an empty name index
+ * @author Abraham Martín
+ *
+ * @return Pointer to the created Name_index, or NULL if there was an error
+ */
+Name_index *name_index_create(void);
+
+/**
+ * @brief Frees the memory used by the given name index, including its copies of the names
+ * @author Abraham Martín
+ *
+ * @param ni Pointer to the name index it has to free
+ * @return OK if it could be destroyed, ERROR otherwise
+ */
+Status name_index_destroy(Name_index *ni);
+
+/**
+ * @brief Makes a name index hold the same names and ids as another one
+ * @author Abraham Martín
+ *
+ * @param ni Pointer to the name index that is overwritten
+ * @param source Pointer to the name index to be copied
+ * @return OK if the name index could be copied, ERROR otherwise
+ */
+Status name_index_copy(Name_index *ni, const Name_index *source);
+
+/**
+ * @brief Retrieves the number of pairs of a name and an id stored in a given name index
+ * @author Abraham Martín
+ *
+ * @param ni Pointer to a name index
+ * @return Number of pairs, or -1 if there was any error
+ */
+int name_index_get_n_names(const Name_index *ni);
+
+/**
+ * @brief Associates an id to a name, next to the other ids with that name, or changes its sequence if the pair was
+ * already there
+ * @author Abraham Martín
+ *
+ * @param ni Pointer to a name index
+ * @param name Name used as key, it is copied in lowercase
+ * @param id Id to be stored, it can't be NO_ID
+ * @param sequence Sequence number of the pair, the id of the lowest one owns the name
+ * @return OK if the pair could be stored, ERROR otherwise
+ */
+Status name_index_set(Name_index *ni, const char *name, Id id, long sequence);
+
+/**
+ * @brief Retrieves the id associated to a name, ignoring case
+ * @author Abraham Martín
+ *
+ * @param ni Pointer to a name index
+ * @param name Name to look for
+ * @return The id of the lowest sequence with the name, or NO_ID if the name is not in the index
+ */
+Id name_index_get(const Name_index *ni, const char *name);
+
+/**
+ * @brief Makes room for a number of names, so they can be stored without the table growing again
+ * @author Abraham Martín
+ *
+ * @param ni Pointer to a name index
+ * @param n_names Number of names the index has to hold
+ * @return OK if the memory could be reserved, ERROR otherwise
+ */
+Status name_index_reserve(Name_index *ni, int n_names);
+
+/**
+ * @brief Removes the pair of a name and an id from the index, the next id with that name (if any) takes it
+ * @author Abraham Martín
+ *
+ * @param ni Pointer to a name index
+ * @param name Name to be removed, ignoring case
+ * @param id Id stored with the name
+ * @return OK if the pair was removed, ERROR if it was not in the index
+ */
+Status name_index_del(Name_index *ni, const char *name, Id id);
+
+#endif
@@ -0,0 +1,133 @@
+/**
+ * @brief It declares the tests for the name index module
+ *
+ * @file name_index_test.h
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 12-05-2025
+ * @copyright GNU Public License
+ */
+
+#ifndef NAME_INDEX_TEST_H
+#define NAME_INDEX_TEST_H
+
+/**
+ * @test Test name index creation
+ * @pre No parameters
+ * @post Non NULL pointer to an empty name index
+ */
+void test1_name_index_create();
+
+/**
+ * @test Test function for storing a name
+ * @pre Valid name and id
+ * @post Output == OK
+ */
+void test1_name_index_set();
+
+/**
+ * @test Test function for storing a name with an invalid id
+ * @pre id == NO_ID
+ * @post Output == ERROR
+ */
+void test2_name_index_set();
+
+/**
+ * @test Test function for storing the same name in different cases
+ * @pre "Beetle" stored with id 1 and "BEETLE" with id 2 and a higher sequence
+ * @post The index has both pairs and the name resolves to 1
+ */
+void test3_name_index_set();
+
+/**
+ * @test Test function for retrieving a name in a different case
+ * @pre "Lost_Ant" stored with id 7
+ * @post name_index_get of "lost_ANT" == 7
+ */
+void test1_name_index_get();
+
+/**
+ * @test Test function for retrieving a missing name
+ * @pre "Beetle" stored
+ * @post name_index_get of "Beetles" == NO_ID
+ */
+void test2_name_index_get();
+
+/**
+ * @test Test function for retrieving from a NULL name index
+ * @pre NULL name index
+ * @post Output == NO_ID
+ */
+void test3_name_index_get();
+
+/**
+ * @test Test function for removing a name
+ * @pre Name stored in the index with id 1
+ * @post Output == OK and the name is no longer in the index
+ */
+void test1_name_index_del();
+
+/**
+ * @test Test function for removing a missing name
+ * @pre Empty name index
+ * @post Output == ERROR
+ */
+void test2_name_index_del();
+
+/**
+ * @test Test function for storing and removing many names
+ * @pre MANY_NAMES names stored, the even ones are removed
+ * @post Only the odd names keep their ids
+ */
+void test3_name_index_del();
+
+/**
+ * @test Test function for making room in a name index with names
+ * @pre "Beetle" stored with id 1, room reserved for MANY_NAMES
+ * @post Output == OK and name_index_get of "beetle" == 1
+ */
+void test1_name_index_reserve();
+
+/**
+ * @test Test function for making room in a NULL name index
+ * @pre NULL name index
+ * @post Output == ERROR
+ */
+void test2_name_index_reserve();
+
+/**
+ * @test Test function for copying a name index into another one
+ * @pre Name index with two names copied, the source is destroyed afterwards
+ * @post The copy still finds both names, ignoring case
+ */
+void test1_name_index_copy();
+
+/**
+ * @test Test function for copying a NULL name index
+ * @pre NULL source name index
+ * @post Output == ERROR
+ */
+void test2_name_index_copy();
+
+/**
+ * @test Test function for the owner of a repeated name
+ * @pre "Beetle" stored with id 1 and then with id 2 and a lower sequence
+ * @post The name resolves to 2
+ */
+void test4_name_index_set();
+
+/**
+ * @test Test function for storing again a pair already stored
+ * @pre "Beetle" stored with ids 1 and 2, and then with id 1 and the highest sequence
+ * @post The index has two pairs and the name resolves to 2
+ */
+void test5_name_index_set();
+
+/**
+ * @test Test function for removing the owner of a repeated name
+ * @pre "Beetle" stored with ids 1 and 2, the first one is removed
+ * @post The name resolves to 2, and a pair that is not stored cannot be removed
+ */
+void test4_name_index_del();
+
+#endif
@@ -41,6 +41,15 @@ Object *object_create(Id id);
  */
 Status object_destroy(Object *object);
 
+/**
+ * @brief Creates a new object with the same fields as a given one
+ * @author Abraham Martín
+ *
+ * @param object Pointer to the object to be copied
+ * @return Pointer to the copy, or NULL if there was an ERROR
+ */
+Object *object_copy(const Object *object);
+
 /**
  * @brief It determines the Id of a given object
  * @author Carlos Méndez
@@ -221,4 +221,18 @@ void test1_object_get_dependency();
  */
 void test2_object_get_dependency();
 
+/**
+ * @test Test function for copying an object
+ * @pre Object with a name and health
+ * @post The copy has the same id, name and health
+ */
+void test1_object_copy();
+
+/**
+ * @test Test function for copying a NULL object
+ * @pre NULL object
+ * @post Output == NULL
+ */
+void test2_object_copy();
+
 #endif
@@ -11,6 +11,7 @@
 #ifndef PLAYER_H
 #define PLAYER_H
 
+#include "set.h"
 #include "types.h"
 
 /**
@@ -44,6 +45,15 @@ Player* player_create(Id id);
  */
 Status player_destroy(Player* player);
 
+/**
+ * @brief Creates a new player with the same fields, inventory and followers as a given one
+ * @author Abraham Martín
+ *
+ * @param player Pointer to the player to be copied
+ * @return Pointer to the copy, or NULL if there was an ERROR
+ */
+Player* player_copy(const Player* player);
+
 /**
  * @brief Gives back the id of a given player
  * @author Abraham Martín
@@ -111,6 +121,17 @@ Status player_add_object(Player* player, Id id);
  */
 Id player_del_object(Player* player, Id id);
 
+/**
+ * @brief Moves an object of the backpack of a given player to a given position
+ * @author Abraham Martín
+ *
+ * @param player Pointer to player
+ * @param id Id of the object to move
+ * @param index New position of the object
+ * @return OK if everything goes well, ERROR otherwise
+ */
+Status player_move_object(Player* player, Id id, int index);
+
 /**
  * @brief Retrieves objects ids from the backpack of a given player using indices only for displaying purposes
  * @author Abraham Martín
@@ -122,6 +143,64 @@ Id player_del_object(Player* player, Id id);
 
 Id player_get_object_at_index(const Player* player, int index);
 
+/**
+ * @brief Gives read access to the set of object ids in the backpack of a given player
+ * @author Abraham Martín
+ *
+ * @param player Pointer to player
+ * @return Pointer to the set of object ids, to be walked with a Set_iterator, or NULL if there was an error
+ */
+const Set* player_get_objects(const Player* player);
+
+/**
+ * @brief Adds a character to the ones following a given player
+ * @author Abraham Martín
+ *
+ * @param player Pointer to player
+ * @param id Id of the character
+ * @return OK if the character could be added, ERROR otherwise
+ */
+Status player_add_follower(Player* player, Id id);
+
+/**
+ * @brief Removes a character from the ones following a given player
+ * @author Abraham Martín
+ *
+ * @param player Pointer to player
+ * @param id Id of the character
+ * @return Id of the removed character, or NO_ID if it was not following the player
+ */
+Id player_del_follower(Player* player, Id id);
+
+/**
+ * @brief Moves a character following a given player to a given position of its followers
+ * @author Abraham Martín
+ *
+ * @param player Pointer to player
+ * @param id Id of the character
+ * @param index New position of the character
+ * @return OK if everything goes well, ERROR otherwise
+ */
+Status player_move_follower(Player* player, Id id, int index);
+
+/**
+ * @brief Gives read access to the set of characters following a given player
+ * @author Abraham Martín
+ *
+ * @param player Pointer to player
+ * @return Pointer to the set of character ids, to be walked with a Set_iterator, or NULL if there was an error
+ */
+const Set* player_get_followers(const Player* player);
+
+/**
+ * @brief Retrieves the number of characters following a given player
+ * @author Abraham Martín
+ *
+ * @param player Pointer to player
+ * @return Number of followers, or -1 if there was an error
+ */
+int player_get_n_followers(const Player* player);
+
 /**
  * @brief Gives a value to the player's health field
  * @author Carlos Méndez
@@ -170,6 +249,15 @@ const char* player_get_gdesc(const Player* player);
  */
 Status player_set_backpack_size(Player* player, int size);
 
+/**
+ * @brief  Gets the size of the player's inventory
+ * @author Abraham Martín
+ *
+ * @param player Pointer to player
+ * @return Max number of objects of the inventory, or -1 if there was any error
+ */
+int player_get_backpack_size(const Player* player);
+
 /**
  * @brief  Gets the number of objects currently in the backpack
  * @author Abraham Martín
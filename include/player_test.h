@@ -311,4 +311,74 @@ void test1_player_get_damage();
  * @post Output == OK
  */
 void test2_player_get_damage();
+
+/**
+ * @test Test function for adding a follower
+ * @pre Valid player and character id
+ * @post Output == OK and the id is in the followers set
+ */
+void test1_player_add_follower();
+
+/**
+ * @test Test function for adding a follower
+ * @pre Valid player, id == NO_ID
+ * @post Output == ERROR
+ */
+void test2_player_add_follower();
+
+/**
+ * @test Test function for removing a follower
+ * @pre Player followed by one character
+ * @post Output == id of the character and no followers are left
+ */
+void test1_player_del_follower();
+
+/**
+ * @test Test function to count the followers
+ * @pre Player followed by two characters, one of them added twice
+ * @post Output == 2
+ */
+void test1_player_get_n_followers();
+
+/**
+ * @test Test function for getting the backpack size of a player
+ * @pre Valid player with a backpack of 4 objects
+ * @post Output == 4
+ */
+void test1_player_get_backpack_size();
+
+/**
+ * @test Test function for getting the backpack size of a NULL player
+ * @pre NULL player
+ * @post Output == -1
+ */
+void test2_player_get_backpack_size();
+/**
+ * @test Test function for copying a player
+ * @pre Player with health, an object and a follower, the copy loses the object
+ * @post The copy has the same health and follower, the original keeps the object
+ */
+void test1_player_copy();
+
+/**
+ * @test Test function for copying a NULL player
+ * @pre NULL player
+ * @post Output == NULL
+ */
+void test2_player_copy();
+
+/**
+ * @test Test function for moving an object of the backpack to another position
+ * @pre Player with the objects 11 and 12, the last one is moved to the first position
+ * @post The objects swap their positions
+ */
+void test1_player_move_object();
+
+/**
+ * @test Test function for moving a follower to another position
+ * @pre Player followed by the characters 21 and 22, the first one is moved to the last position
+ * @post The followers swap their positions
+ */
+void test1_player_move_follower();
+
 #endif
@@ -0,0 +1,101 @@
+/**
+ * @brief It defines the renderer interface, that shows the state of a game through one of several backends
+ *
+ * @file renderer.h
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 21-05-2025
+ * @copyright GNU Public License
+ */
+
+#ifndef RENDERER_H
+#define RENDERER_H
+
+#include <stdio.h>
+
+#include "game.h"
+#include "types.h"
+
+/**
+ * @brief Renderer_backend
+ *
+ * This struct holds the functions of a backend. Each renderer keeps its own engine, created by the backend, so
+ * every game can be shown by its own renderer.
+ */
+typedef struct _Renderer_backend {
+        const char *name;                          /**< Name used to choose the backend*/
+        void *(*create)(FILE *out);                /**< Creates an engine that writes to out, NULL if it fails*/
+        void (*destroy)(void *engine);             /**< Frees an engine*/
+        void (*paint)(void *engine, Game *game);   /**< Shows the state of a game*/
+} Renderer_backend;
+
+/**
+ * @brief Renderer
+ *
+ * This struct stores a backend and the engine it created.
+ */
+typedef struct _Renderer Renderer;
+
+/**
+ * @brief Backend that paints the game in the terminal through libscreen. The terminal is shared, so only one
+ * renderer of this kind should be painting at a time
+ */
+extern const Renderer_backend renderer_text_backend;
+
+/**
+ * @brief Backend that shows nothing, for benchmarks and batch runs
+ */
+extern const Renderer_backend renderer_null_backend;
+
+/**
+ * @brief Backend that writes the state of the game as one JSON object per line, for external interfaces
+ */
+extern const Renderer_backend renderer_json_backend;
+
+/**
+ * @brief Creates a renderer with the backend of the given name
+ * @author Abraham Martín
+ *
+ * @param name Name of the backend: "text", "null" or "json"
+ * @param out Stream the backend writes to, the text backend always uses the terminal
+ * @return Pointer to the created renderer, or NULL if there is no such backend or it could not be created
+ */
+Renderer *renderer_create(const char *name, FILE *out);
+
+/**
+ * @brief Creates a renderer with the given backend
+ * @author Abraham Martín
+ *
+ * @param backend Pointer to the backend
+ * @param out Stream the backend writes to
+ * @return Pointer to the created renderer, or NULL if it could not be created
+ */
+Renderer *renderer_create_from_backend(const Renderer_backend *backend, FILE *out);
+
+/**
+ * @brief Frees the renderer and its engine
+ * @author Abraham Martín
+ *
+ * @param renderer Pointer to the renderer
+ */
+void renderer_destroy(Renderer *renderer);
+
+/**
+ * @brief Shows the state of a game
+ * @author Abraham Martín
+ *
+ * @param renderer Pointer to the renderer
+ * @param game Pointer to the game
+ */
+void renderer_paint(Renderer *renderer, Game *game);
+
+/**
+ * @brief Gets the name of the backend of a renderer
+ * @author Abraham Martín
+ *
+ * @param renderer Pointer to the renderer
+ * @return The name of the backend, or NULL if there was any error
+ */
+const char *renderer_get_name(const Renderer *renderer);
+
+#endif
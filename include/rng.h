@@ -0,0 +1,72 @@
+/**
+ * @brief It defines the random number generator module, a small and fast generator (xoshiro128**) whose whole
+ * state can be seeded, saved and restored, so each game draws its own reproducible numbers
+ *
+ * @file rng.h
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 26-05-2025
+ * @copyright GNU Public License
+ */
+
+#ifndef RNG_H
+#define RNG_H
+
+#include "types.h"
+
+/**
+ * @def RNG_STATE_SIZE
+ * @brief Defines the number of 32 bit words of the state of a generator
+ */
+#define RNG_STATE_SIZE 4
+
+/**
+ * @brief Rng
+ *
+ * This struct stores the state of a generator. Each word holds 32 bits, so the state can be saved and restored as
+ * it is on any machine.
+ */
+typedef struct _Rng {
+        unsigned long state[RNG_STATE_SIZE]; /**< Words of the state, never all 0*/
+} Rng;
+
+/**
+ * @brief Sets the state of a generator from a seed. The same seed always gives the same numbers
+ * @author Abraham Martín
+ *
+ * @param rng Pointer to the generator
+ * @param seed Any number
+ * @return OK if everything goes well, ERROR otherwise
+ */
+Status rng_seed(Rng *rng, unsigned long seed);
+
+/**
+ * @brief Draws the next number of a generator
+ * @author Abraham Martín
+ *
+ * @param rng Pointer to the generator
+ * @return A number from 0 to 2^32 - 1, or 0 if there was any error
+ */
+unsigned long rng_next(Rng *rng);
+
+/**
+ * @brief Draws a number below a limit, every value with the same chance
+ * @author Abraham Martín
+ *
+ * @param rng Pointer to the generator
+ * @param n Number of possible values
+ * @return A number from 0 to n - 1, or 0 if there was any error
+ */
+int rng_next_int(Rng *rng, int n);
+
+/**
+ * @brief Sets the state of a generator, as it was saved from another one
+ * @author Abraham Martín
+ *
+ * @param rng Pointer to the generator
+ * @param state Words of the state
+ * @return OK if everything goes well, ERROR if the state is not valid (all 0 or wider than 32 bits)
+ */
+Status rng_set_state(Rng *rng, const unsigned long state[RNG_STATE_SIZE]);
+
+#endif
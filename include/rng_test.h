@@ -0,0 +1,77 @@
+/**
+ * @brief It declares the tests for the random number generator module
+ *
+ * @file rng_test.h
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 26-05-2025
+ * @copyright GNU Public License
+ */
+
+#ifndef RNG_TEST_H
+#define RNG_TEST_H
+
+/**
+ * @test Test seeding a generator
+ * @pre Two generators with the same seed
+ * @post They draw the same numbers
+ */
+void test1_rng_seed();
+
+/**
+ * @test Test seeding a generator
+ * @pre Two generators with different seeds
+ * @post They draw different numbers
+ */
+void test2_rng_seed();
+
+/**
+ * @test Test seeding no generator
+ * @pre Generator = NULL
+ * @post Output == ERROR
+ */
+void test3_rng_seed();
+
+/**
+ * @test Test function for drawing a number
+ * @pre State {1, 2, 3, 4}
+ * @post Output == 11520, the first number of xoshiro128** from that state
+ */
+void test1_rng_next();
+
+/**
+ * @test Test function for drawing a number from no generator
+ * @pre Generator = NULL
+ * @post Output == 0
+ */
+void test2_rng_next();
+
+/**
+ * @test Test function for drawing a number below a limit
+ * @pre Limit = 6, many draws
+ * @post Every number is from 0 to 5 and every value comes out
+ */
+void test1_rng_next_int();
+
+/**
+ * @test Test function for drawing a number below no limit
+ * @pre Limit = 0
+ * @post Output == 0
+ */
+void test2_rng_next_int();
+
+/**
+ * @test Test function for setting the state
+ * @pre State copied from a generator that has drawn some numbers
+ * @post Both generators draw the same numbers
+ */
+void test1_rng_set_state();
+
+/**
+ * @test Test function for setting a state of zeros
+ * @pre State {0, 0, 0, 0}
+ * @post Output == ERROR
+ */
+void test2_rng_set_state();
+
+#endif
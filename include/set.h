@@ -3,7 +3,7 @@
  *
  * @file set.h
  * @author Abraham Martín
- * @version 1.0
+ * @version 2.0
  * @date 21-02-2025
  * @copyright GNU Public License
  */
@@ -30,6 +30,17 @@
  */
 typedef struct _Set Set;
 
+/**
+ * @brief Set_iterator
+ *
+ * This struct walks through the ids of a Set without allocating memory. The set must not
+ * be modified while it is being walked.
+ */
+typedef struct _Set_iterator {
+        const Set *set; /**< Set being walked*/
+        int index;      /**< Position of the next id to be returned*/
+} Set_iterator;
+
 /**
  * @brief Allocates memory for an initialized set
  * @author Abraham Martín
@@ -47,6 +58,16 @@ Set *set_create(void);
  */
 Status set_destroy(Set *s);
 
+/**
+ * @brief Makes a set hold the same ids as another one, in the same order
+ * @author Abraham Martín
+ *
+ * @param s Pointer to the set that is overwritten
+ * @param source Pointer to the set to be copied
+ * @return OK if the set could be copied, ERROR otherwise
+ */
+Status set_copy(Set *s, const Set *source);
+
 /**
  * @brief Retrieves the number of ids of a given set
  * @author Abraham Martín
@@ -96,6 +117,56 @@ Bool set_has(const Set *s, Id id);
  */
 Id set_get_id_at_index(const Set *set, int index);
 
+/**
+ * @brief Gets the position of an id in a set
+ * @author Abraham Martín
+ *
+ * @param s Pointer to a set
+ * @param id Id to be found
+ * @return The position of the id, or -1 if it does not belong to the set or there was an error
+ */
+int set_get_index(const Set *s, Id id);
+
+/**
+ * @brief Moves an id of a set to a given position, the id that was there takes the old position of the moved one
+ * @author Abraham Martín
+ *
+ * @param s Pointer to a set
+ * @param id Id to be moved
+ * @param index New position of the id
+ * @return OK if the id could be moved, ERROR otherwise
+ */
+Status set_move(Set *s, Id id, int index);
+
+/**
+ * @brief Computes the first slot where an id is looked for in a hash table, the same for the sets and the maps
+ * @author Abraham Martín
+ *
+ * @param id Id to be hashed
+ * @param n_slots Number of slots of the table, a power of two
+ * @return The position of the table
+ */
+int set_hash_id(Id id, int n_slots);
+
+/**
+ * @brief Places an iterator at the beginning of a given set
+ * @author Abraham Martín
+ *
+ * @param it Pointer to the iterator to be initialized
+ * @param s Pointer to the set to be walked
+ */
+void set_iterator_init(Set_iterator *it, const Set *s);
+
+/**
+ * @brief Retrieves the next id of the set being walked
+ * @author Abraham Martín
+ *
+ * @param it Pointer to an initialized iterator
+ * @param id Pointer where the next id is stored
+ * @return TRUE if an id was retrieved, FALSE if there are no more ids
+ */
+Bool set_iterator_next(Set_iterator *it, Id *id);
+
 /**
  * @brief It prints a given set
  * @author Abraham Martín
@@ -165,4 +165,88 @@ void test3_set_get_id_at_index();
  */
 void test4_set_get_id_at_index();
 
+/**
+ * @test Test function for adding more ids than the initial capacity of the set
+ * @pre Set with MANY_IDS ids added
+ * @post Every id belongs to the set
+ */
+void test5_set_add();
+
+/**
+ * @test Test function for deleting half of the ids of a big set
+ * @pre Set with MANY_IDS ids, the even ones are deleted
+ * @post Only the odd ids belong to the set
+ */
+void test6_set_del();
+
+/**
+ * @test Test function for walking a set with an iterator
+ * @pre Set with the ids 3, 7 and 11
+ * @post Three ids are retrieved and they add up to 21
+ */
+void test1_set_iterator_next();
+
+/**
+ * @test Test function for walking an empty set with an iterator
+ * @pre Empty set
+ * @post Output == FALSE
+ */
+void test2_set_iterator_next();
+
+/**
+ * @test Test function for copying a set into another one
+ * @pre Set with three ids copied into a set with other id
+ * @post The copy holds the same ids in the same order and not the old one
+ */
+void test1_set_copy();
+
+/**
+ * @test Test function for copying a NULL set
+ * @pre NULL source set
+ * @post Output == ERROR
+ */
+void test2_set_copy();
+
+/**
+ * @test Test function for getting the position of an id
+ * @pre Set with the ids 5, 7 and 9, the first one is deleted
+ * @post The last id takes the first position
+ */
+void test1_set_get_index();
+
+/**
+ * @test Test function for getting the position of an id
+ * @pre Id that does not belong to the set or NULL set
+ * @post Output == -1
+ */
+void test2_set_get_index();
+
+/**
+ * @test Test function for moving an id to another position
+ * @pre Set with the ids 5, 7 and 9, the first one is deleted, added back and moved to the first position
+ * @post The set has its first order again
+ */
+void test1_set_move();
+
+/**
+ * @test Test function for moving an id to another position
+ * @pre Position out of the set or id that does not belong to it
+ * @post Output == ERROR
+ */
+void test2_set_move();
+
+/**
+ * @test Test function for hashing an id
+ * @pre Id 7 and a table of 8 slots
+ * @post The slot is inside the table and the same every time
+ */
+void test1_set_hash_id();
+
+/**
+ * @test Test function for hashing an id
+ * @pre Big and negative ids
+ * @post Every slot is inside the table
+ */
+void test2_set_hash_id();
+
 #endif
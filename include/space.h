@@ -51,6 +51,15 @@ Space* space_create(Id id);
  */
 Status space_destroy(Space* space);
 
+/**
+ * @brief Creates a new space with the same fields, objects and characters as a given one
+ * @author Abraham Martín
+ *
+ * @param space Pointer to the space to be copied
+ * @return Pointer to the copy, or NULL if there was an ERROR
+ */
+Space* space_copy(const Space* space);
+
 /**
  * @brief It gets the id of a space
  * @author Profesores PPROG
@@ -118,6 +127,17 @@ Status space_add_object(Space* space, Id id);
  */
 Id space_del_object(Space* space, Id id);
 
+/**
+ * @brief Moves an object of the space to a given position of its objects
+ * @author Abraham Martín
+ *
+ * @param space a pointer to the space
+ * @param id the Id of the object to be moved
+ * @param index the new position of the object
+ * @return OK, if everything goes well or ERROR if there was some mistake
+ */
+Status space_move_object(Space* space, Id id, int index);
+
 /**
  * @brief It adds a new character to the space
  * @author Jorge Ochoa
@@ -138,6 +158,17 @@ Status space_add_character(Space* space, Id id);
  */
 Id space_del_character(Space* space, Id id);
 
+/**
+ * @brief Moves a character of the space to a given position of its characters
+ * @author Abraham Martín
+ *
+ * @param space a pointer to the space
+ * @param id the Id of the character to be moved
+ * @param index the new position of the character
+ * @return OK, if everything goes well or ERROR if there was some mistake
+ */
+Status space_move_character(Space* space, Id id, int index);
+
 /**
  * @brief Set the graphical description of a space
  * @author Carlos Méndez
@@ -158,6 +189,16 @@ Status space_set_gdesc(Space* space, char gdesc[GDESC_LINES][LINE_LENGTH + 1]);
  */
 const char* space_get_gdesc(const Space* space, int row_num);
 
+/**
+ * @brief Get a row of the graphical description of a space, even if the space has not been discovered yet
+ * @author Abraham Martín
+ *
+ * @param space Pointer to the space
+ * @param row_num Row index
+ * @return Pointer to the graphical row description or EMPTY_ROW if invalid
+ */
+const char* space_get_stored_gdesc(const Space* space, int row_num);
+
 /**
  * @brief Get the number of objects in a space
  * @author Abraham Martín
@@ -225,6 +266,24 @@ Status space_set_characters(Space* space, Id id);
  */
 Id space_get_id_at_index(const Space*, int index);
 
+/**
+ * @brief Gives read access to the set of objects of a space, so they can be walked with a Set_iterator
+ * @author Abraham Martín
+ *
+ * @param space Pointer to the space
+ * @return Pointer to the set of objects or NULL if there was an error
+ */
+const Set* space_get_objects(const Space* space);
+
+/**
+ * @brief Gives read access to the set of characters of a space, so they can be walked with a Set_iterator
+ * @author Abraham Martín
+ *
+ * @param space Pointer to the space
+ * @return Pointer to the set of characters or NULL if there was an error
+ */
+const Set* space_get_characters(const Space* space);
+
 /**
  * @brief It prints the space information about the id and name of the space, the spaces that
  * surrounds it and wheter it has an object or not.
@@ -262,4 +262,60 @@ void test1_space_get_id_at_index();
  * @post Output == NO_ID
  */
 void test2_space_get_id_at_index();
+
+/**
+ * @test Test function for getting the stored graphical description
+ * @pre Valid space, not discovered, with graphical description set
+ * @post Output == correct graphical description
+ */
+void test1_space_get_stored_gdesc();
+
+/**
+ * @test Test function for getting the stored graphical description
+ * @pre NULL space
+ * @post Output == EMPTY_ROW
+ */
+void test2_space_get_stored_gdesc();
+/**
+ * @test Test function for copying a space
+ * @pre Space with a name and an object, an object is added to the copy
+ * @post The copy has the same name and both objects, the original keeps one
+ */
+void test1_space_copy();
+
+/**
+ * @test Test function for copying a NULL space
+ * @pre NULL space
+ * @post Output == NULL
+ */
+void test2_space_copy();
+
+/**
+ * @test Test function for moving an object to another position
+ * @pre Space with the objects 11, 12 and 13, the last one is moved to the first position
+ * @post The objects 13 and 11 swap their positions
+ */
+void test1_space_move_object();
+
+/**
+ * @test Test function for moving an object to another position
+ * @pre Object that is not in the space
+ * @post Output == ERROR
+ */
+void test2_space_move_object();
+
+/**
+ * @test Test function for moving a character to another position
+ * @pre Space with the characters 21 and 22, the last one is moved to the first position
+ * @post The characters swap their positions
+ */
+void test1_space_move_character();
+
+/**
+ * @test Test function for moving a character to another position
+ * @pre NULL space
+ * @post Output == ERROR
+ */
+void test2_space_move_character();
+
 #endif
@@ -0,0 +1,102 @@
+/**
+ * @brief It defines the text builder module, that appends text to a buffer of known size
+ *
+ * @file text_builder.h
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 20-05-2025
+ * @copyright GNU Public License
+ */
+
+#ifndef TEXT_BUILDER_H
+#define TEXT_BUILDER_H
+
+#include "types.h"
+
+/**
+ * @brief Text_builder
+ *
+ * This struct appends text at the end of a buffer owned by the caller without walking what is already written.
+ * The buffer always holds a string, and text that does not fit is cut.
+ */
+typedef struct _Text_builder {
+        char *buffer;   /**< Buffer where the text is written*/
+        int size;       /**< Number of bytes of buffer, counting the terminator*/
+        int length;     /**< Number of characters written*/
+        Bool truncated; /**< TRUE once some text did not fit*/
+} Text_builder;
+
+/**
+ * @brief Prepares a builder to write an empty string in a buffer
+ * @author Abraham Martín
+ *
+ * @param tb Pointer to the builder to be initialized
+ * @param buffer Buffer where the text is written
+ * @param size Number of bytes of buffer
+ * @return OK if the builder could be initialized, ERROR otherwise
+ */
+Status text_builder_init(Text_builder *tb, char *buffer, int size);
+
+/**
+ * @brief Appends a string
+ * @author Abraham Martín
+ *
+ * @param tb Pointer to an initialized builder
+ * @param str String to append
+ * @return OK if the whole string fitted, ERROR otherwise
+ */
+Status text_builder_append(Text_builder *tb, const char *str);
+
+/**
+ * @brief Appends the first characters of a string
+ * @author Abraham Martín
+ *
+ * @param tb Pointer to an initialized builder
+ * @param str String to append
+ * @param n Maximum number of characters to append
+ * @return OK if they fitted, ERROR otherwise
+ */
+Status text_builder_append_n(Text_builder *tb, const char *str, int n);
+
+/**
+ * @brief Appends a string padded with spaces up to a width, as printf does with "%*s"
+ * @author Abraham Martín
+ *
+ * @param tb Pointer to an initialized builder
+ * @param str String to append
+ * @param width Minimum number of characters, the string is aligned to the right if it is positive and to the left
+ * if it is negative
+ * @return OK if it fitted, ERROR otherwise
+ */
+Status text_builder_append_padded(Text_builder *tb, const char *str, int width);
+
+/**
+ * @brief Appends a number padded with spaces up to a width, as printf does with "%*ld"
+ * @author Abraham Martín
+ *
+ * @param tb Pointer to an initialized builder
+ * @param number Number to append
+ * @param width Minimum number of characters, aligned as in text_builder_append_padded
+ * @return OK if it fitted, ERROR otherwise
+ */
+Status text_builder_append_number(Text_builder *tb, long number, int width);
+
+/**
+ * @brief Retrieves the number of characters written
+ * @author Abraham Martín
+ *
+ * @param tb Pointer to an initialized builder
+ * @return The length of the text, or -1 if there was any error
+ */
+int text_builder_get_length(const Text_builder *tb);
+
+/**
+ * @brief It asserts whether some text did not fit in the buffer
+ * @author Abraham Martín
+ *
+ * @param tb Pointer to an initialized builder
+ * @return TRUE if the text was cut, FALSE otherwise
+ */
+Bool text_builder_is_truncated(const Text_builder *tb);
+
+#endif
@@ -0,0 +1,98 @@
+/**
+ * @brief It declares the tests for the text builder module
+ *
+ * @file text_builder_test.h
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 20-05-2025
+ * @copyright GNU Public License
+ */
+
+#ifndef TEXT_BUILDER_TEST_H
+#define TEXT_BUILDER_TEST_H
+
+/**
+ * @test Test initializing a builder
+ * @pre Valid buffer
+ * @post The buffer holds an empty string
+ */
+void test1_text_builder_init();
+
+/**
+ * @test Test initializing a builder without room
+ * @pre size == 0
+ * @post Output == ERROR
+ */
+void test2_text_builder_init();
+
+/**
+ * @test Test appending several strings
+ * @pre Strings that fit
+ * @post The buffer holds them one after the other
+ */
+void test1_text_builder_append();
+
+/**
+ * @test Test appending more text than fits
+ * @pre String longer than the buffer
+ * @post Output == ERROR and the buffer holds the part that fits
+ */
+void test2_text_builder_append();
+
+/**
+ * @test Test appending to a NULL builder
+ * @pre tb == NULL
+ * @post Output == ERROR
+ */
+void test3_text_builder_append();
+
+/**
+ * @test Test appending the first characters of a string
+ * @pre n smaller than the string
+ * @post Only n characters are appended
+ */
+void test1_text_builder_append_n();
+
+/**
+ * @test Test appending a string shorter than n
+ * @pre n bigger than the string
+ * @post The whole string is appended
+ */
+void test2_text_builder_append_n();
+
+/**
+ * @test Test padding to the right
+ * @pre Positive width
+ * @post The string is aligned to the right
+ */
+void test1_text_builder_append_padded();
+
+/**
+ * @test Test padding to the left
+ * @pre Negative width
+ * @post The string is aligned to the left
+ */
+void test2_text_builder_append_padded();
+
+/**
+ * @test Test padding a string longer than the width
+ * @pre Width smaller than the string
+ * @post The string is appended without padding
+ */
+void test3_text_builder_append_padded();
+
+/**
+ * @test Test appending numbers
+ * @pre Positive, negative and zero numbers
+ * @post They are written as printf would
+ */
+void test1_text_builder_append_number();
+
+/**
+ * @test Test a builder where everything fitted
+ * @pre Strings that fit
+ * @post Output == FALSE
+ */
+void test1_text_builder_is_truncated();
+
+#endif
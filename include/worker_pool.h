@@ -0,0 +1,93 @@
+/**
+ * @brief It defines the worker pool module, a set of threads that run tasks from their own queues and take tasks
+ * from the queues of the others when theirs are empty
+ *
+ * @file worker_pool.h
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 25-05-2025
+ * @copyright GNU Public License
+ */
+
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include "types.h"
+
+/**
+ * @def WORKER_POOL_MAX_WORKERS
+ * @brief Defines the max number of threads of a pool
+ */
+#define WORKER_POOL_MAX_WORKERS 64
+
+/**
+ * @def WORKER_QUEUE_SIZE
+ * @brief Defines the number of tasks each queue has room for when it is created, it grows when it is full
+ */
+#define WORKER_QUEUE_SIZE 256
+
+/**
+ * @brief Function run by the workers for each task
+ *
+ * @param task The task, as it was submitted
+ * @param context The context given when the pool was created
+ */
+typedef void (*Worker_function)(void *task, void *context);
+
+/**
+ * @brief Worker_pool
+ *
+ * This struct stores the threads of the pool and the queue of tasks of each one.
+ */
+typedef struct _Worker_pool Worker_pool;
+
+/**
+ * @brief Creates a pool and starts its threads
+ * @author Abraham Martín
+ *
+ * @param n_workers Number of threads, from 1 to WORKER_POOL_MAX_WORKERS
+ * @param function Function run for each task
+ * @param context Pointer given to function with every task
+ * @return Pointer to the pool, or NULL if there was any error
+ */
+Worker_pool *worker_pool_create(int n_workers, Worker_function function, void *context);
+
+/**
+ * @brief Runs every task left, stops the threads and frees the pool. The tasks run meanwhile may still submit
+ * other tasks, they are run too
+ * @author Abraham Martín
+ *
+ * @param pool Pointer to the pool
+ */
+void worker_pool_destroy(Worker_pool *pool);
+
+/**
+ * @brief Adds a task to the queue of one of the workers, taking them in turns. A task is run by one worker only,
+ * once for each time it is submitted
+ * @author Abraham Martín
+ *
+ * @param pool Pointer to the pool
+ * @param task Pointer given to the function of the pool
+ * @return OK if everything goes well, ERROR otherwise
+ */
+Status worker_pool_submit(Worker_pool *pool, void *task);
+
+/**
+ * @brief Waits until every task submitted has been run, including the ones submitted by the tasks themselves. The
+ * threads keep running, so the pool can be given more tasks afterwards
+ * @author Abraham Martín
+ *
+ * @param pool Pointer to the pool
+ */
+void worker_pool_wait(Worker_pool *pool);
+
+/**
+ * @brief Gets the number of threads of a pool
+ * @author Abraham Martín
+ *
+ * @param pool Pointer to the pool
+ * @return The number of threads, or -1 if there was any error
+ */
+int worker_pool_get_n_workers(const Worker_pool *pool);
+
+#endif
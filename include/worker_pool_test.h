@@ -0,0 +1,91 @@
+/**
+ * @brief It declares the tests for the worker pool module
+ *
+ * @file worker_pool_test.h
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 25-05-2025
+ * @copyright GNU Public License
+ */
+
+#ifndef WORKER_POOL_TEST_H
+#define WORKER_POOL_TEST_H
+
+/**
+ * @test Test worker pool creation
+ * @pre 4 workers and a function
+ * @post Non NULL pointer to a pool
+ */
+void test1_worker_pool_create();
+
+/**
+ * @test Test worker pool creation without workers
+ * @pre n_workers = 0
+ * @post Output == NULL
+ */
+void test2_worker_pool_create();
+
+/**
+ * @test Test worker pool creation without a function
+ * @pre function = NULL
+ * @post Output == NULL
+ */
+void test3_worker_pool_create();
+
+/**
+ * @test Test function for submitting many tasks
+ * @pre More tasks than the queues have room for at first
+ * @post Every task is run exactly once before the pool is destroyed
+ */
+void test1_worker_pool_submit();
+
+/**
+ * @test Test function for submitting tasks from the tasks
+ * @pre Each task submits itself again until its count ends
+ * @post Every submission is run before the pool is destroyed
+ */
+void test2_worker_pool_submit();
+
+/**
+ * @test Test function for submitting to no pool
+ * @pre Pool = NULL
+ * @post Output == ERROR
+ */
+void test3_worker_pool_submit();
+
+/**
+ * @test Test function for submitting no task
+ * @pre Task = NULL
+ * @post Output == ERROR
+ */
+void test4_worker_pool_submit();
+
+/**
+ * @test Test function for getting the number of workers
+ * @pre Pool with 3 workers
+ * @post Output == 3
+ */
+void test1_worker_pool_get_n_workers();
+
+/**
+ * @test Test function for getting the number of workers of no pool
+ * @pre Pool = NULL
+ * @post Output == -1
+ */
+void test2_worker_pool_get_n_workers();
+
+/**
+ * @test Test function for waiting for the tasks submitted from the tasks
+ * @pre Each task submits itself again until its count ends, then one more task after the wait
+ * @post Every submission is run when each wait returns
+ */
+void test1_worker_pool_wait();
+
+/**
+ * @test Test function for waiting with nothing submitted
+ * @pre Pool with no tasks, and pool = NULL
+ * @post Both waits return at once
+ */
+void test2_worker_pool_wait();
+
+#endif
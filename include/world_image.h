@@ -0,0 +1,55 @@
+/**
+ * @brief It defines the world image module, a binary form of the .dat files that is loaded without parsing text
+ *
+ * @file world_image.h
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 17-05-2025
+ * @copyright GNU Public License
+ */
+
+#ifndef WORLD_IMAGE_H
+#define WORLD_IMAGE_H
+
+#include "game.h"
+#include "types.h"
+
+/**
+ * @def WORLD_IMAGE_VERSION
+ * @brief Defines the version of the image format, images of any other version are rejected
+ */
+#define WORLD_IMAGE_VERSION 1
+
+/**
+ * @brief Compiles a game data file into a world image. The image holds the world as it is right after loading the
+ * file: the entities of each kind in the order they are kept in the game, already placed, and their strings
+ * stored only once
+ * @author Abraham Martín
+ *
+ * @param dat_file File name of the .dat to compile
+ * @param image_file File name of the image to write
+ * @return OK if everything goes well and ERROR if it couldnt complete its task
+ */
+Status world_image_compile(char *dat_file, char *image_file);
+
+/**
+ * @brief It asserts whether a file is a world image
+ * @author Abraham Martín
+ *
+ * @param file File name
+ * @return TRUE if the file starts like a world image, FALSE otherwise
+ */
+Bool world_image_is_image(char *file);
+
+/**
+ * @brief Creates a game from a world image, with every array already sized for the whole world
+ * @author Abraham Martín
+ *
+ * @param game Pointer to pointer to the game being created
+ * @param image_file File name of the image
+ * @return OK if everything goes well and ERROR if the image could not be loaded or was built for another
+ * version or machine
+ */
+Status world_image_load(Game **game, char *image_file);
+
+#endif
@@ -63,6 +63,19 @@ Status character_destroy(Character* character) {
         return OK;
 }
 
+Character* character_copy(const Character* character) {
+        Character* copy = NULL;
+
+        if (!character) return NULL;
+
+        copy = (Character*)malloc(sizeof(Character));
+        if (copy == NULL) {
+                return NULL;
+        }
+        *copy = *character;
+        return copy;
+}
+
 Status character_set_friendly(Character* character, Bool friendly) {
         if (!character) return ERROR;
         character->friendly = friendly;
@@ -81,6 +81,8 @@ int main(int argc, char **argv) {
         if (all || test == 31) test2_character_set_following();
         if (all || test == 32) test1_character_get_following();
         if (all || test == 33) test2_character_get_following();
+        if (all || test == 34) test1_character_copy();
+        if (all || test == 35) test2_character_copy();
 
         PRINT_PASSED_PERCENTAGE;
 
@@ -314,4 +316,20 @@ void test2_character_get_following() {
         Character *c = NULL;
         character_set_following(c, 5);
         PRINT_TEST_RESULT(character_get_following(c) == NO_ID);
-}
\ No newline at end of file
+}
+
+void test1_character_copy() {
+        Character *c = NULL, *copy = NULL;
+        c = character_create(5);
+        character_set_name(c, "ant");
+        character_set_health(c, 4);
+        copy = character_copy(c);
+        PRINT_TEST_RESULT(copy != NULL && character_get_id(copy) == 5 && strcmp(character_get_name(copy), "ant") == 0 &&
+                          character_get_health(copy) == 4);
+        character_destroy(c);
+        character_destroy(copy);
+}
+
+void test2_character_copy() {
+        PRINT_TEST_RESULT(character_copy(NULL) == NULL);
+}
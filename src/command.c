@@ -8,6 +8,9 @@
  * @copyright GNU Public License
  */
 
+/*strtok_r is POSIX, not ANSI C*/
+#define _POSIX_C_SOURCE 200112L
+
 #include "command.h"
 
 #include <stdio.h>
@@ -33,7 +36,8 @@
  */
 char* cmd_to_str[N_CMD][N_CMDT] = {{"", "No command"}, {"", "Unknown"},   {"e", "Exit"}, {"t", "Take"},    {"d", "Drop"},
                                    {"c", "Chat"},      {"a", "Attack"},   {"m", "Move"}, {"i", "Inspect"}, {"u", "Use"},
-                                   {"r", "Recruit"},   {"ab", "Abandon"}, {"o", "Open"}, {"s", "Save"},    {"l", "Load"}};
+                                   {"r", "Recruit"},   {"ab", "Abandon"}, {"o", "Open"}, {"s", "Save"},    {"l", "Load"},
+                                   {"un", "Undo"},     {"re", "Redo"}};
 
 /**
  * @brief _Command private struct
@@ -82,6 +86,14 @@ Status command_destroy(Command* command) {
         return OK;
 }
 
+Status command_copy(Command* command, const Command* source) {
+        if (!command || !source) return ERROR;
+
+        *command = *source;
+
+        return OK;
+}
+
 Status command_set_code(Command* command, CommandCode code) {
         if (!command) {
                 return ERROR;
@@ -128,91 +140,109 @@ void command_reset(Command* command) {
 }
 
 Status command_get_user_input(Command* command) {
-        char input[CMD_LENGTH] = "", *token = NULL;
+        char input[CMD_LENGTH] = "";
+
+        if (!command) {
+                return ERROR;
+        }
+
+        if (fgets(input, CMD_LENGTH, stdin)) {
+                return command_parse(command, input);
+        }
+
+        command_reset(command);
+        return command_set_code(command, EXIT);
+}
+
+Status command_parse(Command* command, char* input) {
+        char* token = NULL;
+        char* rest = NULL;
         int i = UNKNOWN - NO_CMD + 1;
         CommandCode cmd;
 
-        if (!command) {
+        if (!command || !input) {
                 return ERROR;
         }
 
         command_reset(command);
 
-        if (fgets(input, CMD_LENGTH, stdin)) {
-                token = strtok(input, " \n");
+        token = strtok_r(input, " \n", &rest);
 
-                if (!token) {
-                        return command_set_code(command, UNKNOWN);
-                }
-                cmd = UNKNOWN;
-                while (cmd == UNKNOWN && i < N_CMD) {
-                        if (!strcasecmp(token, cmd_to_str[i][CMDS]) || !strcasecmp(token, cmd_to_str[i][CMDL])) {
-                                cmd = i + NO_CMD;
-                        } else {
-                                i++;
-                        }
+        if (!token) {
+                return command_set_code(command, UNKNOWN);
+        }
+        cmd = UNKNOWN;
+        while (cmd == UNKNOWN && i < N_CMD) {
+                if (!strcasecmp(token, cmd_to_str[i][CMDS]) || !strcasecmp(token, cmd_to_str[i][CMDL])) {
+                        cmd = i + NO_CMD;
+                } else {
+                        i++;
                 }
+        }
 
-                token = strtok(NULL, " \n");
-                if (token) command_set_arg(command, token);
-
-                switch (cmd) {
-                        case NO_CMD:
-                                strcpy(command->string_code, "no_cmd");
-                                break;
-                        case UNKNOWN:
-                                strcpy(command->string_code, "unknown");
-                                break;
-                        case EXIT:
-                                strcpy(command->string_code, "exit");
-                                break;
-                        case TAKE:
-                                strcpy(command->string_code, "take");
-                                break;
-                        case DROP:
-                                strcpy(command->string_code, "drop");
-                                break;
-                        case CHAT:
-                                strcpy(command->string_code, "chat");
-                                break;
-                        case ATTACK:
-                                strcpy(command->string_code, "attack");
-                                break;
-                        case MOVE:
-                                strcpy(command->string_code, "move");
-                                break;
-                        case INSPECT:
-                                strcpy(command->string_code, "inspect");
-                                break;
-                        case USE:
-                                strcpy(command->string_code, "use");
-                                break;
-                        case RECRUIT:
-                                strcpy(command->string_code, "recruit");
-                                break;
-                        case ABANDON:
-                                strcpy(command->string_code, "abandon");
-                                break;
-                        case OPEN:
-                                strcpy(command->string_code, "open");
-                                break;
-                        case SAVE:
-                                strcpy(command->string_code, "save");
-                                break;
-                        case LOAD:
-                                strcpy(command->string_code, "load");
-                                break;
-                        default:
-                                strcpy(command->string_code, "");
-                }
-                return command_set_code(command, cmd);
-        } else {
-                return command_set_code(command, EXIT);
+        token = strtok_r(NULL, " \n", &rest);
+        if (token) command_set_arg(command, token);
+
+        switch (cmd) {
+                case NO_CMD:
+                        strcpy(command->string_code, "no_cmd");
+                        break;
+                case UNKNOWN:
+                        strcpy(command->string_code, "unknown");
+                        break;
+                case EXIT:
+                        strcpy(command->string_code, "exit");
+                        break;
+                case TAKE:
+                        strcpy(command->string_code, "take");
+                        break;
+                case DROP:
+                        strcpy(command->string_code, "drop");
+                        break;
+                case CHAT:
+                        strcpy(command->string_code, "chat");
+                        break;
+                case ATTACK:
+                        strcpy(command->string_code, "attack");
+                        break;
+                case MOVE:
+                        strcpy(command->string_code, "move");
+                        break;
+                case INSPECT:
+                        strcpy(command->string_code, "inspect");
+                        break;
+                case USE:
+                        strcpy(command->string_code, "use");
+                        break;
+                case RECRUIT:
+                        strcpy(command->string_code, "recruit");
+                        break;
+                case ABANDON:
+                        strcpy(command->string_code, "abandon");
+                        break;
+                case OPEN:
+                        strcpy(command->string_code, "open");
+                        break;
+                case SAVE:
+                        strcpy(command->string_code, "save");
+                        break;
+                case LOAD:
+                        strcpy(command->string_code, "load");
+                        break;
+                case UNDO:
+                        strcpy(command->string_code, "undo");
+                        break;
+                case REDO:
+                        strcpy(command->string_code, "redo");
+                        break;
+                default:
+                        strcpy(command->string_code, "");
         }
+        return command_set_code(command, cmd);
 }
 
 Status command_set_arg(Command* command, char* arg) {
-        if (!command || !arg) return ERROR;
+        if (!command || !arg || strlen(arg) > MAX_ARG) return ERROR;
         strcpy(command->arg, arg);
         return OK;
 }
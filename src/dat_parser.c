@@ -0,0 +1,297 @@
+/**
+ * @brief It implements the dat parser module
+ *
+ * @file dat_parser.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 16-05-2025
+ * @copyright GNU Public License
+ */
+
+/*mmap and the file descriptors are POSIX, not ANSI C*/
+#define _POSIX_C_SOURCE 200112L
+
+#include "dat_parser.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief _Dat_parser private struct
+ *
+ * The file is mapped read only and the fields are handed out as slices of the mapping, so reading it never writes
+ * to its pages. When the file does not end with a newline it is read into memory instead, adding the newline, so
+ * every field is followed by a separator.
+ * */
+struct _Dat_parser {
+        char *filename;   /**< Name of the file, for the error messages*/
+        char *data;       /**< Contents of the file, read only when it is mapped*/
+        long size;        /**< Number of bytes of data*/
+        Bool mapped;      /**< TRUE if data is a mapping of the file, FALSE if it was read into memory*/
+        long pos;         /**< Position of the next field of the current record*/
+        long line_start;  /**< Position where the current record starts*/
+        long record_end;  /**< Position of the newline that ends the current record*/
+        long next_line;   /**< Position where the next line starts*/
+        long field_start; /**< Position where the last field starts*/
+        int line;         /**< Number of the current line, starting at 1*/
+        int column;       /**< Column of the last field, starting at 1*/
+        int field_length; /**< Length of the last field*/
+};
+
+/*
+Private functions
+*/
+
+/**
+ * @brief Reads a whole file into memory, adding a newline at the end if it has none
+ * @author Abraham Martín
+ *
+ * @param parser Pointer to a parser with the size already set
+ * @param fd File descriptor of the file
+ * @return OK if the file could be read, ERROR otherwise
+ */
+Status dat_parser_read(Dat_parser *parser, int fd);
+
+Dat_parser *dat_parser_create(const char *filename) {
+        Dat_parser *parser = NULL;
+        struct stat info;
+        int fd;
+        void *data = NULL;
+
+        if (!filename) {
+                return NULL;
+        }
+
+        fd = open(filename, O_RDONLY);
+        if (fd == -1) {
+                return NULL;
+        }
+        if (fstat(fd, &info) == -1) {
+                close(fd);
+                return NULL;
+        }
+
+        parser = (Dat_parser *)malloc(sizeof(Dat_parser));
+        if (!parser) {
+                close(fd);
+                return NULL;
+        }
+        parser->filename = (char *)malloc(strlen(filename) + 1);
+        if (!parser->filename) {
+                free(parser);
+                close(fd);
+                return NULL;
+        }
+        strcpy(parser->filename, filename);
+        parser->data = NULL;
+        parser->size = (long)info.st_size;
+        parser->mapped = FALSE;
+        parser->pos = 0;
+        parser->line_start = 0;
+        parser->record_end = 0;
+        parser->next_line = 0;
+        parser->field_start = 0;
+        parser->line = 0;
+        parser->column = 0;
+        parser->field_length = 0;
+
+        /*The mapping is only used when the last record ends with a newline*/
+        if (parser->size > 0) {
+                data = mmap(NULL, (size_t)parser->size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (data != MAP_FAILED) {
+                        if (((char *)data)[parser->size - 1] == '\n') {
+                                parser->data = (char *)data;
+                                parser->mapped = TRUE;
+                                posix_madvise(data, (size_t)parser->size, POSIX_MADV_SEQUENTIAL);
+                        } else {
+                                munmap(data, (size_t)parser->size);
+                        }
+                }
+        }
+        if (parser->mapped == FALSE && dat_parser_read(parser, fd) == ERROR) {
+                free(parser->filename);
+                free(parser);
+                close(fd);
+                return NULL;
+        }
+
+        close(fd);
+
+        return parser;
+}
+
+Status dat_parser_destroy(Dat_parser *parser) {
+        if (parser) {
+                if (parser->mapped == TRUE) {
+                        munmap(parser->data, (size_t)parser->size);
+                } else {
+                        free(parser->data);
+                }
+                free(parser->filename);
+        }
+        free(parser);
+
+        return OK;
+}
+
+char dat_parser_next_record(Dat_parser *parser) {
+        char *end = NULL;
+        long start;
+
+        if (!parser) {
+                return '\0';
+        }
+
+        while (parser->next_line < parser->size) {
+                start = parser->next_line;
+                end = (char *)memchr(parser->data + start, '\n', (size_t)(parser->size - start));
+                parser->line++;
+                parser->line_start = start;
+                parser->record_end = end - parser->data;
+                parser->next_line = parser->record_end + 1;
+
+                if (parser->record_end - start >= 3 && parser->data[start] == '#' && parser->data[start + 2] == ':') {
+                        parser->pos = start + 3;
+                        parser->column = 4;
+                        parser->field_length = 0;
+                        return parser->data[start + 1];
+                }
+        }
+
+        return '\0';
+}
+
+void dat_parser_rewind(Dat_parser *parser) {
+        if (!parser) {
+                return;
+        }
+
+        parser->pos = 0;
+        parser->line_start = 0;
+        parser->record_end = 0;
+        parser->next_line = 0;
+        parser->field_start = 0;
+        parser->line = 0;
+        parser->column = 0;
+        parser->field_length = 0;
+}
+
+const char *dat_parser_next_field(Dat_parser *parser, int *length) {
+        const char *end = NULL;
+        long start;
+
+        if (!parser) {
+                return NULL;
+        }
+
+        /*Empty fields are skipped, as strtok did*/
+        while (parser->pos < parser->record_end && parser->data[parser->pos] == '|') {
+                parser->pos++;
+        }
+        if (parser->pos >= parser->record_end) {
+                parser->column = (int)(parser->record_end - parser->line_start) + 1;
+                parser->field_length = 0;
+                return NULL;
+        }
+
+        start = parser->pos;
+        end = (const char *)memchr(parser->data + start, '|', (size_t)(parser->record_end - start));
+        if (!end) {
+                end = parser->data + parser->record_end;
+        }
+        parser->pos = end - parser->data + 1;
+        parser->field_start = start;
+        parser->column = (int)(start - parser->line_start) + 1;
+        parser->field_length = (int)(end - parser->data - start);
+        if (length) {
+                *length = parser->field_length;
+        }
+
+        return parser->data + start;
+}
+
+char *dat_parser_copy_field(const Dat_parser *parser, char *buffer, int size) {
+        int length;
+
+        if (!parser || !buffer || size < 1) {
+                return NULL;
+        }
+
+        length = parser->field_length < size - 1 ? parser->field_length : size - 1;
+        memcpy(buffer, parser->data + parser->field_start, (size_t)length);
+        buffer[length] = '\0';
+
+        return buffer;
+}
+
+int dat_parser_get_field_length(const Dat_parser *parser) {
+        if (!parser) {
+                return -1;
+        }
+
+        return parser->field_length;
+}
+
+int dat_parser_get_line(const Dat_parser *parser) {
+        if (!parser) {
+                return -1;
+        }
+
+        return parser->line;
+}
+
+int dat_parser_get_column(const Dat_parser *parser) {
+        if (!parser) {
+                return -1;
+        }
+
+        return parser->column;
+}
+
+void dat_parser_error(const Dat_parser *parser, const char *message) {
+        if (!parser || !message) {
+                return;
+        }
+
+        fprintf(stderr, "%s:%d:%d: %s\n", parser->filename, parser->line, parser->column, message);
+}
+
+/**
+   Implementation of private functions
+*/
+
+Status dat_parser_read(Dat_parser *parser, int fd) {
+        long done = 0;
+        ssize_t n;
+
+        parser->data = (char *)malloc(parser->size + 1);
+        if (!parser->data) {
+                return ERROR;
+        }
+
+        if (lseek(fd, 0, SEEK_SET) == -1) {
+                free(parser->data);
+                parser->data = NULL;
+                return ERROR;
+        }
+        while (done < parser->size) {
+                n = read(fd, parser->data + done, (size_t)(parser->size - done));
+                if (n <= 0) {
+                        free(parser->data);
+                        parser->data = NULL;
+                        return ERROR;
+                }
+                done += n;
+        }
+
+        if (parser->size == 0 || parser->data[parser->size - 1] != '\n') {
+                parser->data[parser->size++] = '\n';
+        }
+
+        return OK;
+}
@@ -0,0 +1,251 @@
+/**
+ * @brief It tests the dat parser module
+ *
+ * @file dat_parser_test.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 16-05-2025
+ * @copyright GNU Public License
+ */
+
+#include "dat_parser.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dat_parser_test.h"
+#include "test.h"
+
+/**
+ * @def MAX_TESTS
+ * @brief Defines the maximum number of tests
+ */
+#define MAX_TESTS 15
+
+/**
+ * @def TEST_FILE
+ * @brief Defines the name of the file written by the tests
+ */
+#define TEST_FILE "dat_parser_test.dat"
+
+/**
+ * @brief Writes the test file and creates a parser for it
+ *
+ * @param contents Text of the file
+ * @return Pointer to the parser, or NULL if there was an error
+ */
+Dat_parser *dat_parser_test_open(const char *contents);
+
+/**
+ * @brief Main function for DAT_PARSER unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv) {
+        int test = 0;
+        int all = 1;
+
+        if (argc < 2) {
+                printf("Running all test for module Dat_parser:\n");
+        } else {
+                test = atoi(argv[1]);
+                all = 0;
+                printf("Running test %d:\t", test);
+                if (test < 1 && test > MAX_TESTS) {
+                        printf("Error: unknown test %d\t", test);
+                        exit(EXIT_SUCCESS);
+                }
+        }
+
+        if (all || test == 1) test1_dat_parser_create();
+        if (all || test == 2) test2_dat_parser_create();
+        if (all || test == 3) test1_dat_parser_next_record();
+        if (all || test == 4) test2_dat_parser_next_record();
+        if (all || test == 5) test1_dat_parser_next_field();
+        if (all || test == 6) test2_dat_parser_next_field();
+        if (all || test == 7) test3_dat_parser_next_field();
+        if (all || test == 8) test4_dat_parser_next_field();
+        if (all || test == 9) test1_dat_parser_get_field_length();
+        if (all || test == 10) test1_dat_parser_get_line();
+        if (all || test == 11) test1_dat_parser_get_column();
+        if (all || test == 12) test2_dat_parser_get_column();
+        if (all || test == 13) test1_dat_parser_rewind();
+        if (all || test == 14) test1_dat_parser_copy_field();
+        if (all || test == 15) test2_dat_parser_copy_field();
+
+        remove(TEST_FILE);
+
+        PRINT_PASSED_PERCENTAGE;
+
+        return EXIT_SUCCESS;
+}
+
+Dat_parser *dat_parser_test_open(const char *contents) {
+        FILE *f = NULL;
+
+        f = fopen(TEST_FILE, "w");
+        if (!f) {
+                return NULL;
+        }
+        fputs(contents, f);
+        fclose(f);
+
+        return dat_parser_create(TEST_FILE);
+}
+
+void test1_dat_parser_create() {
+        Dat_parser *parser = NULL;
+        parser = dat_parser_test_open("#s:1|Room|0|\n");
+        PRINT_TEST_RESULT(parser != NULL);
+        dat_parser_destroy(parser);
+}
+
+void test2_dat_parser_create() {
+        PRINT_TEST_RESULT(dat_parser_create("missing_file.dat") == NULL);
+}
+
+void test1_dat_parser_next_record() {
+        Dat_parser *parser = NULL;
+        parser = dat_parser_test_open("#s:1|Room|0|\n");
+        PRINT_TEST_RESULT(dat_parser_next_record(parser) == 's');
+        dat_parser_destroy(parser);
+}
+
+void test2_dat_parser_next_record() {
+        Dat_parser *parser = NULL;
+        char first, second;
+        parser = dat_parser_test_open("Links of the anthill\n\n#l:57|Passage|19|25|1|1|\n");
+        first = dat_parser_next_record(parser);
+        second = dat_parser_next_record(parser);
+        PRINT_TEST_RESULT(first == 'l' && second == '\0');
+        dat_parser_destroy(parser);
+}
+
+void test1_dat_parser_next_field() {
+        Dat_parser *parser = NULL;
+        const char *id, *name, *location, *end;
+        int id_length = 0, name_length = 0, location_length = 0;
+        parser = dat_parser_test_open("#o:5|Leaf|12|\n");
+        dat_parser_next_record(parser);
+        id = dat_parser_next_field(parser, &id_length);
+        name = dat_parser_next_field(parser, &name_length);
+        location = dat_parser_next_field(parser, &location_length);
+        end = dat_parser_next_field(parser, NULL);
+        PRINT_TEST_RESULT(id && name && location && id_length == 1 && !strncmp(id, "5", 1) && name_length == 4 &&
+                          !strncmp(name, "Leaf", 4) && location_length == 2 && !strncmp(location, "12", 2) &&
+                          end == NULL);
+        dat_parser_destroy(parser);
+}
+
+void test2_dat_parser_next_field() {
+        Dat_parser *parser = NULL;
+        const char *id, *name;
+        int length = 0;
+        parser = dat_parser_test_open("#c:1||Ant|\n");
+        dat_parser_next_record(parser);
+        id = dat_parser_next_field(parser, NULL);
+        name = dat_parser_next_field(parser, &length);
+        PRINT_TEST_RESULT(id && name && atol(id) == 1 && length == 3 && !strncmp(name, "Ant", 3));
+        dat_parser_destroy(parser);
+}
+
+void test3_dat_parser_next_field() {
+        Dat_parser *parser = NULL;
+        const char *name;
+        int length = 0;
+        parser = dat_parser_test_open("#p:2|mouse");
+        dat_parser_next_record(parser);
+        dat_parser_next_field(parser, NULL);
+        name = dat_parser_next_field(parser, &length);
+        PRINT_TEST_RESULT(name && length == 5 && !strncmp(name, "mouse", 5));
+        dat_parser_destroy(parser);
+}
+
+void test4_dat_parser_next_field() {
+        Dat_parser *parser = NULL;
+        const char *id, *end;
+        parser = dat_parser_test_open("#s:1\n#s:2\n");
+        dat_parser_next_record(parser);
+        id = dat_parser_next_field(parser, NULL);
+        end = dat_parser_next_field(parser, NULL);
+        PRINT_TEST_RESULT(id && atol(id) == 1 && end == NULL);
+        dat_parser_destroy(parser);
+}
+
+void test1_dat_parser_get_field_length() {
+        Dat_parser *parser = NULL;
+        parser = dat_parser_test_open("#o:5|Leaf|\n");
+        dat_parser_next_record(parser);
+        dat_parser_next_field(parser, NULL);
+        dat_parser_next_field(parser, NULL);
+        PRINT_TEST_RESULT(dat_parser_get_field_length(parser) == 4);
+        dat_parser_destroy(parser);
+}
+
+void test1_dat_parser_get_line() {
+        Dat_parser *parser = NULL;
+        parser = dat_parser_test_open("#s:1|Room|0|\nComment\n#o:5|Leaf|\n");
+        dat_parser_next_record(parser);
+        dat_parser_next_record(parser);
+        PRINT_TEST_RESULT(dat_parser_get_line(parser) == 3);
+        dat_parser_destroy(parser);
+}
+
+void test1_dat_parser_get_column() {
+        Dat_parser *parser = NULL;
+        parser = dat_parser_test_open("#o:5|Leaf|\n");
+        dat_parser_next_record(parser);
+        dat_parser_next_field(parser, NULL);
+        dat_parser_next_field(parser, NULL);
+        PRINT_TEST_RESULT(dat_parser_get_column(parser) == 6);
+        dat_parser_destroy(parser);
+}
+
+void test2_dat_parser_get_column() {
+        Dat_parser *parser = NULL;
+        parser = dat_parser_test_open("#o:5|\n");
+        dat_parser_next_record(parser);
+        dat_parser_next_field(parser, NULL);
+        dat_parser_next_field(parser, NULL);
+        PRINT_TEST_RESULT(dat_parser_get_column(parser) == 6);
+        dat_parser_destroy(parser);
+}
+
+void test1_dat_parser_rewind() {
+        Dat_parser *parser = NULL;
+        char first, again;
+        parser = dat_parser_test_open("#s:1|Room|0|\n#o:5|Leaf|1|\n");
+        first = dat_parser_next_record(parser);
+        dat_parser_next_record(parser);
+        dat_parser_rewind(parser);
+        again = dat_parser_next_record(parser);
+        PRINT_TEST_RESULT(first == 's' && again == 's' && dat_parser_get_line(parser) == 1);
+        dat_parser_destroy(parser);
+}
+
+void test1_dat_parser_copy_field() {
+        Dat_parser *parser = NULL;
+        char buffer[WORD_SIZE];
+        parser = dat_parser_test_open("#o:5|Leaf|12|\n");
+        dat_parser_next_record(parser);
+        dat_parser_next_field(parser, NULL);
+        dat_parser_next_field(parser, NULL);
+        PRINT_TEST_RESULT(dat_parser_copy_field(parser, buffer, WORD_SIZE) == buffer && !strcmp(buffer, "Leaf"));
+        dat_parser_destroy(parser);
+}
+
+void test2_dat_parser_copy_field() {
+        Dat_parser *parser = NULL;
+        char buffer[3];
+        parser = dat_parser_test_open("#o:5|Leaf|12|\n");
+        dat_parser_next_record(parser);
+        dat_parser_next_field(parser, NULL);
+        dat_parser_next_field(parser, NULL);
+        PRINT_TEST_RESULT(dat_parser_copy_field(parser, buffer, 3) == buffer && !strcmp(buffer, "Le"));
+        dat_parser_destroy(parser);
+}
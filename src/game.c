@@ -10,6 +10,7 @@
 
 #include "game.h"
 
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -17,6 +18,10 @@
 #include <time.h>
 
 #include "game_management.h"
+#include "map.h"
+#include "name_index.h"
+#include "text_builder.h"
+#include "world_image.h"
 
 /**
  * @def MAX_SPACE_LINKS
@@ -24,6 +29,18 @@
  */
 #define MAX_SPACE_LINKS 4
 
+/**
+ * @def MIN_CAPACITY
+ * @brief Defines the smallest number of entities reserved when an entity array grows
+ */
+#define MIN_CAPACITY 8
+
+/**
+ * @def N_DIRECTIONS
+ * @brief Defines the number of directions a link can take from a space (N, S, E, W, U and D)
+ */
+#define N_DIRECTIONS NO_DIRECTION
+
 /**
  * @def MAX_ROW_PLAYERS
  * @brief Defines the max number of player gdesc in each row to represent it in graphic_engine.
@@ -37,10 +54,10 @@
 #define INVALID_INDEX -1
 
 /**
- * @def DUMMY_SIZE
- * @brief Defines the length of general purpose buffer
+ * @def NOT_WAITING
+ * @brief Defines the value of orphan_next for the links whose origin space is loaded
  */
-#define DUMMY_SIZE 800
+#define NOT_WAITING -2
 
 /**
  * @def EMPTY
@@ -61,45 +78,180 @@
 #define CUT_INDEX 4
 
 /**
- * @def ARG_SIZE
- * @brief Defines de lenght of the temporary buffer arg_buff
+ * @def FNV_OFFSET
+ * @brief Defines the initial value of the FNV-1a hash
+ */
+#define FNV_OFFSET 2166136261UL
+
+/**
+ * @def FNV_PRIME
+ * @brief Defines the multiplier of the FNV-1a hash
+ */
+#define FNV_PRIME 16777619UL
+
+/**
+ * @def SNAPSHOT_MAGIC
+ * @brief Defines the bytes every snapshot starts with
+ */
+#define SNAPSHOT_MAGIC "ANTSNAP"
+
+/**
+ * @def SNAPSHOT_MAGIC_SIZE
+ * @brief Defines the number of bytes of SNAPSHOT_MAGIC
+ */
+#define SNAPSHOT_MAGIC_SIZE 7
+
+/**
+ * @def SNAPSHOT_VERSION
+ * @brief Defines the version of the snapshot format, snapshots of any other version are rejected
+ */
+#define SNAPSHOT_VERSION 3
+
+/**
+ * @def MASK_32
+ * @brief Defines the bits kept in each half of the state hash
+ */
+#define MASK_32 0xFFFFFFFFUL
+
+/**
+ * @def HASH_SEED_LOW
+ * @brief Defines the number the keys of the low half of the state hash are derived from
+ */
+#define HASH_SEED_LOW 0x9E3779B9UL
+
+/**
+ * @def HASH_SEED_HIGH
+ * @brief Defines the number the keys of the high half of the state hash are derived from
+ */
+#define HASH_SEED_HIGH 0x85EBCA6BUL
+
+/**
+ * @brief Hash_feature
+ *
+ * Each part of the state that goes into the state hash. Every feature of every entity contributes the key of its
+ * current value, so changing a value takes two xors: one removes the key of the old value, the other adds the new one.
+ */
+typedef enum {
+        HASH_PLAYER_LOCATION,     /**< Space of a player*/
+        HASH_PLAYER_HEALTH,       /**< Health of a player*/
+        HASH_PLAYER_OBJECT,       /**< Object carried by a player, the key of the pair is only there while it is carried*/
+        HASH_OBJECT_LOCATION,     /**< Space where an object lies*/
+        HASH_CHARACTER_LOCATION,  /**< Space of a character*/
+        HASH_CHARACTER_HEALTH,    /**< Health of a character*/
+        HASH_CHARACTER_FOLLOWING, /**< Player a character follows*/
+        HASH_LINK_OPEN,           /**< Whether a link is open*/
+        HASH_TURN                 /**< Player whose turn it is*/
+} Hash_feature;
+
+/**
+ * @brief Change_kind
+ *
+ * Each part of the state a recorded change can be about.
  */
-#define ARG_SIZE 100
+typedef enum {
+        CHANGE_TURN,                /**< Position in player_indices of the player whose turn it is*/
+        CHANGE_ALIVE_PLAYER,        /**< Player taken out of player_indices or put back*/
+        CHANGE_FINISHED,            /**< Whether the game has ended*/
+        CHANGE_COMBAT,              /**< Whether the last player won the combat*/
+        CHANGE_PLAYER_LOCATION,     /**< Space of a player*/
+        CHANGE_PLAYER_HEALTH,       /**< Health of a player*/
+        CHANGE_PLAYER_DAMAGE,       /**< Damage of a player*/
+        CHANGE_PLAYER_OBJECT,       /**< Whether a player carries an object*/
+        CHANGE_OBJECT_PRESENCE,     /**< Object added to the game or taken out of it*/
+        CHANGE_OBJECT_LOCATION,     /**< Space where an object lies*/
+        CHANGE_CHARACTER_PRESENCE,  /**< Character added to the game or taken out of it*/
+        CHANGE_CHARACTER_LOCATION,  /**< Space of a character*/
+        CHANGE_CHARACTER_HEALTH,    /**< Health of a character*/
+        CHANGE_CHARACTER_FOLLOWING, /**< Player a character follows*/
+        CHANGE_CHARACTER_NAME,      /**< Name of a character*/
+        CHANGE_LINK_OPEN,           /**< Whether a link is open*/
+        CHANGE_SPACE_DISCOVERED,    /**< Whether a space has been discovered*/
+        CHANGE_RULE_VALUE,          /**< Value of the rules, kept outside the game*/
+        CHANGE_RULE_FLAG            /**< Flag of the rules, kept outside the game*/
+} Change_kind;
 
 /**
- * @def MAX_BUFFER1
- * @brief Defines the size of a general purpose buffer1
+ * @brief Game_change
+ *
+ * A change of one part of the state, which keeps the value that part does not have: the old one while the change
+ * is done and the new one once it is undone. Applying it swaps both, so the same change is undone and redone.
  */
-#define MAX_BUFFER1 17
+typedef struct _Game_change {
+        Change_kind kind; /**< Part of the state changed*/
+        void* target;     /**< Entity or value of the rules changed, if the change is about one*/
+        Id id;            /**< Id of the entity changed, if the change is about one*/
+        int position;     /**< Position in its array of the player or entity taken out or put back, or position the
+                               id had in the set it was taken out of*/
+        long value;       /**< Value the part changed does not have*/
+        char* name;       /**< Name the character does not have, for CHANGE_CHARACTER_NAME*/
+} Game_change;
 
 /**
- * @def MAX_BUFFER2
- * @brief Defines the size of a general purpose buffer2
+ * @brief Game_turn
+ *
+ * Changes of a turn, in the order they were done, and the random generator the game does not have: the one before
+ * the turn while it is done and the one after it once it is undone.
  */
-#define MAX_BUFFER2 6
+typedef struct _Game_turn {
+        Game_change* changes; /**< Changes of the turn*/
+        int n_changes;        /**< Number of changes*/
+        int size;             /**< Number of changes there is room for*/
+        Rng rng;              /**< Random generator the game does not have*/
+} Game_turn;
 
 /**
  * @brief _Game private struct
  * */
 
 struct _Game {
-        Player* players[MAX_PLAYERS];          /**< Pointer to a player*/
-        int player_indices[MAX_PLAYERS];       /**< Array of player indices*/
+        Player** players;                      /**< Pointer to a player*/
+        int* player_indices;                   /**< Array of player indices*/
         int num_alive_players;                 /**< NUmber of alive players*/
         int n_players;                         /**< Number of players*/
         int turn;                              /**< Current player's turn*/
-        Object* objects[MAX_OBJECTS];          /**< Object array*/
+        Object** objects;                      /**< Object array*/
         int n_objects;                         /**< Number of objects*/
-        Character* characters[MAX_CHARACTERS]; /**< Characters array*/
+        Character** characters;                /**< Characters array*/
         int n_characters;                      /**< Number of characters*/
-        Space* spaces[MAX_SPACES];             /**< Spaces array*/
+        Space** spaces;                        /**< Spaces array*/
         int n_spaces;                          /**< Number of spaces*/
         Command* last_cmd;                     /**< Pointer to a command*/
         Bool finished;                         /**< Bool representing if the game has ended*/
-        Link* links[MAX_LINKS];                /**< Links array*/
+        Link** links;                          /**< Links array*/
+        Link* (*adjacency)[N_DIRECTIONS];      /**< Link leaving each space (same position as in spaces) in each direction*/
         int n_links;                           /**< Number of links*/
+        Game_capacity capacity;                /**< Number of entities of each kind the arrays can hold*/
         int deterministic;                     /**< 1 if yes, 0 if not*/
         Bool combat_succeds;                   /**< 1 if the players has won, 0 if not*/
+        Map* player_index;                     /**< Position in players of each player, by id*/
+        Map* object_index;                     /**< Position in objects of each object, by id*/
+        Map* character_index;                  /**< Position in characters of each character, by id*/
+        Map* space_index;                      /**< Position in spaces of each space, by id*/
+        Map* link_index;                       /**< Position in links of each link, by id*/
+        Name_index* object_names;              /**< Id of the first object added with each name*/
+        Name_index* character_names;           /**< Id of the first character added with each name*/
+        Name_index* link_names;                /**< Id of the first link with each name*/
+        Map* object_locations;                 /**< Space of each object lying on the floor, by id*/
+        Map* character_locations;              /**< Space of each character, by id*/
+        Map* object_orders;                    /**< Order in which each object was added, by id*/
+        Map* character_orders;                 /**< Order in which each character was added, by id*/
+        long n_orders;                         /**< Order of the next object or character added*/
+        Map* orphan_links;                     /**< Last link (position in links) waiting for its origin, by space id*/
+        int* orphan_next;                      /**< Previous link waiting for the same origin (same position as in links)*/
+        int draws[MAX_DRAWS];                  /**< Random numbers drawn in the current turn*/
+        int n_draws;                           /**< Number of numbers drawn in the current turn*/
+        int forced_draws[MAX_DRAWS];           /**< Numbers returned instead of drawing new ones, to replay a turn*/
+        int n_forced_draws;                    /**< Number of forced draws*/
+        int next_forced_draw;                  /**< Position of the next forced draw to return*/
+        Rng rng;                               /**< Generator of the random numbers of the game*/
+        Game_hash state_hash;                  /**< Hash of the state, updated along with every change of it*/
+        long n_changes;                        /**< Number of changes of the state so far*/
+        Game_turn* recording;                  /**< Turn whose changes are being recorded, NULL if they are not*/
+        Game_turn* undo[GAME_MAX_UNDO];        /**< Turns that can be undone, as a ring from first_undo*/
+        int first_undo;                        /**< Position in undo of the oldest turn*/
+        int n_undo;                            /**< Number of turns that can be undone*/
+        Game_turn* redo[GAME_MAX_UNDO];        /**< Turns undone, the last one at the top*/
+        int n_redo;                            /**< Number of turns that can be redone*/
 };
 
 /**
@@ -134,16 +286,6 @@ Id game_get_space_id_at(const Game* game, int position);
  */
 const char* game_get_message_of_current_space(const Game* game);
 
-/**
- * @brief Modifies the name parameter to the name of the object corresponding to the id given
- * @author Carlos Méndez
- *
- * @param game Pointer to game
- * @param id The id of the object
- * @param name string that, when leaving the function stores the name of the object
- */
-void game_get_object_name_by_id(const Game* game, Id id, char* name);
-
 /**
  * @brief Retrieves the index of an object by its ID
  * @author Carlos Méndez
@@ -185,15 +327,45 @@ int game_get_character_index_from_id(const Game* game, Id id);
 int game_get_link_index_from_id(const Game* game, Id id);
 
 /**
- * @brief Gets an array of IDs of the links connected to a space
+ * @brief Gets the link that leaves a space in a direction
  * @author Carlos Méndez
  *
  * @param game Pointer to pointer to the game
  * @param space_id ID of the space
  * @param direction Direction to obtain its space_id
- * @return Index of a link in the link's array or INVALID_INDEX otherwise
+ * @return The link, or NULL if there is none
+ */
+Link* game_get_link_from_orig_direct(const Game* game, Id space_id, Direction direction);
+
+/**
+ * @brief Points the adjacency slot of a space and direction at the first link that leaves it that way
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param space_id ID of the space
+ * @param direction Direction of the slot
+ */
+void game_refresh_adjacency(Game* game, Id space_id, Direction direction);
+
+/**
+ * @brief Puts a link in the adjacency slot of its origin and direction, unless another link took it first. If
+ * its origin is not loaded yet, the link waits in the chain of that space until it is added
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param index Position of the link in the links array
+ */
+void game_place_link(Game* game, int index);
+
+/**
+ * @brief Takes a link out of the chain of links waiting for a space
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param index Position of the link in the links array
+ * @param origin ID of the space the link was waiting for
  */
-int game_get_link_index_from_orig_direct(const Game* game, Id space_id, Direction direction);
+void game_unchain_link(Game* game, int index, Id origin);
 
 /**
  * @brief Moves the alive players one place to the left in the array
@@ -204,1373 +376,3676 @@ int game_get_link_index_from_orig_direct(const Game* game, Id space_id, Directio
 void game_exclude_player(Game* game);
 
 /**
- *   Game interface implementation
+ * @brief Makes room in the entity arrays for, at least, the given number of entities of each kind
+ * @author Abraham Martín
+ *
+ * Arrays that have to grow at least double their size, so adding entities one by one is amortised O(1).
+ *
+ * @param game Pointer to the game
+ * @param capacity Number of entities of each kind that must fit
+ * @return OK if the memory could be reserved, ERROR otherwise
  */
+Status game_reserve(Game* game, const Game_capacity* capacity);
 
-/*Manejo de Games*/
-Status game_create(Game** game) {
-        int i = 0;
+/**
+ * @brief Computes the new size of an entity array that has to grow
+ * @author Abraham Martín
+ *
+ * @param current Number of entities the array can hold now
+ * @param needed Number of entities the array must be able to hold
+ * @return The new number of entities the array will hold
+ */
+int game_grown_capacity(int current, int needed);
 
-        /*Error control*/
-        if (!game) {
-                return ERROR;
-        }
+/**
+ * @brief Adds a number to a signature
+ * @author Abraham Martín
+ *
+ * @param signature Signature computed so far
+ * @param value Number to add
+ * @return The new signature
+ */
+unsigned long game_signature_long(unsigned long signature, long value);
 
-        *game = (Game*)malloc(sizeof(Game));
-        if (!(*game)) {
-                return ERROR;
-        }
-        /*Create spaces*/
-        for (i = 0; i < MAX_SPACES; i++) {
-                (*game)->spaces[i] = NULL;
-        }
-        (*game)->n_spaces = 0;
+/**
+ * @brief Adds a string to a signature
+ * @author Abraham Martín
+ *
+ * @param signature Signature computed so far
+ * @param str String to add, NULL is treated as an empty string
+ * @return The new signature
+ */
+unsigned long game_signature_string(unsigned long signature, const char* str);
 
-        /*nitialize player's array and other related fields*/
-        for (i = 0; i < MAX_PLAYERS; i++) {
-                (*game)->players[i] = NULL;
-                (*game)->player_indices[i] = i;
-        }
-        (*game)->n_players = 0;
-        (*game)->num_alive_players = 0;
-        (*game)->turn = 0;
-        /*Create objects*/
-        for (i = 0; i < MAX_OBJECTS; i++) {
-                (*game)->objects[i] = NULL;
-        }
-        (*game)->n_objects = 0;
+/**
+ * @brief Adds an object to the game with the order that decides whether it owns its name, if it is repeated
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param object Pointer to the object
+ * @param order Order of the object, the lowest one with a name owns it
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_add_object_in_order(Game* game, Object* object, long order);
 
-        /*Create links*/
-        for (i = 0; i < MAX_LINKS; i++) {
-                (*game)->links[i] = NULL;
-        }
-        (*game)->n_links = 0;
+/**
+ * @brief Adds a character to the game with the order that decides whether it owns its name, if it is repeated
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param character Pointer to the character
+ * @param order Order of the character, the lowest one with a name owns it
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_add_character_in_order(Game* game, Character* character, long order);
 
-        /*Create command*/
-        (*game)->last_cmd = command_create();
-        for (i = 0; i < MAX_CHARACTERS; i++) {
-                (*game)->characters[i] = NULL;
-        }
-        (*game)->n_characters = 0;
-        (*game)->finished = FALSE;
+/**
+ * @brief Makes the name of an object resolve to it, unless an object added before it has the same name
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param index Position of the object in the objects array
+ */
+void game_index_object_name(Game* game, int index);
 
-        return OK;
-}
+/**
+ * @brief Removes an object from the name index, the next object added with the same name (if any) takes its name
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param index Position of the object in the objects array
+ */
+void game_unindex_object_name(Game* game, int index);
 
-Status game_create_from_file(Game** game, char* filename) {
-        FILE* file = NULL;
-        /*Error control*/
-        if (!game || !filename) {
-                return ERROR;
-        }
+/**
+ * @brief Makes the name of a character resolve to it, unless a character added before it has the same name
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param index Position of the character in the characters array
+ */
+void game_index_character_name(Game* game, int index);
 
-        if (game_create(game) == ERROR) {
-                return ERROR;
-        }
+/**
+ * @brief Removes a character from the name index, the next character added with the same name (if any) takes its
+ * name
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param index Position of the character in the characters array
+ */
+void game_unindex_character_name(Game* game, int index);
 
-        file = fopen(filename, "r");
-        if (!file) {
-                return ERROR;
-        }
+/**
+ * @brief Writes a number to a snapshot
+ * @author Abraham Martín
+ *
+ * @param f Stream of the snapshot
+ * @param value Number to write
+ */
+void game_snapshot_write_long(FILE* f, long value);
 
-        if (game_management_load_spaces(game, filename) == ERROR) {
-                fclose(file);
-                return ERROR;
-        }
-        fseek(file, 0L, SEEK_SET);
+/**
+ * @brief Writes a string to a snapshot, preceded by its length
+ * @author Abraham Martín
+ *
+ * @param f Stream of the snapshot
+ * @param str String to write, NULL is written as an empty string
+ */
+void game_snapshot_write_string(FILE* f, const char* str);
 
-        if (game_management_load_objects(game, filename) == ERROR) {
-                fclose(file);
-                return ERROR;
-        }
-        fseek(file, 0L, SEEK_SET);
+/**
+ * @brief Writes the ids of a set to a snapshot, preceded by how many there are
+ * @author Abraham Martín
+ *
+ * @param f Stream of the snapshot
+ * @param set Set to write
+ */
+void game_snapshot_write_set(FILE* f, const Set* set);
 
-        if (game_management_load_characters(game, filename) == ERROR) {
-                fclose(file);
-                return ERROR;
-        }
-        fseek(file, 0L, SEEK_SET);
+/**
+ * @brief Reads a number from a snapshot
+ * @author Abraham Martín
+ *
+ * @param f Stream of the snapshot
+ * @param value Pointer where the number is stored
+ * @return OK if it could be read, ERROR otherwise
+ */
+Status game_snapshot_read_long(FILE* f, long* value);
 
-        if (game_management_load_links(game, filename) == ERROR) {
-                fclose(file);
-                return ERROR;
-        }
-        fseek(file, 0L, SEEK_SET);
+/**
+ * @brief Reads a string from a snapshot
+ * @author Abraham Martín
+ *
+ * @param f Stream of the snapshot
+ * @param str String where it is stored
+ * @param size Size of str, longer strings are rejected
+ * @return OK if it could be read, ERROR otherwise
+ */
+Status game_snapshot_read_string(FILE* f, char* str, int size);
 
-        if (game_management_load_players(game, filename) == ERROR) {
-                fclose(file);
-                return ERROR;
-        }
+/**
+ * @brief Reads the spaces, links, objects and characters of a snapshot and adds them to the game
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game, with room for every entity
+ * @param f Stream of the snapshot, right after the number of entities of each kind
+ * @param counts Number of entities of each kind
+ * @return OK if everything could be read and added, ERROR otherwise
+ */
+Status game_snapshot_read_world(Game* game, FILE* f, const Game_capacity* counts);
 
-        fclose(file);
-        return OK;
-}
+/**
+ * @brief Reads the players of a snapshot, with their objects and followers, and adds them to the game
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game, with every other entity already added
+ * @param f Stream of the snapshot, right after the characters
+ * @param n_players Number of players
+ * @return OK if everything could be read and added, ERROR otherwise
+ */
+Status game_snapshot_read_players(Game* game, FILE* f, int n_players);
 
-Status game_destroy(Game* game) {
-        int i = 0;
-        if (game) {
-                if (game->n_spaces > 0) {
-                        for (i = 0; i < game->n_spaces; i++) {
-                                space_destroy((game->spaces)[i]);
-                                (game->spaces)[i] = NULL;
-                        }
-                }
-                command_destroy(game->last_cmd);
-                game->last_cmd = NULL;
-                if (game->n_players > 0) {
-                        for (i = 0; i < game->n_players; i++) {
-                                player_destroy(game->players[i]);
-                                game->players[i] = NULL;
-                        }
-                }
-                if (game->n_objects > 0) {
-                        for (i = 0; i < game->n_objects; i++) {
-                                object_destroy((game->objects)[i]);
-                                (game->objects)[i] = NULL;
-                        }
-                }
-                if (game->n_characters > 0) {
-                        for (i = 0; i < game->n_characters; i++) {
-                                character_destroy(game->characters[i]);
-                                (game->characters)[i] = NULL;
-                        }
-                }
-                if (game->n_links > 0) {
-                        for (i = 0; i < game->n_links; i++) {
-                                link_destroy(game->links[i]);
-                                (game->links)[i] = NULL;
-                        }
-                }
+/**
+ * @brief Reads what lies in each space and the state of the turn from a snapshot
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game, with every entity already added
+ * @param f Stream of the snapshot, right after the players
+ * @return OK if everything could be read, ERROR otherwise
+ */
+Status game_snapshot_read_state(Game* game, FILE* f);
 
-                free(game);
-        }
+/**
+ * @brief Scrambles the bits of a 32 bits number
+ * @author Abraham Martín
+ *
+ * @param x Number to scramble, only its lower 32 bits are used
+ * @return The scrambled number, of 32 bits
+ */
+unsigned long game_hash_mix(unsigned long x);
 
-        return OK;
-}
+/**
+ * @brief Adds the key of a value of a feature to a state hash, or removes it if it was already there
+ * @author Abraham Martín
+ *
+ * @param hash Pointer to the hash
+ * @param feature Part of the state the value belongs to
+ * @param id Id of the entity the value belongs to
+ * @param value The value
+ */
+void game_hash_feature(Game_hash* hash, Hash_feature feature, Id id, long value);
 
-/*-----------------------------Manejo de Players-----------------------------*/
-int game_get_n_players(Game* game) {
-        if (!game) {
-                return -1;
-        }
+/**
+ * @brief Adds the keys of the location, health and objects of a player to a state hash, or removes them
+ * @author Abraham Martín
+ *
+ * @param hash Pointer to the hash
+ * @param player Pointer to the player
+ */
+void game_hash_player(Game_hash* hash, const Player* player);
 
-        return game->n_players;
-}
+/**
+ * @brief Adds the key of the location of an object to a state hash, or removes it
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param hash Pointer to the hash
+ * @param object Pointer to the object
+ */
+void game_hash_object(const Game* game, Game_hash* hash, const Object* object);
 
-Player* game_get_player_from_id(const Game* game, Id id) {
-        int index = 0;
+/**
+ * @brief Adds the keys of the location, health and following of a character to a state hash, or removes them
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param hash Pointer to the hash
+ * @param character Pointer to the character
+ */
+void game_hash_character(const Game* game, Game_hash* hash, const Character* character);
+
+/**
+ * @brief Gives the turn to a player, updating the state hash
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param turn Position in player_indices of the player
+ */
+void game_change_turn(Game* game, int turn);
+
+/**
+ * @brief Sets the health of a player, updating the state hash
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param player Pointer to a player of the game
+ * @param health The new health
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_change_player_health(Game* game, Player* player, int health);
+
+/**
+ * @brief Sets the health of a character, updating the state hash
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param character Pointer to a character of the game
+ * @param health The new health
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_change_character_health(Game* game, Character* character, int health);
+
+/**
+ * @brief Computes the state hash of a game from scratch and keeps it as the current one, once its entities have been
+ * changed without updating it
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_refresh_state_hash(Game* game);
+
+/**
+ * @brief Moves a player, updating the state hash
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param player Pointer to a player of the game
+ * @param location Id of the new space
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_change_player_location(Game* game, Player* player, Id location);
+
+/**
+ * @brief Sets the damage of a player
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param player Pointer to a player of the game
+ * @param damage The new damage
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_change_player_damage(Game* game, Player* player, int damage);
+
+/**
+ * @brief Puts an object in the backpack of a player or takes it out, updating the state hash
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param player Pointer to a player of the game
+ * @param object_id Id of the object
+ * @param carried TRUE to put it in, FALSE to take it out
+ * @param order Position the id takes in the set it is put in, INVALID_INDEX to leave it at the end
+ * @return OK if everything went well, ERROR if it already was or could not be done
+ */
+Status game_change_player_object(Game* game, Player* player, Id object_id, Bool carried, int order);
+
+/**
+ * @brief Takes a player out of the players whose turn comes, or puts one back, as when a player dies
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param position Position in player_indices
+ * @param player_index Position in players of the player put back, or INVALID_INDEX to take out the one at position
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_change_alive_player(Game* game, int position, int player_index);
+
+/**
+ * @brief Puts an object on the floor of a space or picks it up from the floor, keeping the space and the location
+ * map together and updating the state hash
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param object_id Id of the object
+ * @param location Id of the space, or NO_ID to take it from the floor
+ * @param order Position the id takes in the set it is put in, INVALID_INDEX to leave it at the end
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_change_object_location(Game* game, Id object_id, Id location, int order);
+
+/**
+ * @brief Adds an object to the game at a position of the array or takes it out without destroying it, keeping the
+ * indexes and updating the state hash. The last object takes the place of the one taken out, and the one at the
+ * position an object is put back in goes to the end, so each is the reverse of the other
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param object Pointer to the object
+ * @param position Position of the object in objects
+ * @param present TRUE to add it, FALSE to take it out
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_change_object_presence(Game* game, Object* object, int position, Bool present);
+
+/**
+ * @brief Moves a character to a space or takes it out of any, keeping the space and the location map together and
+ * updating the state hash
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param character_id Id of the character
+ * @param location Id of the space, or NO_ID to take it out
+ * @param order Position the id takes in the set it is put in, INVALID_INDEX to leave it at the end
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_change_character_location(Game* game, Id character_id, Id location, int order);
+
+/**
+ * @brief Adds a character to the game at a position of the array or takes it out without destroying it, keeping the
+ * indexes and the followers of its player and updating the state hash. The last character takes the place of the one
+ * taken out, and the one at the position a character is put back in goes to the end
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param character Pointer to the character
+ * @param position Position of the character in characters
+ * @param present TRUE to add it, FALSE to take it out
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_change_character_presence(Game* game, Character* character, int position, Bool present);
+
+/**
+ * @brief Sets the player a character follows, keeping the followers of the players and updating the state hash
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param character Pointer to a character of the game
+ * @param player_id Id of the player, or NO_ID to follow nobody
+ * @param order Position the id takes in the set it is put in, INVALID_INDEX to leave it at the end
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_change_character_following(Game* game, Character* character, Id player_id, int order);
+
+/**
+ * @brief Renames a character, keeping the name index
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param character Pointer to a character of the game
+ * @param name The new name
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_change_character_name(Game* game, Character* character, char* name);
+
+/**
+ * @brief Opens or closes a link, updating the state hash
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param link Pointer to a link of the game
+ * @param open TRUE to open it, FALSE to close it
+ * @return OK if everything went well, ERROR otherwise
+ */
+Status game_change_link_open(Game* game, Link* link, Bool open);
+
+/**
+ * @brief Adds a change to the turn being recorded, if any. It is called before the change is done
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param kind Part of the state changed
+ * @param target Entity or value of the rules changed, NULL if none
+ * @param id Id of the entity changed, NO_ID if none
+ * @param position Position of the player or entity taken out or put back, or of the id in the set it is taken out
+ * of, INVALID_INDEX if none
+ * @param value Value before the change
+ * @return OK if the change was recorded or no turn is being recorded, ERROR otherwise
+ */
+Status game_record_change(Game* game, Change_kind kind, void* target, Id id, int position, long value);
+
+/**
+ * @brief Adds the renaming of a character to the turn being recorded, if any, keeping a copy of its current name
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param character Pointer to the character
+ * @return OK if the change was recorded or no turn is being recorded, ERROR otherwise
+ */
+Status game_record_name(Game* game, Character* character);
+
+/**
+ * @brief Applies a change recorded, without recording it again, and puts in its place the change that reverses it
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param change Pointer to the change
+ */
+void game_apply_change(Game* game, Game_change* change);
+
+/**
+ * @brief Frees what a change keeps: the name of a character, or the entity taken out of the game
+ * @author Abraham Martín
+ *
+ * @param change Pointer to the change, of a turn the game is not going to go back over
+ */
+void game_free_change(Game_change* change);
+
+/**
+ * @brief Frees a turn and its changes
+ * @author Abraham Martín
+ *
+ * @param turn Pointer to the turn
+ */
+void game_turn_destroy(Game_turn* turn);
+
+/**
+ * @brief Ends the turn being recorded: if it changed anything it is kept to be undone, the turns undone are forgotten
+ * and nothing is recorded until the next game_begin_turn
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ */
+void game_commit_turn(Game* game);
+
+/**
+ * @brief Keeps a turn as the last one to be undone, forgetting the oldest one if there are GAME_MAX_UNDO
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param turn Pointer to the turn
+ */
+void game_push_undo(Game* game, Game_turn* turn);
+
+/**
+ * @brief Forgets the turns undone
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ */
+void game_clear_redo(Game* game);
+
+/**
+ *   Game interface implementation
+ */
+
+/*Manejo de Games*/
+Status game_create(Game** game, const Game_capacity* capacity) {
+        /*Error control*/
+        if (!game) {
+                return ERROR;
+        }
+
+        *game = (Game*)malloc(sizeof(Game));
+        if (!(*game)) {
+                return ERROR;
+        }
+        /*The entity arrays start empty and grow as they are needed*/
+        (*game)->spaces = NULL;
+        (*game)->adjacency = NULL;
+        (*game)->n_spaces = 0;
+
+        /*nitialize player's array and other related fields*/
+        (*game)->players = NULL;
+        (*game)->player_indices = NULL;
+        (*game)->n_players = 0;
+        (*game)->num_alive_players = 0;
+        (*game)->turn = 0;
+        /*Create objects*/
+        (*game)->objects = NULL;
+        (*game)->n_objects = 0;
+
+        /*Create links*/
+        (*game)->links = NULL;
+        (*game)->orphan_next = NULL;
+        (*game)->n_links = 0;
+
+        (*game)->capacity.n_spaces = 0;
+        (*game)->capacity.n_objects = 0;
+        (*game)->capacity.n_characters = 0;
+        (*game)->capacity.n_links = 0;
+        (*game)->capacity.n_players = 0;
+
+        /*Create command*/
+        (*game)->last_cmd = command_create();
+        (*game)->characters = NULL;
+        (*game)->n_characters = 0;
+        (*game)->finished = FALSE;
+        (*game)->deterministic = 0;
+        (*game)->combat_succeds = FALSE;
+
+        /*Nothing has been drawn and no turn is being replayed*/
+        (*game)->n_draws = 0;
+        (*game)->n_forced_draws = 0;
+        (*game)->next_forced_draw = 0;
+        rng_seed(&(*game)->rng, GAME_DEFAULT_SEED);
+        (*game)->state_hash.high = 0;
+        (*game)->state_hash.low = 0;
+        (*game)->n_changes = 0;
+        game_hash_feature(&(*game)->state_hash, HASH_TURN, NO_ID, (*game)->turn);
+
+        /*The changes are not recorded until the first turn begins*/
+        (*game)->recording = NULL;
+        (*game)->first_undo = 0;
+        (*game)->n_undo = 0;
+        (*game)->n_redo = 0;
+
+        /*Create the id indexes*/
+        (*game)->player_index = map_create();
+        (*game)->object_index = map_create();
+        (*game)->character_index = map_create();
+        (*game)->space_index = map_create();
+        (*game)->link_index = map_create();
+        (*game)->object_names = name_index_create();
+        (*game)->character_names = name_index_create();
+        (*game)->link_names = name_index_create();
+        (*game)->object_locations = map_create();
+        (*game)->character_locations = map_create();
+        (*game)->orphan_links = map_create();
+        (*game)->object_orders = map_create();
+        (*game)->character_orders = map_create();
+        (*game)->n_orders = 0;
+        if (!(*game)->player_index || !(*game)->object_index || !(*game)->character_index || !(*game)->space_index ||
+            !(*game)->link_index || !(*game)->object_names || !(*game)->character_names || !(*game)->link_names ||
+            !(*game)->object_locations || !(*game)->character_locations || !(*game)->orphan_links ||
+            !(*game)->object_orders || !(*game)->character_orders) {
+                game_destroy(*game);
+                *game = NULL;
+                return ERROR;
+        }
+
+        if (capacity && game_reserve(*game, capacity) == ERROR) {
+                game_destroy(*game);
+                *game = NULL;
+                return ERROR;
+        }
+
+        return OK;
+}
+
+Status game_create_from_file(Game** game, char* filename) {
+        /*Error control*/
+        if (!game || !filename) {
+                return ERROR;
+        }
+
+        /*Compiled worlds are mapped instead of parsed*/
+        if (world_image_is_image(filename) == TRUE) {
+                if (world_image_load(game, filename) == ERROR) {
+                        return ERROR;
+                }
+                return game_refresh_state_hash(*game);
+        }
+
+        /*The loader creates the game with room for every record of the file*/
+        if (game_management_load_game_from_file(game, filename) == ERROR) {
+                return ERROR;
+        }
+
+        /*The loaders fill some entities before adding them and some after, so the hash is computed once at the end*/
+        return game_refresh_state_hash(*game);
+}
+
+Status game_destroy(Game* game) {
+        int i = 0;
+        if (game) {
+                game_forget_history(game);
+                if (game->n_spaces > 0) {
+                        for (i = 0; i < game->n_spaces; i++) {
+                                space_destroy((game->spaces)[i]);
+                                (game->spaces)[i] = NULL;
+                        }
+                }
+                command_destroy(game->last_cmd);
+                game->last_cmd = NULL;
+                if (game->n_players > 0) {
+                        for (i = 0; i < game->n_players; i++) {
+                                player_destroy(game->players[i]);
+                                game->players[i] = NULL;
+                        }
+                }
+                if (game->n_objects > 0) {
+                        for (i = 0; i < game->n_objects; i++) {
+                                object_destroy((game->objects)[i]);
+                                (game->objects)[i] = NULL;
+                        }
+                }
+                if (game->n_characters > 0) {
+                        for (i = 0; i < game->n_characters; i++) {
+                                character_destroy(game->characters[i]);
+                                (game->characters)[i] = NULL;
+                        }
+                }
+                if (game->n_links > 0) {
+                        for (i = 0; i < game->n_links; i++) {
+                                link_destroy(game->links[i]);
+                                (game->links)[i] = NULL;
+                        }
+                }
+                map_destroy(game->player_index);
+                map_destroy(game->object_index);
+                map_destroy(game->character_index);
+                map_destroy(game->space_index);
+                map_destroy(game->link_index);
+                name_index_destroy(game->object_names);
+                name_index_destroy(game->character_names);
+                name_index_destroy(game->link_names);
+                map_destroy(game->object_locations);
+                map_destroy(game->character_locations);
+                map_destroy(game->orphan_links);
+                map_destroy(game->object_orders);
+                map_destroy(game->character_orders);
+                free(game->orphan_next);
+                free(game->spaces);
+                free(game->adjacency);
+                free(game->players);
+                free(game->player_indices);
+                free(game->objects);
+                free(game->characters);
+                free(game->links);
+
+                free(game);
+        }
+
+        return OK;
+}
+
+Status game_clone(const Game* game, Game** clone) {
+        Game* copy = NULL;
+        Link* link = NULL;
+        int i, direction;
+
+        /*Error control*/
+        if (!game || !clone) {
+                return ERROR;
+        }
+        *clone = NULL;
+
+        /*The arrays and indexes of the copy are reserved at once with the size of the original ones*/
+        if (game_create(&copy, &game->capacity) == ERROR) {
+                return ERROR;
+        }
+
+        /*Each counter grows with its array, so game_destroy frees what was copied if something fails*/
+        for (i = 0; i < game->n_players; i++) {
+                if (!(copy->players[i] = player_copy(game->players[i]))) break;
+                copy->n_players++;
+        }
+        for (i = 0; i < game->n_objects && copy->n_players == game->n_players; i++) {
+                if (!(copy->objects[i] = object_copy(game->objects[i]))) break;
+                copy->n_objects++;
+        }
+        for (i = 0; i < game->n_characters && copy->n_objects == game->n_objects; i++) {
+                if (!(copy->characters[i] = character_copy(game->characters[i]))) break;
+                copy->n_characters++;
+        }
+        for (i = 0; i < game->n_spaces && copy->n_characters == game->n_characters; i++) {
+                if (!(copy->spaces[i] = space_copy(game->spaces[i]))) break;
+                copy->n_spaces++;
+        }
+        for (i = 0; i < game->n_links && copy->n_spaces == game->n_spaces; i++) {
+                if (!(copy->links[i] = link_copy(game->links[i]))) break;
+                copy->n_links++;
+        }
+        if (copy->n_links < game->n_links || command_copy(copy->last_cmd, game->last_cmd) == ERROR ||
+            map_copy(copy->player_index, game->player_index) == ERROR ||
+            map_copy(copy->object_index, game->object_index) == ERROR ||
+            map_copy(copy->character_index, game->character_index) == ERROR ||
+            map_copy(copy->space_index, game->space_index) == ERROR ||
+            map_copy(copy->link_index, game->link_index) == ERROR ||
+            name_index_copy(copy->object_names, game->object_names) == ERROR ||
+            name_index_copy(copy->character_names, game->character_names) == ERROR ||
+            name_index_copy(copy->link_names, game->link_names) == ERROR ||
+            map_copy(copy->object_locations, game->object_locations) == ERROR ||
+            map_copy(copy->character_locations, game->character_locations) == ERROR ||
+            map_copy(copy->orphan_links, game->orphan_links) == ERROR ||
+            map_copy(copy->object_orders, game->object_orders) == ERROR ||
+            map_copy(copy->character_orders, game->character_orders) == ERROR) {
+                game_destroy(copy);
+                return ERROR;
+        }
+
+        /*The entities keep their positions, so the links of the adjacency are found at the same place*/
+        for (i = 0; i < game->n_spaces; i++) {
+                for (direction = 0; direction < N_DIRECTIONS; direction++) {
+                        link = game->adjacency[i][direction];
+                        copy->adjacency[i][direction] =
+                            link ? copy->links[game_get_link_index_from_id(game, link_get_id(link))] : NULL;
+                }
+        }
+        if (game->n_players > 0) {
+                memcpy(copy->player_indices, game->player_indices, game->n_players * sizeof(int));
+        }
+        if (game->n_links > 0) {
+                memcpy(copy->orphan_next, game->orphan_next, game->n_links * sizeof(int));
+        }
+
+        copy->num_alive_players = game->num_alive_players;
+        copy->n_orders = game->n_orders;
+        copy->turn = game->turn;
+        copy->finished = game->finished;
+        copy->deterministic = game->deterministic;
+        copy->combat_succeds = game->combat_succeds;
+        memcpy(copy->draws, game->draws, sizeof(game->draws));
+        copy->n_draws = game->n_draws;
+        memcpy(copy->forced_draws, game->forced_draws, sizeof(game->forced_draws));
+        copy->n_forced_draws = game->n_forced_draws;
+        copy->next_forced_draw = game->next_forced_draw;
+        copy->rng = game->rng;
+        copy->state_hash = game->state_hash;
+        copy->n_changes = game->n_changes;
+
+        *clone = copy;
+
+        return OK;
+}
+
+/*-----------------------------Manejo de Players-----------------------------*/
+int game_get_n_players(Game* game) {
+        if (!game) {
+                return -1;
+        }
+
+        return game->n_players;
+}
+
+Player* game_get_player_from_id(const Game* game, Id id) {
+        int index = 0;
+
+        if (!game || id == NO_ID) {
+                return NULL;
+        }
+        index = game_get_player_index_from_id(game, id);
+        return game_get_player_from_index(game, index);
+}
+
+Player* game_get_player_from_index(const Game* game, int index) {
+        if (!game || index < 0 || index >= game->n_players) {
+                return NULL;
+        }
+
+        return game->players[index];
+}
+
+Id game_extract_object_from_player(Game* game, Id object_id) {
+        if (!game || object_id == NO_ID) return NO_ID;
+        if (game_change_player_object(game, game_get_current_player((const Game*)game), object_id, FALSE, INVALID_INDEX) ==
+            ERROR) {
+                return NO_ID;
+        }
+        return object_id;
+}
+
+Status game_put_object_on_player(Game* game, Id object_id) {
+        Player* player = NULL;
+
+        if (!game || object_id == NO_ID) {
+                return ERROR;
+        }
+
+        player = game_get_current_player((const Game*)game);
+        if (!player) {
+                return ERROR;
+        }
+
+        return game_change_player_object(game, player, object_id, TRUE, INVALID_INDEX);
+}
+
+Status game_player_gets_attacked(Game* game) {
+        int health;
+        int character_health;
+        int number;
+        const Set* characters_following = NULL;
+        int n_chararcters = 0;
+        int index_character_attacked = 0;
+        Player* player_attacked = NULL;
+        Character* character_attacked = NULL;
+
+        if (!game) return ERROR;
+
+        n_chararcters = game_get_n_characters_following_current_player(game);
+
+        player_attacked = game_get_current_player((const Game*)game);
+        if (!player_attacked) {
+                return ERROR;
+        }
+
+        if (n_chararcters == 0) {
+                number = 0;
+        } else {
+                number = game_random(game, n_chararcters) + 1;
+        }
+
+        if (number == 0) {
+                health = player_get_health(player_attacked);
+                game_change_player_health(game, player_attacked, --health);
+                if (health == 0) {
+                        game_exclude_player(game);
+                        if (game->num_alive_players == 0) game_set_finished(game, TRUE);
+                } else {
+                        game_pass_turn(game);
+                }
+        } else {
+                characters_following = game_get_characters_following_current_player((const Game*)game);
+                index_character_attacked = number;
+
+                character_attacked = game_get_character_from_id(
+                    (const Game*)game, set_get_id_at_index(characters_following, index_character_attacked - 1));
+
+                if (!character_attacked) {
+                        return ERROR;
+                }
+
+                character_health = character_get_health(character_attacked);
+                game_change_character_health(game, character_attacked, --character_health);
+
+                if (character_health == 0) {
+                        game_del_character(game, character_attacked);
+                } else {
+                        game_pass_turn(game);
+                }
+        }
+
+        return OK;
+}
+
+Status game_player_gets_attacked_by_use(Game* game, int new_health) {
+        if (!game) return ERROR;
+        game_change_player_health(game, game->players[game->player_indices[game->turn]], new_health);
+        if (new_health <= 0) {
+                game_exclude_player(game);
+                if (game->num_alive_players == 0) game_set_finished(game, TRUE);
+        } else {
+                game_pass_turn(game);
+        }
+        return OK;
+}
+
+Status game_set_player_location(Game* game, Id id) {
+        Player* player = NULL;
+
+        /*Error control*/
+        if (!game) {
+                return ERROR;
+        }
+
+        if (id == NO_ID) {
+                return ERROR;
+        }
+
+        player = game_get_current_player((const Game*)game);
+        if (!player) {
+                return ERROR;
+        }
+
+        return game_change_player_location(game, player, id);
+}
+
+Id game_get_player_location(const Game* game) {
+        /*Error control*/
+        if (!game) {
+                return NO_ID;
+        }
+
+        return player_get_location(game_get_current_player(game));
+}
+
+Status game_set_player_damage(Game* game, Player* player, int damage) {
+        if (!game || !player || damage < 0) {
+                return ERROR;
+        }
+
+        return game_change_player_damage(game, player, damage);
+}
+
+Player* game_get_current_player(const Game* game) {
+        /*Error control*/
+        if (!game) {
+                return NULL;
+        }
+
+        return game->turn < game->n_players ? game->players[game->turn] : NULL;
+}
+
+Player* game_get_last_player(const Game* game) {
+        Player* last_player = NULL;
+        int turn;
+
+        /*Error control*/
+        if (!game) {
+                return NULL;
+        }
+
+        turn = game_get_current_turn(game);
+        if (game->num_alive_players <= 0) {
+                return NULL;
+        }
+
+        /*On the first turn the last player is the one at the end of the round*/
+        last_player = game->players[(turn - 1 + game->num_alive_players) % game->num_alive_players];
+        if (player_get_health(last_player) <= 0) {
+                return NULL;
+        }
+
+        return last_player;
+}
+
+Status game_add_player(Game* game, Player* player) {
+        Game_capacity needed = {0, 0, 0, 0, 0};
+        Id id_aux = NO_ID;
+        int index;
+        /*Error control*/
+        if (!game || !player) {
+                return ERROR;
+        }
+        id_aux = player_get_id(player);
+        index = game_get_player_index_from_id((const Game*)game, id_aux);
+        if (index == -1) {
+                needed.n_players = game->n_players + 1;
+                if (game_reserve(game, &needed) == ERROR) return ERROR;
+                if (map_set(game->player_index, id_aux, game->n_players) == ERROR) return ERROR;
+                game->players[game->n_players++] = player;
+                if (player_get_health(player) > 0) {
+                        game->player_indices[game->num_alive_players++] = game->n_players - 1;
+                }
+                /*Characters are loaded before players, so their followers are gathered here*/
+                for (index = 0; index < game->n_characters; index++) {
+                        if (character_get_following(game->characters[index]) == id_aux) {
+                                player_add_follower(player, character_get_id(game->characters[index]));
+                        }
+                }
+                game_hash_player(&game->state_hash, player);
+        } else
+                return ERROR;
+        return OK;
+}
+
+int game_get_player_health(const Game* game) {
+        if (!game) return -1;
+        return player_get_health(game_get_current_player(game));
+}
+
+Status game_set_player_new_health(Game* game, int new_health, Player* player) {
+        if (!game) return ERROR;
+
+        game_change_player_health(game, player, new_health);
+        if (new_health <= 0) {
+                game_exclude_player(game);
+                if (game->num_alive_players == 0) game_set_finished(game, TRUE);
+        }
+
+        return OK;
+}
+
+const char* game_get_player_name(const Game* game) {
+        if (!game) return NULL;
+        return player_get_name(game_get_current_player(game));
+}
+
+Bool game_player_has_object(const Game* game, Id object) {
+        if (!game || object == NO_ID) {
+                return FALSE;
+        }
+
+        return player_has_object(game_get_current_player((const Game*)game), object);
+}
+
+Bool game_get_last_player_won_combat(const Game* game) {
+        if (!game) {
+                return FALSE;
+        }
+
+        return game->combat_succeds;
+}
+
+Status game_set_last_player_won_combat(Game* game, Bool won) {
+        if (!game) {
+                return ERROR;
+        }
+
+        if (game_record_change(game, CHANGE_COMBAT, NULL, NO_ID, INVALID_INDEX, game->combat_succeds) == ERROR) {
+                return ERROR;
+        }
+        game->combat_succeds = won;
+
+        return OK;
+}
+
+/*-----------------------------Manejo de Objects-----------------------------*/
+int game_get_n_objects(Game* game) {
+        if (!game) {
+                return -1;
+        }
+
+        return game->n_objects;
+}
+
+Object* game_get_object_from_index(Game* game, int index) {
+        if (!game || index < 0 || index >= game->n_objects) {
+                return NULL;
+        }
+
+        return game->objects[index];
+}
+
+Object* game_get_object_from_id(const Game* game, Id id) {
+        int index;
+
+        if ((!game) || (id == NO_ID)) {
+                return NULL;
+        }
+        index = game_get_object_index_from_id(game, id);
+
+        if (index != -1) return game->objects[index];
+
+        return NULL;
+}
+
+Status game_add_object(Game* game, Object* object) {
+        /*Error control*/
+        if (!game) {
+                return ERROR;
+        }
+
+        return game_add_object_in_order(game, object, game->n_orders);
+}
+
+Id game_get_object_location(const Game* game, Id id) {
+        if (!game || id == NO_ID) {
+                return NO_ID;
+        }
+
+        return (Id)map_get(game->object_locations, id);
+}
+
+Status game_set_object_location(Game* game, Id object_id, Id space_id) {
+        /*Error control*/
+        if (!game || object_id == NO_ID || space_id == NO_ID) {
+                return ERROR;
+        }
+
+        return game_change_object_location(game, object_id, space_id, INVALID_INDEX);
+}
+
+Id game_del_object_location(Game* game, Id object_id) {
+        /*Error control*/
+        if (!game || object_id == NO_ID) {
+                return NO_ID;
+        }
+
+        if (game_get_object_location((const Game*)game, object_id) == NO_ID ||
+            game_change_object_location(game, object_id, NO_ID, INVALID_INDEX) == ERROR) {
+                return NO_ID;
+        }
+
+        return object_id;
+}
+
+Id game_get_object_location_from_name(const Game* game, char* name) {
+        Id id_aux = NO_ID;
+        int index;
+
+        /*Error control*/
+        if (!game || !name) {
+                return NO_ID;
+        }
+        index = game_get_object_index_from_name(game, name);
+        if (index != -1)
+                id_aux = object_get_id(game->objects[index]);
+        else
+                return NO_ID;
+
+        return game_get_object_location(game, id_aux);
+}
+
+Id game_get_object_id_from_name(const Game* game, const char* name) {
+        int index;
+        if (!game || !name) return NO_ID;
+        index = game_get_object_index_from_name(game, (const char*)name);
+        if (index != -1) return object_get_id(game->objects[index]);
+        return NO_ID;
+}
+
+int game_get_object_health_from_name(const Game* game, const char* name) {
+        int index;
+
+        if (!game || !name) {
+                return -1;
+        }
+
+        index = game_get_object_index_from_name(game, name);
+
+        return object_get_health(game->objects[index]);
+}
+
+Status game_object_destroy_from_name(Game* game, char* name) {
+        int index;
+        Object* object = NULL;
+        if (!game || !name) return ERROR;
+        index = game_get_object_index_from_name(game, name);
+        if (index == INVALID_INDEX) return ERROR;
+        object = game->objects[index];
+        game_del_object_location(game, object_get_id(object));
+        if (game_change_object_presence(game, object, index, FALSE) == ERROR) return ERROR;
+
+        /*While a turn is recorded its change keeps the object, so the turn can be undone*/
+        return game->recording ? OK : object_destroy(object);
+}
+
+Id game_get_object_open_from_name(const Game* game, char* object_name) {
+        int index;
+
+        if (!game || !object_name) {
+                return NO_ID;
+        }
+
+        index = game_get_object_index_from_name(game, object_name);
+        if (index == INVALID_INDEX) {
+                return NO_ID;
+        }
+
+        return object_get_open(game->objects[index]);
+}
+
+Status game_set_object_name(Game* game, Id id, char* name) {
+        int index;
+
+        if (!game || !name) {
+                return ERROR;
+        }
+
+        index = game_get_object_index_from_id((const Game*)game, id);
+        if (index == INVALID_INDEX) {
+                return ERROR;
+        }
+
+        game_unindex_object_name(game, index);
+        if (object_set_name(game->objects[index], name) == ERROR) {
+                game_index_object_name(game, index);
+                return ERROR;
+        }
+        game_index_object_name(game, index);
+
+        return OK;
+}
+
+/*-----------------------------Manejo de Characters-----------------------------*/
+
+int game_get_n_characters(const Game* game) {
+        if (!game) {
+                return -1;
+        }
+
+        return game->n_characters;
+}
+
+Character* game_get_character_from_index(const Game* game, int index) {
+        if (!game || index < 0 || index >= game->n_characters) {
+                return NULL;
+        }
+
+        return game->characters[index];
+}
+
+Character* game_get_character_from_id(const Game* game, Id character_id) {
+        int index;
+
+        if (!game || character_id == NO_ID) {
+                return NULL;
+        }
+
+        index = game_get_character_index_from_id(game, character_id);
+        if (index == INVALID_INDEX) {
+                return NULL;
+        }
+
+        return game->characters[index];
+}
+
+Status game_set_character_location(Game* game, Id loc, Id character_id) {
+        if (!game || loc == NO_ID || character_id == NO_ID) {
+                return ERROR;
+        }
+
+        return game_change_character_location(game, character_id, loc, INVALID_INDEX);
+}
+
+Id game_del_character_location(Game* game, Id character_id) {
+        if (!game || character_id == NO_ID) {
+                return NO_ID;
+        }
+
+        if (game_get_character_location((const Game*)game, character_id) == NO_ID ||
+            game_change_character_location(game, character_id, NO_ID, INVALID_INDEX) == ERROR) {
+                return NO_ID;
+        }
+
+        return character_id;
+}
+
+Id game_get_character_location(const Game* game, Id character_id) {
+        if (!game || character_id == NO_ID) {
+                return NO_ID;
+        }
+
+        return (Id)map_get(game->character_locations, character_id);
+}
+
+int game_get_n_characters_following_current_player(const Game* game) {
+        if (!game) {
+                return -1;
+        }
+
+        return player_get_n_followers(game_get_current_player(game));
+}
+
+const Set* game_get_characters_following_current_player(const Game* game) {
+        if (!game) return NULL;
+
+        return player_get_followers(game_get_current_player(game));
+}
+
+Status game_set_character_following(Game* game, Id character_id, Id player_id) {
+        Character* character = NULL;
+
+        if (!game) {
+                return ERROR;
+        }
+
+        character = game_get_character_from_id((const Game*)game, character_id);
+        if (!character) {
+                return ERROR;
+        }
+
+        return game_change_character_following(game, character, player_id, INVALID_INDEX);
+}
+
+Status game_set_followers_location(Game* game, Id location) {
+        Set_iterator it;
+        Id character_id = NO_ID;
+
+        if (!game || location == NO_ID) {
+                return ERROR;
+        }
+
+        set_iterator_init(&it, game_get_characters_following_current_player((const Game*)game));
+        while (set_iterator_next(&it, &character_id)) {
+                if (game_set_character_location(game, location, character_id) == ERROR) {
+                        return ERROR;
+                }
+        }
+
+        return OK;
+}
+
+Status game_character_gets_attacked(Game* game, Id character_id) {
+        int health, index, damage = 0;
+        int i = 0;
+
+        if (!game || character_id == NO_ID) {
+                return ERROR;
+        }
+
+        damage = player_get_damage(game_get_current_player((const Game*)game));
+        for (i = 0; i < game->n_characters; i++) {
+                if ((game_get_character_location(game, character_get_id(game->characters[i])) ==
+                     game_get_player_location(game)) &&
+                    (character_id == character_get_id(game->characters[i]))) {
+                        index = game_get_character_index_from_id(game, character_id);
+                }
+        }
+
+        if (index != -1) {
+                health = character_get_health((const Character*)game->characters[index]);
+
+                damage = damage + game_get_n_characters_following_current_player((const Game*)game);
+
+                if (health > 0) {
+                        game_pass_turn(game);
+                        return game_change_character_health(game, game->characters[index], health - damage);
+                } else
+                        return ERROR;
+        }
+        return ERROR;
+}
+
+Status game_character_gets_attacked_by_use(Game* game, int new_health, char* character_name) {
+        int index;
+        Character* character = NULL;
+
+        if (!game) {
+                return ERROR;
+        }
+
+        character = game_get_character_from_name(game, character_name);
+        if (!character) {
+                return ERROR;
+        }
+
+        index = game_get_character_index_from_id((const Game*)game, character_get_id(character));
+        if (index != -1) {
+                if (new_health > 0) {
+                        game_pass_turn(game);
+                        return game_change_character_health(game, game->characters[index], new_health);
+                } else /*Habrá que matar al character, no?*/
+                        return ERROR;
+        }
+        return ERROR;
+}
+
+Status game_add_character(Game* game, Character* character) {
+        /*Error control*/
+        if (!game) {
+                return ERROR;
+        }
+
+        return game_add_character_in_order(game, character, game->n_orders);
+}
+
+Status game_del_character(Game* game, Character* character) {
+        int index;
+        Id id_aux = NO_ID;
+
+        if (!game || !character) {
+                return ERROR;
+        }
+
+        id_aux = character_get_id(character);
+        index = game_get_character_index_from_id((const Game*)game, id_aux);
+        if (index != INVALID_INDEX && game->characters[index] == character) {
+                /*It stops following first, so the place it had among the followers is recorded too*/
+                game_del_character_location(game, id_aux);
+                if (character_get_following(character) != NO_ID) {
+                        game_change_character_following(game, character, NO_ID, INVALID_INDEX);
+                }
+                if (game_change_character_presence(game, character, index, FALSE) == ERROR) return ERROR;
+
+                /*While a turn is recorded its change keeps the character, so the turn can be undone*/
+                if (game->recording) return OK;
+        }
+
+        return character_destroy(character);
+}
+
+Bool game_get_character_is_alive(const Game* game, Id character_id) {
+        int health;
+        int index = 0;
+
+        if (!game) {
+                return FALSE;
+        }
+
+        index = game_get_character_index_from_id(game, character_id);
+
+        health = character_get_health(game->characters[index]);
+        if (health <= 0) {
+                return FALSE;
+        } else {
+                return TRUE;
+        }
+}
+
+Character* game_get_enemy_character_at_space(const Game* game, Id location) {
+        int i = 0;
+        if (!game || location == NO_ID) {
+                return NULL;
+        }
+
+        for (i = 0; i < game->n_characters; i++) {
+                if (game_get_character_location(game, character_get_id(game->characters[i])) == location &&
+                    character_get_friendly(game->characters[i]) == FALSE && character_get_health(game->characters[i]) > 0) {
+                        return game->characters[i];
+                }
+        }
+
+        return NULL;
+}
+
+int game_get_character_index_from_name(const Game* game, char* name) {
+        if (!game || !name) {
+                return INVALID_INDEX;
+        }
+
+        return game_get_character_index_from_id(game, name_index_get(game->character_names, name));
+}
+
+Status game_set_character_name(Game* game, Id id, char* name) {
+        int index;
+
+        if (!game || !name) {
+                return ERROR;
+        }
+
+        index = game_get_character_index_from_id((const Game*)game, id);
+        if (index == INVALID_INDEX) {
+                return ERROR;
+        }
+
+        return game_change_character_name(game, game->characters[index], name);
+}
+
+Status game_set_character_new_health(Game* game, int new_health, char* name) {
+        if (!game || !new_health) return ERROR;
+        return game_change_character_health(game, game->characters[game_get_character_index_from_name(game, name)],
+                                            new_health);
+}
+
+int game_get_character_health_from_name(const Game* game, char* name) {
+        if (!game || !name) return -1;
+        return character_get_health(game->characters[game_get_character_index_from_name(game, name)]);
+}
+
+Character* game_get_character_from_name(Game* game, char* name) {
+        if (!game || !name) {
+                return NULL;
+        }
+
+        return game_get_character_from_id((const Game*)game, name_index_get(game->character_names, name));
+}
+
+/*-----------------------------Manejo de Spaces-----------------------------*/
+int game_get_n_spaces(Game* game) {
+        if (!game) {
+                return -1;
+        }
+
+        return game->n_spaces;
+}
 
-        if (!game || id != NO_ID) {
+Space* game_get_space_from_index(Game* game, int index) {
+        if (!game || index < 0 || index >= game->n_spaces) {
                 return NULL;
         }
-        index = game_get_player_index_from_id(game, id);
-        return game_get_player_from_index(game, index);
+
+        return game->spaces[index];
 }
 
-Player* game_get_player_from_index(const Game* game, int index) {
-        if (!game || index < 0) {
+void game_get_object_list_at_space(const Game* game, Id space_id, char* list, int size) {
+        Text_builder tb;
+        Space* space = NULL;
+        Object* object = NULL;
+        Id id_aux = NO_ID;
+        Set_iterator it;
+
+        if (!game || space_id == NO_ID) return;
+
+        space = game_get_space(game, space_id);
+        if (!space || space_get_discovered(space) == FALSE || space_get_num_objects((const Space*)space) <= 0) {
+                return;
+        }
+        if (text_builder_init(&tb, list, size) == ERROR) {
+                return;
+        }
+
+        /*The first CUT_INDEX - 1 letters of each name, separated by spaces*/
+        set_iterator_init(&it, space_get_objects((const Space*)space));
+        while (set_iterator_next(&it, &id_aux)) {
+                if (!(object = game_get_object_from_id(game, id_aux))) {
+                        continue;
+                }
+                if (text_builder_get_length(&tb) > 0) {
+                        text_builder_append(&tb, " ");
+                }
+                text_builder_append_n(&tb, object_get_name(object), CUT_INDEX - 1);
+        }
+}
+
+Space* game_get_space(const Game* game, Id id) {
+        long index;
+        /*Error control*/
+        if (!game || id == NO_ID) {
                 return NULL;
         }
 
-        return game->players[index];
+        index = map_get(game->space_index, id);
+        if (index == NO_ID) {
+                return NULL;
+        }
+
+        return game->spaces[index];
 }
 
-Id game_extract_object_from_player(Game* game, Id object_id) {
-        Id object_aux = NO_ID;
-        if (!game || object_id == NO_ID) return NO_ID;
-        object_aux = player_del_object(game->players[game->turn], object_id);
-        if (object_aux == NO_ID) return NO_ID;
-        return object_aux;
-        ;
+Status game_set_space_discovered(Game* game, Id space_id, Bool discovered) {
+        Space* space = NULL;
+
+        if (!game) {
+                return ERROR;
+        }
+
+        space = game_get_space((const Game*)game, space_id);
+        if (!space) {
+                return ERROR;
+        }
+
+        if (game_record_change(game, CHANGE_SPACE_DISCOVERED, space, space_id, INVALID_INDEX,
+                               space_get_discovered(space)) == ERROR) {
+                return ERROR;
+        }
+
+        return space_set_discovered(space, discovered);
 }
 
-Status game_put_object_on_player(Game* game, Id object_id) {
-        if (!game || object_id == NO_ID) {
+Status game_add_space(Game* game, Space* space) {
+        Game_capacity needed = {0, 0, 0, 0, 0};
+        Id id_aux = NO_ID;
+        Direction direction = NO_DIRECTION;
+        Link* first = NULL;
+        int i, next;
+        /*Error control*/
+        if (!game || !space) {
                 return ERROR;
         }
-        return player_add_object(game->players[game->turn], object_id);
+        id_aux = space_get_id(space);
+        if (map_has(game->space_index, id_aux) == TRUE) return OK;
+        needed.n_spaces = game->n_spaces + 1;
+        if (game_reserve(game, &needed) == ERROR) return ERROR;
+        if (map_set(game->space_index, id_aux, game->n_spaces) == ERROR) return ERROR;
+        (game->spaces)[(game->n_spaces)++] = space;
+
+        /*Links may have been added before their origin, those wait in the chain of this space*/
+        for (i = 0; i < N_DIRECTIONS; i++) {
+                game->adjacency[game->n_spaces - 1][i] = NULL;
+        }
+        i = map_has(game->orphan_links, id_aux) == TRUE ? (int)map_get(game->orphan_links, id_aux) : INVALID_INDEX;
+        while (i != INVALID_INDEX) {
+                next = game->orphan_next[i];
+                game->orphan_next[i] = NOT_WAITING;
+                direction = link_get_direction(game->links[i]);
+                first = game->adjacency[game->n_spaces - 1][direction];
+                if (!first || game_get_link_index_from_id((const Game*)game, link_get_id(first)) > i) {
+                        game->adjacency[game->n_spaces - 1][direction] = game->links[i];
+                }
+                i = next;
+        }
+        map_del(game->orphan_links, id_aux);
+
+        return OK;
 }
 
-Status game_player_gets_attacked(Game* game) {
-        int health;
-        int character_health;
-        int number;
-        Id* characters_following = NULL;
-        int n_chararcters = 0;
-        int index_character_attacked = 0;
-        Player* player_attacked = NULL;
-        Character* character_attacked = NULL;
+/*-----------------------------Manejo de Commands-----------------------------*/
+Command* game_get_last_command(const Game* game) {
+        /*Error control*/
+        if (!game) {
+                return NULL;
+        }
+
+        return game->last_cmd;
+}
+
+Status game_set_last_command(Game* game, Command* command) {
+        /*Error control*/
+        if (!game) {
+                return ERROR;
+        }
+
+        game->last_cmd = command;
+
+        return OK;
+}
+
+Bool game_get_finished(const Game* game) {
+        /*Error control*/
+        if (!game) {
+                return TRUE;
+        }
+
+        return game->finished;
+}
+
+Status game_set_finished(Game* game, Bool finished) {
+        /*Error control*/
+        if (!game) {
+                return ERROR;
+        }
+        if (game_record_change(game, CHANGE_FINISHED, NULL, NO_ID, INVALID_INDEX, game->finished) == ERROR) {
+                return ERROR;
+        }
+        game->finished = finished;
+
+        return OK;
+}
+
+/*-----------------------------Manejo de Links-----------------------------*/
+int game_get_n_links(Game* game) {
+        if (!game) {
+                return -1;
+        }
+
+        return game->n_links;
+}
+
+Link* game_get_link_from_index(Game* game, int index) {
+        if (!game || index < 0 || index >= game->n_links) {
+                return NULL;
+        }
+
+        return game->links[index];
+}
+
+Bool game_connection_is_open(const Game* game, Id current_space_id, Direction direction) {
+        Link* link = NULL;
+        if (!game || current_space_id == NO_ID || direction == NO_DIRECTION) {
+                return FALSE;
+        }
+
+        link = game_get_link_from_orig_direct(game, current_space_id, direction);
+        if (!link) return FALSE;
+        return link_get_open((const Link*)link);
+}
+
+Id game_get_connection(const Game* game, Id current_space_id, Direction direction) {
+        Link* link = NULL;
+        if (!game || current_space_id == NO_ID || direction == NO_DIRECTION) {
+                return FALSE;
+        }
+        link = game_get_link_from_orig_direct(game, current_space_id, direction);
+        if (!link) return NO_ID;
+        return link_get_destination((const Link*)link);
+}
+
+Status game_add_link(Game* game, Link* link) {
+        Game_capacity needed = {0, 0, 0, 0, 0};
+        int index;
+        Id id_aux = NO_ID;
+        /*Error control*/
+        if (!game || !link) {
+                return ERROR;
+        }
+        id_aux = link_get_id(link);
+        index = game_get_link_index_from_id((const Game*)game, id_aux);
+        if (index == INVALID_INDEX) {
+                needed.n_links = game->n_links + 1;
+                if (game_reserve(game, &needed) == ERROR) return ERROR;
+                if (map_set(game->link_index, id_aux, game->n_links) == ERROR) return ERROR;
+                (game->links)[(game->n_links)++] = link;
+                game_hash_feature(&game->state_hash, HASH_LINK_OPEN, id_aux, link_get_open(link));
+                /*Links are never removed nor renamed, so the first one with a name keeps it*/
+                if (name_index_get(game->link_names, link_get_name(link)) == NO_ID) {
+                        name_index_set(game->link_names, link_get_name(link), id_aux, game->n_links - 1);
+                }
+                game_place_link(game, game->n_links - 1);
+        } else
+                return ERROR;
+        return OK;
+}
+
+Link* game_get_link_from_orig_direct(const Game* game, Id space_id, Direction direction) {
+        long index;
+        if (!game || space_id == NO_ID || direction < 0 || direction >= N_DIRECTIONS) {
+                return NULL;
+        }
+
+        index = map_get(game->space_index, space_id);
+        if (index == NO_ID) {
+                return NULL;
+        }
+
+        return game->adjacency[index][direction];
+}
+
+Status game_set_link_connection(Game* game, Id link_id, Id origin, Id destination, Direction direction) {
+        Link* link = NULL;
+        Id old_origin = NO_ID;
+        Direction old_direction = NO_DIRECTION;
+        int index;
+
+        if (!game) {
+                return ERROR;
+        }
+
+        index = game_get_link_index_from_id((const Game*)game, link_id);
+        if (index == INVALID_INDEX) {
+                return ERROR;
+        }
+        link = game->links[index];
+
+        old_origin = link_get_origin(link);
+        old_direction = link_get_direction(link);
+        if (game->orphan_next[index] != NOT_WAITING) {
+                game_unchain_link(game, index, old_origin);
+        }
+        if (link_set_origin(link, origin) == ERROR || link_set_destination(link, destination) == ERROR ||
+            link_set_direction(link, direction) == ERROR) {
+                return ERROR;
+        }
+
+        /*Both the slot it leaves and the one it takes may change owner*/
+        game_refresh_adjacency(game, old_origin, old_direction);
+        game_refresh_adjacency(game, origin, direction);
+        if (map_has(game->space_index, origin) == FALSE) {
+                game_place_link(game, index);
+        }
+
+        return OK;
+}
+
+Status game_set_link_open(Game* game, Id link_id, Bool open) {
+        int index;
+
+        if (!game) {
+                return ERROR;
+        }
+
+        index = game_get_link_index_from_id((const Game*)game, link_id);
+        if (index == INVALID_INDEX) {
+                return ERROR;
+        }
+
+        return game_change_link_open(game, game->links[index], open);
+}
+
+Id game_get_link(const Game* game, Id space_id, Direction direction) {
+        Link* link = NULL;
+
+        if (!game) {
+                return NO_ID;
+        }
+
+        link = game_get_link_from_orig_direct(game, space_id, direction);
+        if (!link) {
+                return NO_ID;
+        }
+
+        return link_get_id(link);
+}
+
+Link* game_get_link_from_name(const Game* game, char* name) {
+        int index;
+
+        if (!game || !name) {
+                return NULL;
+        }
+
+        index = game_get_link_index_from_id(game, name_index_get(game->link_names, name));
+        if (index == INVALID_INDEX) {
+                return NULL;
+        }
+
+        return game->links[index];
+}
+
+/*-----------------------------Other-----------------------------*/
+void game_get_info(const Game* game, char* info, int size) {
+        Text_builder tb;
+        Id loc = NO_ID, id_aux = NO_ID;
+        Command* command = NULL;
+        Space* space = NULL;
+        Object* object = NULL;
+        Set_iterator it;
+        int i;
+
+        if (!game || text_builder_init(&tb, info, size) == ERROR) {
+                return;
+        }
+
+        text_builder_append(&tb, "Objects:|");
+        for (i = 0; i < game->n_objects; i++) {
+                id_aux = object_get_id(game->objects[i]);
+                loc = game_get_object_location(game, id_aux);
+                if (loc != NO_ID) {
+                        space = game_get_space((const Game*)game, loc);
+                        if (!space) return;
+                        if (space_get_discovered(space) == TRUE) {
+                                text_builder_append(&tb, "   ");
+                                text_builder_append(&tb, object_get_name(game->objects[i]));
+                                text_builder_append(&tb, ":  ");
+                                text_builder_append_number(&tb, loc, 3);
+                                text_builder_append(&tb, "|");
+                        }
+                }
+        }
+        text_builder_append(&tb, "Characters:|");
+        for (i = 0; i < game->n_characters; i++) {
+                id_aux = character_get_id(game->characters[i]);
+                loc = game_get_character_location(game, id_aux);
+                space = game_get_space((const Game*)game, loc);
+                if (!space) return;
+                if (space_get_discovered(space) == TRUE) {
+                        text_builder_append(&tb, "   ");
+                        text_builder_append_padded(&tb, character_get_gdesc(game->characters[i]), -6);
+                        text_builder_append(&tb, ":  ");
+                        text_builder_append_number(&tb, loc, 3);
+                        text_builder_append(&tb, " (");
+                        text_builder_append_number(&tb, character_get_health(game->characters[i]), 0);
+                        text_builder_append(&tb, ")|");
+                }
+        }
+        text_builder_append(&tb, "Players   :|");
+        for (i = 0; i < game->n_players; i++) {
+                text_builder_append(&tb, " ");
+                text_builder_append_padded(&tb, player_get_gdesc(game->players[i]), 6);
+                text_builder_append(&tb, " ");
+                text_builder_append_number(&tb, player_get_location(game->players[i]), 3);
+                text_builder_append(&tb, " (");
+                text_builder_append_number(&tb, player_get_health(game->players[i]), 0);
+                text_builder_append(&tb, ")|");
+                if (i == game->player_indices[game->turn]) {
+                        text_builder_append(&tb, "          Inventory:|");
+                        set_iterator_init(&it, player_get_objects(game->players[i]));
+                        while (set_iterator_next(&it, &id_aux)) {
+                                if ((object = game_get_object_from_id(game, id_aux))) {
+                                        text_builder_append(&tb, "               ");
+                                        text_builder_append(&tb, object_get_name(object));
+                                        text_builder_append(&tb, "|");
+                                }
+                        }
+                }
+        }
+
+        command = game_get_last_command((const Game*)game);
+        if (!command) {
+                command_set_success(game_get_last_command((const Game*)game), ERROR);
+                return;
+        }
+
+        i = game_get_object_index_from_name(game, command_get_arg((const Command*)command));
+        if (command_get_code(command) == INSPECT && command_get_success(command) == OK && i != INVALID_INDEX) {
+                object = game->objects[i];
+                text_builder_append(&tb, "Inspection of the object ");
+                text_builder_append(&tb, object_get_name(object));
+                text_builder_append(&tb, " is: ");
+                text_builder_append(&tb, game_get_description_of_current_object(game, object_get_name(object)));
+        }
 
-        if (!game) return ERROR;
+        i = game_get_character_index_from_name(game, (char*)command_get_arg((const Command*)command));
+        if (command_get_code(command) == CHAT && command_get_success(command) == OK && i != INVALID_INDEX) {
+                text_builder_append(&tb, "Message: ");
+                text_builder_append(&tb, character_get_message(game->characters[i]));
+        }
+}
 
-        n_chararcters = game_get_n_characters_following_current_player(game);
+unsigned long game_get_space_signature(const Game* game, Id space_id) {
+        unsigned long signature = FNV_OFFSET;
+        Space* space = NULL;
+        Character* enemy = NULL;
+        Set_iterator it;
+        Id id_aux = NO_ID;
+        int i;
 
-        player_attacked = game_get_current_player((const Game*)game);
-        if (!player_attacked) {
-                return ERROR;
+        if (!game) {
+                return signature;
         }
 
-        if (n_chararcters == 0) {
-                number = 0;
-        } else {
-                number = rand() % n_chararcters + 1;
+        signature = game_signature_long(signature, space_id);
+        if (!(space = game_get_space(game, space_id))) {
+                return signature;
         }
 
-        if (number == 0) {
-                health = player_get_health(player_attacked);
-                player_set_health(player_attacked, --health);
-                if (health == 0) {
-                        game_exclude_player(game);
-                        if (game->num_alive_players == 0) game_set_finished(game, TRUE);
-                } else {
-                        game_pass_turn(game);
+        signature = game_signature_long(signature, space_get_discovered(space));
+        for (i = 0; i < GDESC_LINES; i++) {
+                signature = game_signature_string(signature, space_get_gdesc((const Space*)space, i));
+        }
+        set_iterator_init(&it, space_get_objects((const Space*)space));
+        while (set_iterator_next(&it, &id_aux)) {
+                signature = game_signature_string(signature, object_get_name(game_get_object_from_id(game, id_aux)));
+        }
+        if ((enemy = game_get_enemy_character_at_space(game, space_id))) {
+                signature = game_signature_string(signature, character_get_gdesc(enemy));
+        }
+        for (i = 0; i < game->n_players; i++) {
+                if (player_get_location(game->players[i]) == space_id && i != game->player_indices[game->turn]) {
+                        signature = game_signature_string(signature, player_get_gdesc(game->players[i]));
+                        signature = game_signature_long(signature, player_get_health(game->players[i]) == 0);
                 }
-        } else {
-                characters_following = game_get_characters_following_current_player((const Game*)game);
-                index_character_attacked = number;
+        }
 
-                character_attacked =
-                    game_get_character_from_id((const Game*)game, characters_following[index_character_attacked - 1]);
+        return signature;
+}
 
-                if (!character_attacked) {
-                        return ERROR;
-                }
+unsigned long game_get_info_signature(const Game* game) {
+        unsigned long signature = FNV_OFFSET;
+        Command* command = NULL;
 
-                character_health = character_get_health(character_attacked);
-                character_set_health(character_attacked, --character_health);
+        if (!game) {
+                return signature;
+        }
 
-                if (character_health == 0) {
-                        game_del_character(game, character_attacked);
-                } else {
-                        game_pass_turn(game);
-                }
+        /*Every change of the state counts, the last command tells what inspect and chat show*/
+        signature = game_signature_long(signature, game->n_changes);
+        command = game_get_last_command(game);
+        if (command) {
+                signature = game_signature_long(signature, command_get_code(command));
+                signature = game_signature_long(signature, command_get_success(command));
+                signature = game_signature_string(signature, command_get_arg(command));
         }
 
-        return OK;
+        return signature;
 }
 
-Status game_player_gets_attacked_by_use(Game* game, int new_health) {
-        if (!game) return ERROR;
-        player_set_health(game->players[game->player_indices[game->turn]], new_health);
-        if (new_health <= 0) {
-                game_exclude_player(game);
-                if (game->num_alive_players == 0) game_set_finished(game, TRUE);
-        } else {
-                game_pass_turn(game);
-        }
-        return OK;
-}
+unsigned long game_compute_info_signature(const Game* game) {
+        unsigned long signature = FNV_OFFSET;
+        Command* command = NULL;
+        Space* space = NULL;
+        Set_iterator it;
+        Id loc = NO_ID, id_aux = NO_ID;
+        int i;
 
-Status game_set_player_location(Game* game, Id id) {
-        /*Error control*/
         if (!game) {
-                return ERROR;
+                return signature;
         }
 
-        if (id == NO_ID) {
-                return ERROR;
+        /*Same data game_get_info reads, in the same order*/
+        for (i = 0; i < game->n_objects; i++) {
+                loc = game_get_object_location(game, object_get_id(game->objects[i]));
+                if (loc != NO_ID && (space = game_get_space(game, loc)) && space_get_discovered(space) == TRUE) {
+                        signature = game_signature_string(signature, object_get_name(game->objects[i]));
+                        signature = game_signature_long(signature, loc);
+                }
+        }
+        for (i = 0; i < game->n_characters; i++) {
+                loc = game_get_character_location(game, character_get_id(game->characters[i]));
+                if ((space = game_get_space(game, loc)) && space_get_discovered(space) == TRUE) {
+                        signature = game_signature_string(signature, character_get_gdesc(game->characters[i]));
+                        signature = game_signature_long(signature, loc);
+                        signature = game_signature_long(signature, character_get_health(game->characters[i]));
+                }
+        }
+        for (i = 0; i < game->n_players; i++) {
+                signature = game_signature_string(signature, player_get_gdesc(game->players[i]));
+                signature = game_signature_long(signature, player_get_location(game->players[i]));
+                signature = game_signature_long(signature, player_get_health(game->players[i]));
+                if (i == game->player_indices[game->turn]) {
+                        set_iterator_init(&it, player_get_objects(game->players[i]));
+                        while (set_iterator_next(&it, &id_aux)) {
+                                signature = game_signature_string(signature, object_get_name(game_get_object_from_id(game, id_aux)));
+                        }
+                }
+        }
+
+        command = game_get_last_command(game);
+        if (command && command_get_success(command) == OK &&
+            (command_get_code(command) == INSPECT || command_get_code(command) == CHAT)) {
+                signature = game_signature_long(signature, command_get_code(command));
+                signature = game_signature_string(signature, command_get_arg(command));
+                if (command_get_code(command) == INSPECT) {
+                        signature = game_signature_string(
+                            signature, game_get_description_of_current_object(game, command_get_arg(command)));
+                } else if ((i = game_get_character_index_from_name(game, (char*)command_get_arg(command))) >= 0) {
+                        signature = game_signature_string(signature, character_get_message(game->characters[i]));
+                }
         }
 
-        return player_set_location(game->players[game->turn], id);
+        return signature;
 }
 
-Id game_get_player_location(const Game* game) {
-        /*Error control*/
+void game_print(const Game* game) {
+        int i = 0;
+
         if (!game) {
-                return NO_ID;
+                return;
         }
 
-        return player_get_location(game->players[game->turn]);
-}
+        printf("\n\n-------------\n\n");
+        printf("=> Players: \n");
+        for (i = 0; i < game->n_players; i++) player_print(game->players[i]);
 
-Status game_set_player_damage(Player* player, int damage) {
-        if (!player || damage < 0) {
-                return ERROR;
+        printf("=> Objects: \n");
+        for (i = 0; i < game->n_objects; i++) {
+                object_print(game->objects[i]);
+                printf("\n");
+        }
+        printf("The number of objects is: %d\n", game->n_objects);
+        printf("\n");
+        printf("=> Characters: \n");
+        for (i = 0; i < game->n_characters; i++) {
+                character_print(game->characters[i]);
+                printf("\n");
+        }
+        printf("The number of characters is: %d\n", game->n_characters);
+        printf("\n");
+        printf("=> Spaces: \n");
+        for (i = 0; i < game->n_spaces; i++) {
+                space_print(game->spaces[i]);
         }
+        printf("The number of spaces is: %d\n", game->n_spaces);
+        printf("The finished status is: %d\n", game->finished);
+        command_print(game->last_cmd);
 
-        return player_set_damage(player, damage);
+        return;
 }
 
-Player* game_get_current_player(const Game* game) {
-        /*Error control*/
-        if (!game) {
-                return NULL;
+/**
+   Implementation of private functions
+*/
+
+const char* game_get_description_of_current_object(const Game* game, const char* name) {
+        Object* object = NULL;
+
+        if (!game || !name) {
+                return "";
         }
 
-        return game->players[game->turn];
-}
+        object = game_get_object_from_id(game, game_get_object_id_from_name(game, name));
 
-Player* game_get_last_player(const Game* game) {
-        Player* last_player = NULL;
-        int turn;
+        return object_get_description(object);
+}
 
+Id game_get_space_id_at(const Game* game, int position) {
         /*Error control*/
         if (!game) {
-                return NULL;
+                return NO_ID;
+        }
+        if (position < 0 || position >= game->n_spaces) {
+                return NO_ID;
         }
 
-        turn = game_get_current_turn(game);
+        return space_get_id(game->spaces[position]);
+}
 
-        last_player = (game->players[turn - 1 % game->num_alive_players]);
-        if (player_get_health(last_player) <= 0) {
-                return NULL;
+int game_get_object_index_from_name(const Game* game, const char* name) {
+        if (!game || !name) {
+                return INVALID_INDEX;
         }
 
-        return last_player;
+        return game_get_object_index_from_id(game, name_index_get(game->object_names, name));
 }
 
-Status game_add_player(Game* game, Player* player) {
-        Id id_aux = NO_ID;
-        int index;
-        /*Error control*/
-        if (!game || !player || (game->n_players == MAX_PLAYERS)) {
-                return ERROR;
-        }
-        id_aux = player_get_id(player);
-        index = game_get_player_index_from_id((const Game*)game, id_aux);
-        if (index == -1) {
-                game->players[game->n_players++] = player;
-                if (player_get_health(player) > 0) {
-                        game->player_indices[game->num_alive_players++] = game->n_players - 1;
-                }
-        } else
-                return ERROR;
-        return OK;
+/*The indexes store the position in the array, and NO_ID (same value as INVALID_INDEX) for missing ids*/
+int game_get_object_index_from_id(const Game* game, Id id) {
+        if (!game || id == NO_ID) return INVALID_INDEX;
+        return (int)map_get(game->object_index, id);
 }
 
-int game_get_player_health(const Game* game) {
-        if (!game) return -1;
-        return player_get_health(game_get_current_player(game));
+int game_get_character_index_from_id(const Game* game, Id id) {
+        if (!game || id == NO_ID) return INVALID_INDEX;
+        return (int)map_get(game->character_index, id);
 }
 
-Status game_set_player_new_health(Game* game, int new_health, Player* player) {
-        if (!game) return ERROR;
+int game_get_link_index_from_id(const Game* game, Id id) {
+        if (!game || id == NO_ID) return INVALID_INDEX;
+        return (int)map_get(game->link_index, id);
+}
 
-        player_set_health(player, new_health);
-        if (new_health <= 0) {
-                game_exclude_player(game);
-                if (game->num_alive_players == 0) game_set_finished(game, TRUE);
+int game_get_player_index_from_id(const Game* game, Id id) {
+        if (!game || id == NO_ID) {
+                return INVALID_INDEX;
         }
 
-        return OK;
+        return (int)map_get(game->player_index, id);
 }
 
-const char* game_get_player_name(const Game* game) {
-        if (!game) return NULL;
-        return player_get_name(game_get_current_player(game));
+void game_pass_turn(Game* game) {
+        if (!game) {
+                return;
+        }
+        if (game->num_alive_players > 0) {
+                game_change_turn(game, (game->turn + 1) % game->num_alive_players);
+        }
+        return;
 }
 
-Bool game_player_has_object(const Game* game, Id object) {
-        if (!game || object == NO_ID) {
-                return FALSE;
-        }
+void game_exclude_player(Game* game) {
+        game_change_alive_player(game, game->turn, INVALID_INDEX);
 
-        return player_has_object(game->players[game->turn], object);
+        if (game->turn >= game->num_alive_players && game->num_alive_players != 0) {
+                game_change_turn(game, game->turn - 1);
+        }
+        return;
 }
 
-Bool game_get_last_player_won_combat(const Game* game) {
+const char* game_get_current_player_gdesc(const Game* game) {
         if (!game) {
-                return FALSE;
+                return " ";
+        }
+        if (player_get_health(game->players[game->player_indices[game->turn]]) <= 0) {
+                return "   /+\\";
+        } else {
+                return player_get_gdesc(game->players[game->player_indices[game->turn]]);
         }
-
-        return game->combat_succeds;
 }
 
-Status game_set_last_player_won_combat(Game* game, Bool won) {
+int game_get_current_turn(const Game* game) {
         if (!game) {
-                return ERROR;
+                return INVALID_INDEX;
         }
-
-        game->combat_succeds = won;
-
-        return OK;
+        return game->player_indices[game->turn];
 }
 
-/*-----------------------------Manejo de Objects-----------------------------*/
-int game_get_n_objects(Game* game) {
+int game_get_n_alive_players(const Game* game) {
         if (!game) {
                 return -1;
         }
 
-        return game->n_objects;
+        return game->num_alive_players;
 }
 
-Object* game_get_object_from_index(Game* game, int index) {
-        if (!game || index < 0) {
+Player* game_get_player_in_turn(const Game* game, int offset) {
+        if (!game || offset < 0 || offset >= game->num_alive_players) {
                 return NULL;
         }
 
-        return game->objects[index];
+        return game->players[game->player_indices[(game->turn + offset) % game->num_alive_players]];
 }
 
-Object* game_get_object_from_id(const Game* game, Id id) {
-        int index;
+Status game_get_recent_log(const Game* game, char* line, int size) {
+        Text_builder tb;
+        Command* command = NULL;
 
-        if ((!game) || (id == NO_ID)) {
-                return NULL;
+        if (!game || text_builder_init(&tb, line, size) == ERROR) {
+                return ERROR;
+        }
+        command = game_get_last_command(game);
+        if (!command) {
+                return ERROR;
         }
-        index = game_get_object_index_from_id(game, id);
 
-        if (index != -1) return game->objects[index];
+        text_builder_append(&tb, command_get_string_code(command));
+        text_builder_append(&tb, " ");
+        text_builder_append(&tb, command_get_arg(command));
+        text_builder_append(&tb, ": ");
+        text_builder_append(&tb, command_get_success(command) == OK ? "OK" : "ERROR");
+        text_builder_append(&tb, " (");
+        text_builder_append(&tb, game_get_player_name(game));
+        text_builder_append(&tb, ")");
 
-        return NULL;
+        return text_builder_is_truncated(&tb) ? ERROR : OK;
+}
+
+void game_print_recent_log(const Game* game, FILE* f) {
+        char line[MAX_LOG_LINE];
+
+        if (!f || game_get_recent_log(game, line, MAX_LOG_LINE) == ERROR) {
+                return;
+        }
+
+        fprintf(f, "%s\n", line);
+}
+
+void game_get_players_row_at_space(const Game* game, Id id, char* first_row, char* second_row, int size) {
+        Text_builder rows[2];
+        const char* gdesc = NULL;
+        int i = 0, row, count;
+
+        if (!game || text_builder_init(&rows[0], first_row, size) == ERROR ||
+            text_builder_init(&rows[1], second_row, size) == ERROR) {
+                return;
+        }
+
+        /*Up to MAX_ROW_PLAYERS players in each row, the first row takes the first ones*/
+        for (row = 0; row < 2; row++) {
+                count = 0;
+                for (; id != NO_ID && i < game->n_players && (row == 1 || count < MAX_ROW_PLAYERS); i++) {
+                        if (player_get_location(game->players[i]) == id && i != game->player_indices[game->turn]) {
+                                gdesc = player_get_gdesc(game->players[i]);
+                                if (player_get_health(game->players[i]) == 0) {
+                                        gdesc = "/+\\";
+                                } else {
+                                        gdesc = strlen(gdesc) >= CUT_INDEX - 1 ? gdesc + CUT_INDEX - 1 : "";
+                                }
+                                text_builder_append_padded(&rows[row], gdesc, 3);
+                                text_builder_append(&rows[row], count < 3 ? "|" : "  ");
+                                count++;
+                        }
+                }
+                for (; count < MAX_ROW_PLAYERS; count++) {
+                        if (count < 3) {
+                                text_builder_append(&rows[row], id == NO_ID ? "    " : "   |");
+                        } else {
+                                text_builder_append(&rows[row], id == NO_ID || row == 1 ? "     " : "   | ");
+                        }
+                }
+        }
 }
 
-Status game_add_object(Game* game, Object* object) {
-        /*Just for inserting after reading*/
-        int index;
-        Id id_aux = NO_ID;
-        /*Error control*/
-        if (!game || !object || (game->n_objects == MAX_OBJECTS)) {
-                return ERROR;
-        }
-        id_aux = object_get_id(object);
-        if (id_aux == NO_ID) {
+Status game_set_deterministic_mode(Game* game, int deterministic) {
+        if (!game || !deterministic) {
                 return ERROR;
         }
+        game->deterministic = deterministic;
+        return OK;
+}
 
-        index = game_get_object_index_from_id((const Game*)game, id_aux);
-
-        if (index == -1) {
-                (game->objects)[game->n_objects] = object;
-                game->n_objects++;
-        } else {
+Status game_set_turn(Game* game, int turn) {
+        if (turn <= -1) {
                 return ERROR;
         }
+        game_change_turn(game, turn);
         return OK;
 }
 
-Id game_get_object_location(const Game* game, Id id) {
-        int i;
-        if (!game || id == NO_ID) {
-                return NO_ID;
+int game_get_turn(Game* game) { return game->turn; }
+
+int game_random(Game* game, int n) {
+        int number;
+
+        if (!game || n <= 0) {
+                return 0;
         }
 
-        for (i = 0; i < game->n_spaces; i++) {
-                if (space_has_object(game->spaces[i], id)) {
-                        return space_get_id(game->spaces[i]);
-                }
+        /*The generator advances even while replaying, so it goes on as it did when the turn was played*/
+        number = rng_next_int(&game->rng, n);
+        if (game->next_forced_draw < game->n_forced_draws) {
+                number = game->forced_draws[game->next_forced_draw++] % n;
         }
-        return NO_ID;
+        if (game->n_draws < MAX_DRAWS) {
+                game->draws[game->n_draws++] = number;
+        }
+
+        return number;
 }
 
-/*Just for first setting after creation*/
-Status game_set_object_location(Game* game, Id object_id, Id space_id) {
-        int i;
-        /*Error control*/
-        if (!game || object_id == NO_ID || space_id == NO_ID) {
+Status game_set_seed(Game* game, unsigned long seed) {
+        if (!game) {
                 return ERROR;
         }
-        for (i = 0; i < game->n_spaces; i++) {
-                if (space_id == space_get_id((const Space*)game->spaces[i])) {
-                        return space_add_object(game->spaces[i], object_id);
-                }
-        }
-        return ERROR;
+
+        return rng_seed(&game->rng, seed);
 }
 
-Id game_get_object_location_from_name(const Game* game, char* name) {
-        Id id_aux = NO_ID;
-        int index;
+Status game_get_random_state(const Game* game, unsigned long state[RNG_STATE_SIZE]) {
+        int i;
 
-        /*Error control*/
-        if (!game || !name) {
-                return NO_ID;
+        if (!game || !state) {
+                return ERROR;
         }
-        index = game_get_object_index_from_name(game, name);
-        if (index != -1)
-                id_aux = object_get_id(game->objects[index]);
-        else
-                return NO_ID;
 
-        return game_get_object_location(game, id_aux);
-}
+        for (i = 0; i < RNG_STATE_SIZE; i++) {
+                state[i] = game->rng.state[i];
+        }
 
-Id game_get_object_id_from_name(const Game* game, const char* name) {
-        int index;
-        if (!game || !name) return NO_ID;
-        index = game_get_object_index_from_name(game, (const char*)name);
-        if (index != -1) return object_get_id(game->objects[index]);
-        return NO_ID;
+        return OK;
 }
 
-int game_get_object_health_from_name(const Game* game, const char* name) {
-        int index;
-
-        if (!game || !name) {
-                return -1;
+Status game_set_random_state(Game* game, const unsigned long state[RNG_STATE_SIZE]) {
+        if (!game) {
+                return ERROR;
         }
 
-        index = game_get_object_index_from_name(game, name);
-
-        return object_get_health(game->objects[index]);
+        return rng_set_state(&game->rng, state);
 }
 
-Status game_object_destroy_from_name(Game* game, char* name) {
-        int index;
-        if (!game || !name) return -1;
-        index = game_get_object_index_from_name(game, name);
-        return object_destroy(game->objects[index]);
+Status game_get_state_hash(const Game* game, Game_hash* hash) {
+        if (!game || !hash) {
+                return ERROR;
+        }
+
+        *hash = game->state_hash;
+
+        return OK;
 }
 
-Id game_get_object_open_from_name(const Game* game, char* object_name) {
-        int i = 0;
+Status game_compute_state_hash(const Game* game, Game_hash* hash) {
+        int i;
 
-        if (!game || !object_name) {
-                return NO_ID;
+        if (!game || !hash) {
+                return ERROR;
         }
 
+        hash->high = 0;
+        hash->low = 0;
+        for (i = 0; i < game->n_players; i++) {
+                game_hash_player(hash, game->players[i]);
+        }
         for (i = 0; i < game->n_objects; i++) {
-                if (strcasecmp(object_name, object_get_name(game->objects[i]))) {
-                        return object_get_open(game->objects[i]);
-                }
+                game_hash_object(game, hash, game->objects[i]);
+        }
+        for (i = 0; i < game->n_characters; i++) {
+                game_hash_character(game, hash, game->characters[i]);
+        }
+        for (i = 0; i < game->n_links; i++) {
+                game_hash_feature(hash, HASH_LINK_OPEN, link_get_id(game->links[i]), link_get_open(game->links[i]));
         }
+        game_hash_feature(hash, HASH_TURN, NO_ID, game->turn);
 
-        return NO_ID;
+        return OK;
 }
 
-/*-----------------------------Manejo de Characters-----------------------------*/
+void game_reset_draws(Game* game) {
+        if (game) {
+                game->n_draws = 0;
+        }
+}
 
-int game_get_n_characters(const Game* game) {
+int game_get_n_draws(const Game* game) {
         if (!game) {
                 return -1;
         }
 
-        return game->n_characters;
+        return game->n_draws;
 }
 
-Character* game_get_character_from_index(const Game* game, int index) {
-        if (!game || index < 0) {
+const int* game_get_draws(const Game* game) {
+        if (!game) {
                 return NULL;
         }
 
-        return game->characters[index];
+        return game->draws;
 }
 
-Character* game_get_character_from_id(const Game* game, Id character_id) {
-        int i = 0;
-
-        if (!game || character_id == NO_ID) {
-                return NULL;
+Status game_set_forced_draws(Game* game, const int* draws, int n_draws) {
+        if (!game || n_draws < 0 || n_draws > MAX_DRAWS || (n_draws > 0 && !draws)) {
+                return ERROR;
         }
 
-        for (i = 0; i < game->n_characters; i++) {
-                if (character_id == character_get_id(game->characters[i])) {
-                        return game->characters[i];
-                }
+        if (n_draws > 0) {
+                memcpy(game->forced_draws, draws, n_draws * sizeof(int));
         }
+        game->n_forced_draws = n_draws;
+        game->next_forced_draw = 0;
 
-        return NULL;
+        return OK;
 }
 
-Status game_set_character_location(Game* game, Id loc, Id character_id) {
-        if (!game || loc == NO_ID || character_id == NO_ID) {
+Status game_begin_turn(Game* game) {
+        if (!game) {
                 return ERROR;
         }
 
-        space_del_character(game_get_space((const Game*)game, loc), game_get_character_location((const Game*)game, character_id));
-        return space_add_character(game_get_space((const Game*)game, loc), character_id);
-}
-
-Id game_get_character_location(const Game* game, Id character_id) {
-        int i = 0;
-
-        if (!game || character_id == NO_ID) {
-                return NO_ID;
-        }
-
-        for (i = 0; i < game->n_spaces; i++) {
-                if (space_has_character(game->spaces[i], character_id) == TRUE) {
-                        return space_get_id(game->spaces[i]);
+        game_commit_turn(game);
+        if (!game->recording) {
+                game->recording = (Game_turn*)calloc(1, sizeof(Game_turn));
+                if (!game->recording) {
+                        return ERROR;
                 }
         }
+        game->recording->rng = game->rng;
 
-        return NO_ID;
+        return OK;
 }
 
-int game_get_n_characters_following_current_player(const Game* game) {
-        int i = 0;
-        int number = 0;
+Status game_rollback_turn(Game* game) {
+        Game_turn* turn = NULL;
+
         if (!game) {
-                return -1;
+                return ERROR;
         }
 
-        for (i = 0; i < game->n_characters; i++) {
-                if (character_get_following(game->characters[i]) == player_get_id(game_get_current_player(game))) {
-                        number++;
-                }
+        turn = game->recording;
+        if (!turn) {
+                return OK;
         }
 
-        return number;
+        /*The random numbers drawn stay drawn, a replay draws them too before failing the same way*/
+        while (turn->n_changes > 0) {
+                turn->n_changes--;
+                game_apply_change(game, &turn->changes[turn->n_changes]);
+                game_free_change(&turn->changes[turn->n_changes]);
+        }
+
+        return OK;
 }
 
-Id* game_get_characters_following_current_player(const Game* game) {
-        Id* ids;
-        int n_followers;
-        int total_chars;
+Status game_undo(Game* game) {
+        Game_turn* turn = NULL;
+        Rng rng;
         int i;
-        int j;
-        Player* me;
-        Id my_id;
-        Character* c;
-
-        if (!game) return NULL;
 
-        n_followers = game_get_n_characters_following_current_player(game);
-        if (n_followers <= 0) return NULL;
-
-        ids = (Id*)malloc(n_followers * sizeof(Id));
-        if (!ids) return NULL;
+        if (!game) {
+                return ERROR;
+        }
 
-        me = game_get_current_player(game);
-        my_id = player_get_id(me);
-        total_chars = game_get_n_characters(game);
-        j = 0;
+        game_commit_turn(game);
+        if (game->n_undo == 0) {
+                return ERROR;
+        }
+        game->n_undo--;
+        turn = game->undo[(game->first_undo + game->n_undo) % GAME_MAX_UNDO];
 
-        for (i = 0; i < total_chars; i++) {
-                c = game_get_character_from_index(game, i);
-                if (c && character_get_following(c) == my_id) ids[j++] = character_get_id(c);
+        for (i = turn->n_changes - 1; i >= 0; i--) {
+                game_apply_change(game, &turn->changes[i]);
         }
+        rng = game->rng;
+        game->rng = turn->rng;
+        turn->rng = rng;
+        game->redo[game->n_redo++] = turn;
 
-        return ids;
+        return OK;
 }
 
-Status game_character_gets_attacked(Game* game, Id character_id) {
-        int health, index, damage = 0;
-        int i = 0;
+Status game_redo(Game* game) {
+        Game_turn* turn = NULL;
+        Rng rng;
+        int i;
 
-        if (!game || character_id == NO_ID) {
+        if (!game) {
                 return ERROR;
         }
 
-        damage = player_get_damage(game_get_current_player((const Game*)game));
-        for (i = 0; i < game->n_characters; i++) {
-                if ((game_get_character_location(game, character_get_id(game->characters[i])) ==
-                     game_get_player_location(game)) &&
-                    (character_id == character_get_id(game->characters[i]))) {
-                        index = game_get_character_index_from_id(game, character_id);
-                }
+        game_commit_turn(game);
+        if (game->n_redo == 0) {
+                return ERROR;
         }
+        turn = game->redo[--game->n_redo];
 
-        if (index != -1) {
-                health = character_get_health((const Character*)game->characters[index]);
+        for (i = 0; i < turn->n_changes; i++) {
+                game_apply_change(game, &turn->changes[i]);
+        }
+        rng = game->rng;
+        game->rng = turn->rng;
+        turn->rng = rng;
+        game_push_undo(game, turn);
 
-                damage = damage + game_get_n_characters_following_current_player((const Game*)game);
+        return OK;
+}
 
-                if (health > 0) {
-                        game_pass_turn(game);
-                        return character_set_health(game->characters[index], health - damage);
-                } else
-                        return ERROR;
+void game_forget_history(Game* game) {
+        if (!game) {
+                return;
         }
-        return ERROR;
-}
 
-Status game_character_gets_attacked_by_use(Game* game, int new_health, char* character_name) {
-        int index;
-        Character* character = NULL;
+        game_clear_redo(game);
+        while (game->n_undo > 0) {
+                game->n_undo--;
+                game_turn_destroy(game->undo[(game->first_undo + game->n_undo) % GAME_MAX_UNDO]);
+        }
+        game->first_undo = 0;
+        game_turn_destroy(game->recording);
+        game->recording = NULL;
+}
 
-        if (!game) {
+Status game_set_rule_value(Game* game, int* value, int new_value) {
+        if (!game || !value) {
                 return ERROR;
         }
 
-        character = game_get_character_from_name(game, character_name);
-        if (!character) {
+        if (game_record_change(game, CHANGE_RULE_VALUE, value, NO_ID, INVALID_INDEX, *value) == ERROR) {
                 return ERROR;
         }
+        *value = new_value;
 
-        index = game_get_character_index_from_id((const Game*)game, character_get_id(character));
-        if (index != -1) {
-                if (new_health > 0) {
-                        game_pass_turn(game);
-                        return character_set_health(game->characters[index], new_health);
-                } else /*Habrá que matar al character, no?*/
-                        return ERROR;
-        }
-        return ERROR;
+        return OK;
 }
 
-Status game_add_character(Game* game, Character* character) {
-        int index;
-        Id id_aux = NO_ID;
-        /*Error control*/
-        if (!game || !character || (game->n_characters == MAX_CHARACTERS)) {
+Status game_set_rule_flag(Game* game, Bool* flag, Bool new_flag) {
+        if (!game || !flag) {
                 return ERROR;
         }
-        id_aux = character_get_id(character);
-        index = game_get_character_index_from_id((const Game*)game, id_aux);
-        if (index == -1)
-                (game->characters)[(game->n_characters)++] = character;
-        else
-                return ERROR;
-        return OK;
-}
 
-Status game_del_character(Game* game, Character* character) {
-        if (!game || !character) {
+        if (game_record_change(game, CHANGE_RULE_FLAG, flag, NO_ID, INVALID_INDEX, *flag) == ERROR) {
                 return ERROR;
         }
+        *flag = new_flag;
 
-        return character_destroy(character);
+        return OK;
 }
 
-Bool game_get_character_is_alive(const Game* game, Id character_id) {
-        int health;
-        int index = 0;
+Status game_write_snapshot(const Game* game, FILE* f) {
+        Space* space = NULL;
+        Link* link = NULL;
+        Object* object = NULL;
+        Character* character = NULL;
+        Player* player = NULL;
+        char command[WORD_SIZE];
+        int i, j;
 
-        if (!game) {
-                return FALSE;
+        if (!game || !f) {
+                return ERROR;
         }
 
-        index = game_get_character_index_from_id(game, character_id);
+        fwrite(SNAPSHOT_MAGIC, 1, SNAPSHOT_MAGIC_SIZE, f);
+        game_snapshot_write_long(f, SNAPSHOT_VERSION);
+        game_snapshot_write_long(f, (long)sizeof(long));
+        game_snapshot_write_long(f, game->n_spaces);
+        game_snapshot_write_long(f, game->n_links);
+        game_snapshot_write_long(f, game->n_objects);
+        game_snapshot_write_long(f, game->n_characters);
+        game_snapshot_write_long(f, game->n_players);
 
-        health = character_get_health(game->characters[index]);
-        if (health <= 0) {
-                return FALSE;
-        } else {
-                return TRUE;
+        /*Each kind of entity in the order of its array, the objects and characters with the order they were added in,
+          so the names resolve to the same entities*/
+        for (i = 0; i < game->n_spaces; i++) {
+                space = game->spaces[i];
+                game_snapshot_write_long(f, space_get_id(space));
+                game_snapshot_write_string(f, space_get_name(space));
+                game_snapshot_write_long(f, space_get_discovered(space));
+                for (j = 0; j < GDESC_LINES; j++) {
+                        game_snapshot_write_string(f, space_get_stored_gdesc(space, j));
+                }
         }
-}
-
-Character* game_get_enemy_character_at_space(const Game* game, Id location) {
-        int i = 0;
-        if (!game || location == NO_ID) {
-                return NULL;
+        for (i = 0; i < game->n_links; i++) {
+                link = game->links[i];
+                game_snapshot_write_long(f, link_get_id(link));
+                game_snapshot_write_string(f, link_get_name(link));
+                game_snapshot_write_long(f, link_get_origin(link));
+                game_snapshot_write_long(f, link_get_destination(link));
+                game_snapshot_write_long(f, link_get_direction(link));
+                game_snapshot_write_long(f, link_get_open(link));
+        }
+        for (i = 0; i < game->n_objects; i++) {
+                object = game->objects[i];
+                game_snapshot_write_long(f, object_get_id(object));
+                game_snapshot_write_string(f, object_get_name(object));
+                game_snapshot_write_string(f, object_get_description(object));
+                game_snapshot_write_long(f, object_get_health(object));
+                game_snapshot_write_long(f, object_get_movable(object));
+                game_snapshot_write_long(f, object_get_dependency(object));
+                game_snapshot_write_long(f, object_get_open(object));
+                game_snapshot_write_long(f, map_get(game->object_orders, object_get_id(object)));
         }
-
         for (i = 0; i < game->n_characters; i++) {
-                if (game_get_character_location(game, character_get_id(game->characters[i])) == location &&
-                    character_get_friendly(game->characters[i]) == FALSE && character_get_health(game->characters[i]) > 0) {
-                        return game->characters[i];
-                }
+                character = game->characters[i];
+                game_snapshot_write_long(f, character_get_id(character));
+                game_snapshot_write_string(f, character_get_name(character));
+                game_snapshot_write_long(f, character_get_friendly(character));
+                game_snapshot_write_long(f, character_get_health(character));
+                game_snapshot_write_long(f, character_get_following(character));
+                game_snapshot_write_string(f, character_get_gdesc(character));
+                game_snapshot_write_string(f, character_get_message(character));
+                game_snapshot_write_long(f, map_get(game->character_orders, character_get_id(character)));
+        }
+        for (i = 0; i < game->n_players; i++) {
+                player = game->players[i];
+                game_snapshot_write_long(f, player_get_id(player));
+                game_snapshot_write_string(f, player_get_name(player));
+                game_snapshot_write_string(f, player_get_gdesc(player));
+                game_snapshot_write_long(f, player_get_location(player));
+                game_snapshot_write_long(f, player_get_health(player));
+                game_snapshot_write_long(f, player_get_damage(player));
+                game_snapshot_write_long(f, player_get_backpack_size(player));
+                game_snapshot_write_set(f, player_get_objects(player));
+                game_snapshot_write_set(f, player_get_followers(player));
+        }
+
+        /*The sets of each space keep the order in which their objects and characters arrived*/
+        for (i = 0; i < game->n_spaces; i++) {
+                game_snapshot_write_set(f, space_get_objects(game->spaces[i]));
+                game_snapshot_write_set(f, space_get_characters(game->spaces[i]));
         }
 
-        return NULL;
+        game_snapshot_write_long(f, game->num_alive_players);
+        for (i = 0; i < game->num_alive_players; i++) {
+                game_snapshot_write_long(f, game->player_indices[i]);
+        }
+        game_snapshot_write_long(f, game->turn);
+        game_snapshot_write_long(f, game->finished);
+        game_snapshot_write_long(f, game->deterministic);
+        game_snapshot_write_long(f, game->combat_succeds);
+        for (i = 0; i < RNG_STATE_SIZE; i++) {
+                game_snapshot_write_long(f, (long)game->rng.state[i]);
+        }
+        game_snapshot_write_long(f, command_get_code(game->last_cmd));
+        sprintf(command, "%.*s %.*s", WORD_SIZE / 2 - 1, command_get_string_code(game->last_cmd), WORD_SIZE / 2 - 1,
+                command_get_arg(game->last_cmd));
+        game_snapshot_write_string(f, command);
+        game_snapshot_write_long(f, command_get_success(game->last_cmd));
+
+        return ferror(f) ? ERROR : OK;
 }
 
-int game_get_character_index_from_name(const Game* game, char* name) {
+Status game_read_snapshot(Game** game, FILE* f) {
+        Game_capacity counts;
+        char magic[SNAPSHOT_MAGIC_SIZE];
+        long version, long_size, n[5];
         int i;
-        if (!game || !name) {
-                return INVALID_INDEX;
+
+        if (!game || !f) {
+                return ERROR;
         }
+        *game = NULL;
 
-        for (i = 0; i < game->n_characters; i++) {
-                if (strcasecmp(character_get_name(game->characters[i]), name) == 0) return i;
+        if (fread(magic, 1, SNAPSHOT_MAGIC_SIZE, f) != SNAPSHOT_MAGIC_SIZE ||
+            memcmp(magic, SNAPSHOT_MAGIC, SNAPSHOT_MAGIC_SIZE) != 0 || game_snapshot_read_long(f, &version) == ERROR ||
+            game_snapshot_read_long(f, &long_size) == ERROR || version != SNAPSHOT_VERSION ||
+            long_size != (long)sizeof(long)) {
+                return ERROR;
         }
-        return INVALID_INDEX;
-}
+        for (i = 0; i < 5; i++) {
+                if (game_snapshot_read_long(f, &n[i]) == ERROR || n[i] < 0 || n[i] > INT_MAX) return ERROR;
+        }
+        counts.n_spaces = (int)n[0];
+        counts.n_links = (int)n[1];
+        counts.n_objects = (int)n[2];
+        counts.n_characters = (int)n[3];
+        counts.n_players = (int)n[4];
 
-Status game_set_character_new_health(const Game* game, int new_health, char* name) {
-        if (!game || !new_health) return ERROR;
-        return character_set_health(game->characters[game_get_character_index_from_name(game, name)], new_health);
+        if (game_create(game, &counts) == ERROR) {
+                return ERROR;
+        }
+        if (game_snapshot_read_world(*game, f, &counts) == ERROR ||
+            game_snapshot_read_players(*game, f, counts.n_players) == ERROR ||
+            game_snapshot_read_state(*game, f) == ERROR) {
+                game_destroy(*game);
+                *game = NULL;
+                return ERROR;
+        }
+
+        return game_refresh_state_hash(*game);
 }
 
-int game_get_character_health_from_name(const Game* game, char* name) {
-        if (!game || !name) return -1;
-        return character_get_health(game->characters[game_get_character_index_from_name(game, name)]);
+Status game_game_management_save(Game* game, char* filename) {
+        if (!game || filename == NULL) {
+                return ERROR;
+        }
+        return game_management_save(&game, filename);
 }
 
-Character* game_get_character_from_name(Game* game, char* name) {
-        int i = 0;
-        if (!game || !name) {
-                return NULL;
+Status game_game_management_load(Game* game, char* filename) {
+        Game* loaded = NULL;
+        Game swap;
+        Command* command = NULL;
+
+        if (!game || filename == NULL) {
+                return ERROR;
         }
 
-        for (i = 0; i < game->n_characters; i++) {
-                if (strcasecmp(name, character_get_name(game->characters[i])) == 0) {
-                        return game->characters[i];
-                }
+        /*The saved values are written into a copy, so the game stays as it was if the file cannot be read*/
+        if (game_clone((const Game*)game, &loaded) == ERROR) {
+                return ERROR;
+        }
+        if (game_management_load(&loaded, filename) == ERROR || game_refresh_state_hash(loaded) == ERROR) {
+                game_destroy(loaded);
+                return ERROR;
         }
 
-        return NULL;
+        /*The saved values were not recorded, so the turns before cannot be undone*/
+        game_forget_history(game);
+
+        /*The game takes the contents of the copy but keeps its own command, which the callers hold*/
+        swap = *game;
+        *game = *loaded;
+        *loaded = swap;
+        command = game->last_cmd;
+        game->last_cmd = loaded->last_cmd;
+        loaded->last_cmd = command;
+        game_destroy(loaded);
+
+        return OK;
 }
 
-/*-----------------------------Manejo de Spaces-----------------------------*/
-int game_get_n_spaces(Game* game) {
-        if (!game) {
-                return -1;
+Status game_add_object_in_order(Game* game, Object* object, long order) {
+        Id id = NO_ID;
+
+        if (!object || (id = object_get_id(object)) == NO_ID || game_get_object_index_from_id((const Game*)game, id) != INVALID_INDEX ||
+            map_set(game->object_orders, id, order) == ERROR) {
+                return ERROR;
+        }
+        if (order >= game->n_orders) {
+                game->n_orders = order + 1;
         }
 
-        return game->n_spaces;
+        return game_change_object_presence(game, object, game->n_objects, TRUE);
 }
 
-Space* game_get_space_from_index(Game* game, int index) {
-        if (!game || index < 0) {
-                return NULL;
+Status game_add_character_in_order(Game* game, Character* character, long order) {
+        Id id = NO_ID;
+
+        if (!character || (id = character_get_id(character)) == NO_ID || game_get_character_index_from_id((const Game*)game, id) != INVALID_INDEX ||
+            map_set(game->character_orders, id, order) == ERROR) {
+                return ERROR;
+        }
+        if (order >= game->n_orders) {
+                game->n_orders = order + 1;
         }
 
-        return game->spaces[index];
+        return game_change_character_presence(game, character, game->n_characters, TRUE);
 }
 
-void game_get_object_list_at_space(const Game* game, Id space_id, char* list) {
-        int num_elems, i;
-        Space* space = NULL;
-        char dummy[DUMMY_SIZE];
-        Id id_aux = NO_ID;
-        if (!game || space_id == NO_ID) return;
+void game_index_object_name(Game* game, int index) {
+        Id id = object_get_id(game->objects[index]);
 
-        space = game_get_space(game, space_id);
-        if (space_get_discovered(space) == TRUE) {
-                if (!space) return;
-                num_elems = space_get_num_objects((const Space*)space);
-                if (num_elems > 0)
-                        list[0] = '\0';
-                else
-                        return;
-                for (i = 0; i < num_elems; i++) {
-                        id_aux = space_get_id_at_index((const Space*)space, i);
-                        game_get_object_name_by_id(game, id_aux, dummy);
-                        dummy[CUT_INDEX - 1] = ' ';
-                        dummy[CUT_INDEX] = '\0';
-                        strcat(list, dummy);
-                }
-                list[strlen(list) - 1] = '\0';
-                return;
-        }
-        return;
+        /*The order stays with the id while the object is out of the game, so it owns the same names when it is back*/
+        name_index_set(game->object_names, object_get_name(game->objects[index]), id, map_get(game->object_orders, id));
 }
 
-Space* game_get_space(const Game* game, Id id) {
-        int i = 0;
-        /*Error control*/
-        if (!game || id == NO_ID) {
-                return NULL;
-        }
+void game_unindex_object_name(Game* game, int index) {
+        name_index_del(game->object_names, object_get_name(game->objects[index]), object_get_id(game->objects[index]));
+}
 
-        for (i = 0; i < game->n_spaces; i++) {
-                if (id == space_get_id(game->spaces[i])) {
-                        return game->spaces[i];
-                }
-        }
+void game_index_character_name(Game* game, int index) {
+        Id id = character_get_id(game->characters[index]);
 
-        return NULL;
+        name_index_set(game->character_names, character_get_name(game->characters[index]), id,
+                       map_get(game->character_orders, id));
 }
 
-Status game_add_space(Game* game, Space* space) {
+void game_unindex_character_name(Game* game, int index) {
+        name_index_del(game->character_names, character_get_name(game->characters[index]),
+                       character_get_id(game->characters[index]));
+}
+
+void game_refresh_adjacency(Game* game, Id space_id, Direction direction) {
+        long index;
         int i;
-        Id id_aux = NO_ID;
-        /*Error control*/
-        if (!game || !space || (game->n_spaces == MAX_SPACES)) {
-                return ERROR;
+
+        if (space_id == NO_ID || direction < 0 || direction >= N_DIRECTIONS) {
+                return;
         }
-        id_aux = space_get_id(space);
-        for (i = 0; i < game->n_spaces; i++) {
-                if (space_get_id(game->spaces[i]) == id_aux) return OK;
+        index = map_get(game->space_index, space_id);
+        if (index == NO_ID) {
+                return;
         }
-        (game->spaces)[(game->n_spaces)++] = space;
 
-        return OK;
+        /*If several links leave the same way, the first one loaded is used*/
+        game->adjacency[index][direction] = NULL;
+        for (i = 0; i < game->n_links; i++) {
+                if (link_get_origin(game->links[i]) == space_id && link_get_direction(game->links[i]) == direction) {
+                        game->adjacency[index][direction] = game->links[i];
+                        return;
+                }
+        }
 }
 
-/*-----------------------------Manejo de Commands-----------------------------*/
-Command* game_get_last_command(const Game* game) {
-        /*Error control*/
-        if (!game) {
-                return NULL;
+void game_place_link(Game* game, int index) {
+        Link* link = game->links[index];
+        Direction direction = link_get_direction(link);
+        Id origin = link_get_origin(link);
+        long slot;
+
+        game->orphan_next[index] = NOT_WAITING;
+        if (direction < 0 || direction >= N_DIRECTIONS) {
+                return;
+        }
+        slot = map_get(game->space_index, origin);
+        if (slot != NO_ID) {
+                if (game->adjacency[slot][direction] == NULL) {
+                        game->adjacency[slot][direction] = link;
+                }
+                return;
         }
 
-        return game->last_cmd;
+        /*Its origin is not loaded yet*/
+        if (origin != NO_ID) {
+                game->orphan_next[index] =
+                    map_has(game->orphan_links, origin) == TRUE ? (int)map_get(game->orphan_links, origin) : INVALID_INDEX;
+                if (map_set(game->orphan_links, origin, index) == ERROR) {
+                        game->orphan_next[index] = NOT_WAITING;
+                }
+        }
 }
 
-Status game_set_last_command(Game* game, Command* command) {
-        /*Error control*/
-        if (!game) {
-                return ERROR;
-        }
+void game_unchain_link(Game* game, int index, Id origin) {
+        int current;
 
-        game->last_cmd = command;
+        current = (int)map_get(game->orphan_links, origin);
+        if (current == index) {
+                if (game->orphan_next[index] == INVALID_INDEX) {
+                        map_del(game->orphan_links, origin);
+                } else {
+                        map_set(game->orphan_links, origin, game->orphan_next[index]);
+                }
+        } else {
+                while (current != INVALID_INDEX && game->orphan_next[current] != index) {
+                        current = game->orphan_next[current];
+                }
+                if (current != INVALID_INDEX) {
+                        game->orphan_next[current] = game->orphan_next[index];
+                }
+        }
+        game->orphan_next[index] = NOT_WAITING;
+}
+
+Status game_reserve(Game* game, const Game_capacity* capacity) {
+        void* array = NULL;
+        int n;
+
+        /*Each array only changes its capacity once all its memory has been reserved, the indexes of each kind of
+         entity are sized with it so they do not have to rehash while the world is loaded*/
+        if (capacity->n_spaces > game->capacity.n_spaces) {
+                n = game_grown_capacity(game->capacity.n_spaces, capacity->n_spaces);
+                if (!(array = realloc(game->spaces, n * sizeof(Space*)))) return ERROR;
+                game->spaces = (Space**)array;
+                if (!(array = realloc(game->adjacency, n * sizeof(*game->adjacency)))) return ERROR;
+                game->adjacency = (Link*(*)[N_DIRECTIONS])array;
+                if (map_reserve(game->space_index, n) == ERROR) return ERROR;
+                game->capacity.n_spaces = n;
+        }
+        if (capacity->n_objects > game->capacity.n_objects) {
+                n = game_grown_capacity(game->capacity.n_objects, capacity->n_objects);
+                if (!(array = realloc(game->objects, n * sizeof(Object*)))) return ERROR;
+                game->objects = (Object**)array;
+                if (map_reserve(game->object_index, n) == ERROR || map_reserve(game->object_locations, n) == ERROR ||
+                    map_reserve(game->object_orders, n) == ERROR || name_index_reserve(game->object_names, n) == ERROR) {
+                        return ERROR;
+                }
+                game->capacity.n_objects = n;
+        }
+        if (capacity->n_characters > game->capacity.n_characters) {
+                n = game_grown_capacity(game->capacity.n_characters, capacity->n_characters);
+                if (!(array = realloc(game->characters, n * sizeof(Character*)))) return ERROR;
+                game->characters = (Character**)array;
+                if (map_reserve(game->character_index, n) == ERROR || map_reserve(game->character_locations, n) == ERROR ||
+                    map_reserve(game->character_orders, n) == ERROR ||
+                    name_index_reserve(game->character_names, n) == ERROR) {
+                        return ERROR;
+                }
+                game->capacity.n_characters = n;
+        }
+        if (capacity->n_links > game->capacity.n_links) {
+                n = game_grown_capacity(game->capacity.n_links, capacity->n_links);
+                if (!(array = realloc(game->links, n * sizeof(Link*)))) return ERROR;
+                game->links = (Link**)array;
+                if (!(array = realloc(game->orphan_next, n * sizeof(int)))) return ERROR;
+                game->orphan_next = (int*)array;
+                if (map_reserve(game->link_index, n) == ERROR || name_index_reserve(game->link_names, n) == ERROR) {
+                        return ERROR;
+                }
+                game->capacity.n_links = n;
+        }
+        if (capacity->n_players > game->capacity.n_players) {
+                n = game_grown_capacity(game->capacity.n_players, capacity->n_players);
+                if (!(array = realloc(game->players, n * sizeof(Player*)))) return ERROR;
+                game->players = (Player**)array;
+                if (!(array = realloc(game->player_indices, n * sizeof(int)))) return ERROR;
+                game->player_indices = (int*)array;
+                if (map_reserve(game->player_index, n) == ERROR) return ERROR;
+                game->capacity.n_players = n;
+        }
 
         return OK;
 }
 
-Bool game_get_finished(const Game* game) {
-        /*Error control*/
-        if (!game) {
-                return TRUE;
-        }
+int game_grown_capacity(int current, int needed) {
+        int capacity = current < MIN_CAPACITY / 2 ? MIN_CAPACITY : 2 * current;
 
-        return game->finished;
+        return capacity < needed ? needed : capacity;
 }
 
-Status game_set_finished(Game* game, Bool finished) {
-        /*Error control*/
-        if (!game) {
-                return ERROR;
+unsigned long game_signature_long(unsigned long signature, long value) {
+        int i;
+
+        for (i = 0; i < 4; i++) {
+                signature ^= (unsigned long)((value >> (8 * i)) & 0xFF);
+                signature = (signature * FNV_PRIME) & 0xFFFFFFFFUL;
         }
-        game->finished = finished;
 
-        return OK;
+        return signature;
 }
 
-/*-----------------------------Manejo de Links-----------------------------*/
-int game_get_n_links(Game* game) {
-        if (!game) {
-                return -1;
+unsigned long game_signature_string(unsigned long signature, const char* str) {
+        if (str) {
+                for (; *str; str++) {
+                        signature ^= (unsigned char)*str;
+                        signature = (signature * FNV_PRIME) & 0xFFFFFFFFUL;
+                }
         }
 
-        return game->n_links;
+        /*The terminator keeps "ab" + "c" apart from "a" + "bc"*/
+        signature = (signature * FNV_PRIME) & 0xFFFFFFFFUL;
+
+        return signature;
 }
 
-Link* game_get_link_from_index(Game* game, int index) {
-        if (!game || index < 0) {
-                return NULL;
-        }
+void game_snapshot_write_long(FILE* f, long value) { fwrite(&value, sizeof(long), 1, f); }
 
-        return game->links[index];
-}
+void game_snapshot_write_string(FILE* f, const char* str) {
+        long length = str ? (long)strlen(str) : 0;
 
-Bool game_connection_is_open(const Game* game, Id current_space_id, Direction direction) {
-        int index;
-        if (!game || current_space_id == NO_ID || direction == NO_DIRECTION) {
-                return FALSE;
+        game_snapshot_write_long(f, length);
+        if (length > 0) {
+                fwrite(str, 1, length, f);
         }
-
-        index = game_get_link_index_from_orig_direct(game, current_space_id, direction);
-        if (index == INVALID_INDEX) return FALSE;
-        return link_get_open((const Link*)game->links[index]);
 }
 
-Id game_get_connection(const Game* game, Id current_space_id, Direction direction) {
-        int index = INVALID_INDEX;
-        if (!game || current_space_id == NO_ID || direction == NO_DIRECTION) {
-                return FALSE;
+void game_snapshot_write_set(FILE* f, const Set* set) {
+        Set_iterator it;
+        Id id;
+
+        game_snapshot_write_long(f, set ? set_get_nIds(set) : 0);
+        set_iterator_init(&it, set);
+        while (set_iterator_next(&it, &id) == TRUE) {
+                game_snapshot_write_long(f, id);
         }
-        index = game_get_link_index_from_orig_direct(game, current_space_id, direction);
-        if (index == INVALID_INDEX) return NO_ID;
-        return link_get_destination((const Link*)game->links[index]);
 }
 
-Status game_add_link(Game* game, Link* link) {
-        int index;
-        Id id_aux = NO_ID;
-        /*Error control*/
-        if (!game || !link || (game->n_links == MAX_LINKS)) {
+Status game_snapshot_read_long(FILE* f, long* value) { return fread(value, sizeof(long), 1, f) == 1 ? OK : ERROR; }
+
+Status game_snapshot_read_string(FILE* f, char* str, int size) {
+        long length;
+
+        if (game_snapshot_read_long(f, &length) == ERROR || length < 0 || length >= size ||
+            fread(str, 1, length, f) != (size_t)length) {
                 return ERROR;
         }
-        id_aux = link_get_id(link);
-        index = game_get_link_index_from_id((const Game*)game, id_aux);
-        if (index == INVALID_INDEX)
-                (game->links)[(game->n_links)++] = link;
-        else
-                return ERROR;
+        str[length] = '\0';
+
         return OK;
 }
 
-int game_get_link_index_from_orig_direct(const Game* game, Id space_id, Direction direction) {
-        int i = 0;
-        if (!game || space_id == NO_ID || direction == NO_DIRECTION) {
-                return INVALID_INDEX;
-        }
-        for (i = 0; i < game->n_links; i++) {
-                if (space_id == link_get_origin(game->links[i]) && direction == link_get_direction(game->links[i])) {
-                        return i;
+Status game_snapshot_read_world(Game* game, FILE* f, const Game_capacity* counts) {
+        char gdesc[GDESC_LINES][LINE_LENGTH + 1];
+        char name[WORD_SIZE], text[WORD_SIZE], message[WORD_SIZE];
+        long id, values[5];
+        Space* space = NULL;
+        Link* link = NULL;
+        Object* object = NULL;
+        Character* character = NULL;
+        int i, j;
+
+        for (i = 0; i < counts->n_spaces; i++) {
+                if (game_snapshot_read_long(f, &id) == ERROR || game_snapshot_read_string(f, name, WORD_SIZE) == ERROR ||
+                    game_snapshot_read_long(f, &values[0]) == ERROR) {
+                        return ERROR;
+                }
+                for (j = 0; j < GDESC_LINES; j++) {
+                        if (game_snapshot_read_string(f, gdesc[j], LINE_LENGTH + 1) == ERROR) return ERROR;
+                }
+                if (!(space = space_create(id))) return ERROR;
+                if (space_set_name(space, name) == ERROR || space_set_discovered(space, (Bool)values[0]) == ERROR ||
+                    space_set_gdesc(space, gdesc) == ERROR || game_add_space(game, space) == ERROR) {
+                        space_destroy(space);
+                        return ERROR;
                 }
         }
 
-        return INVALID_INDEX;
-}
-
-Id game_get_link(const Game* game, Id space_id, Direction direction) {
-        int i = 0;
+        for (i = 0; i < counts->n_links; i++) {
+                if (game_snapshot_read_long(f, &id) == ERROR || game_snapshot_read_string(f, name, WORD_SIZE) == ERROR) {
+                        return ERROR;
+                }
+                for (j = 0; j < 4; j++) {
+                        if (game_snapshot_read_long(f, &values[j]) == ERROR) return ERROR;
+                }
+                if (!(link = link_create(id))) return ERROR;
+                if (link_set_name(link, name) == ERROR || link_set_origin(link, values[0]) == ERROR ||
+                    link_set_destination(link, values[1]) == ERROR || link_set_direction(link, (Direction)values[2]) == ERROR ||
+                    link_set_open(link, (Bool)values[3]) == ERROR || game_add_link(game, link) == ERROR) {
+                        link_destroy(link);
+                        return ERROR;
+                }
+        }
 
-        if (!game) {
-                return NO_ID;
+        for (i = 0; i < counts->n_objects; i++) {
+                if (game_snapshot_read_long(f, &id) == ERROR || game_snapshot_read_string(f, name, WORD_SIZE) == ERROR ||
+                    game_snapshot_read_string(f, text, WORD_SIZE) == ERROR) {
+                        return ERROR;
+                }
+                for (j = 0; j < 5; j++) {
+                        if (game_snapshot_read_long(f, &values[j]) == ERROR) return ERROR;
+                }
+                if (!(object = object_create(id))) return ERROR;
+                if (object_set_name(object, name) == ERROR || object_set_description(object, text) == ERROR ||
+                    object_set_health(object, (int)values[0]) == ERROR || object_set_movable(object, (Bool)values[1]) == ERROR ||
+                    object_set_dependency(object, values[2]) == ERROR || object_set_open(object, values[3]) == ERROR ||
+                    game_add_object_in_order(game, object, values[4]) == ERROR) {
+                        object_destroy(object);
+                        return ERROR;
+                }
         }
 
-        for (i = 0; i < game->n_links; i++) {
-                if ((link_get_origin(game->links[i]) == space_id) && link_get_direction(game->links[i]) == direction) {
-                        return link_get_id(game->links[i]);
+        /*The players are added later, so the characters do not gather as followers here*/
+        for (i = 0; i < counts->n_characters; i++) {
+                if (game_snapshot_read_long(f, &id) == ERROR || game_snapshot_read_string(f, name, WORD_SIZE) == ERROR) {
+                        return ERROR;
+                }
+                for (j = 0; j < 3; j++) {
+                        if (game_snapshot_read_long(f, &values[j]) == ERROR) return ERROR;
+                }
+                if (game_snapshot_read_string(f, text, GDESC_SIZE + 1) == ERROR ||
+                    game_snapshot_read_string(f, message, WORD_SIZE) == ERROR || game_snapshot_read_long(f, &values[3]) == ERROR) {
+                        return ERROR;
+                }
+                if (!(character = character_create(id))) return ERROR;
+                if (character_set_name(character, name) == ERROR || character_set_friendly(character, (Bool)values[0]) == ERROR ||
+                    character_set_health(character, (int)values[1]) == ERROR ||
+                    character_set_following(character, values[2]) == ERROR || character_set_gdesc(character, text) == ERROR ||
+                    character_set_message(character, message) == ERROR ||
+                    game_add_character_in_order(game, character, values[3]) == ERROR) {
+                        character_destroy(character);
+                        return ERROR;
                 }
         }
 
-        return NO_ID;
+        return OK;
 }
 
-Link* game_get_link_from_name(const Game* game, char* name) {
-        int i = 0;
+Status game_snapshot_read_players(Game* game, FILE* f, int n_players) {
+        char name[WORD_SIZE], gdesc[WORD_SIZE];
+        long id, values[4], n, object;
+        Player* player = NULL;
+        int i, j;
 
-        if (!game || !name) {
-                return NULL;
-        }
+        for (i = 0; i < n_players; i++) {
+                if (game_snapshot_read_long(f, &id) == ERROR || game_snapshot_read_string(f, name, WORD_SIZE) == ERROR ||
+                    game_snapshot_read_string(f, gdesc, P_GDESC_LENGTH + 1) == ERROR) {
+                        return ERROR;
+                }
+                for (j = 0; j < 4; j++) {
+                        if (game_snapshot_read_long(f, &values[j]) == ERROR) return ERROR;
+                }
+                if (!(player = player_create(id))) return ERROR;
+                if (player_set_name(player, name) == ERROR || player_set_gdesc(player, gdesc) == ERROR ||
+                    player_set_location(player, values[0]) == ERROR || player_set_health(player, (int)values[1]) == ERROR ||
+                    player_set_damage(player, (int)values[2]) == ERROR ||
+                    player_set_backpack_size(player, (int)values[3]) == ERROR || game_add_player(game, player) == ERROR) {
+                        player_destroy(player);
+                        return ERROR;
+                }
 
-        for (i = 0; i < game->n_links; i++) {
-                if (strcasecmp(name, link_get_name(game->links[i])) == 0) {
-                        return game->links[i];
+                if (game_snapshot_read_long(f, &n) == ERROR) return ERROR;
+                for (j = 0; j < n; j++) {
+                        if (game_snapshot_read_long(f, &object) == ERROR || player_add_object(player, object) == ERROR) {
+                                return ERROR;
+                        }
+                }
+
+                /*game_add_player gathered the followers in the order of the characters, the snapshot keeps their own*/
+                while (player_get_n_followers(player) > 0) {
+                        player_del_follower(player, set_get_id_at_index(player_get_followers(player), 0));
+                }
+                if (game_snapshot_read_long(f, &n) == ERROR) return ERROR;
+                for (j = 0; j < n; j++) {
+                        if (game_snapshot_read_long(f, &id) == ERROR || player_add_follower(player, id) == ERROR) {
+                                return ERROR;
+                        }
                 }
         }
 
-        return NULL;
+        return OK;
 }
 
-/*-----------------------------Other-----------------------------*/
-void game_get_info(const Game* game, char* info) {
-        int i, j, n_objects;
-        char dummy[DUMMY_SIZE + 1];
-        char object_name[DUMMY_SIZE + 1];
-        char character_name[DUMMY_SIZE + 1];
-        Id loc = NO_ID, id_aux = NO_ID;
-        Command* command = NULL;
-        int index_aux = 0;
-        Space* space = NULL;
-        Object* object = NULL;
-
-        if (!game || !info) {
-                return;
-        }
+Status game_snapshot_read_state(Game* game, FILE* f) {
+        unsigned long random_state[RNG_STATE_SIZE];
+        char command[WORD_SIZE];
+        long n, id, code, success;
+        int i, j;
 
-        sprintf(info, "%s", "Objects:|");
-        for (i = 0; i < game->n_objects; i++) {
-                id_aux = object_get_id(game->objects[i]);
-                loc = game_get_object_location(game, id_aux);
-                if (loc != NO_ID) {
-                        space = game_get_space((const Game*)game, loc);
-                        if (!space) return;
-                        if (space_get_discovered(space) == TRUE) {
-                                sprintf(dummy, "%s", object_get_name(game->objects[i]));
-                                strcat(info, "   ");
-                                strcat(info, dummy);
-                                sprintf(dummy, ":  %3ld|", loc);
-                                strcat(info, dummy);
+        for (i = 0; i < game->n_spaces; i++) {
+                if (game_snapshot_read_long(f, &n) == ERROR) return ERROR;
+                for (j = 0; j < n; j++) {
+                        if (game_snapshot_read_long(f, &id) == ERROR ||
+                            game_set_object_location(game, id, space_get_id(game->spaces[i])) == ERROR) {
+                                return ERROR;
                         }
                 }
-        }
-        strcat(info, "Characters:|");
-        for (i = 0; i < game->n_characters; i++) {
-                id_aux = character_get_id(game->characters[i]);
-                loc = game_get_character_location(game, id_aux);
-                space = game_get_space((const Game*)game, loc);
-                if (!space) return;
-                if (space_get_discovered(space) == TRUE) {
-                        sprintf(dummy, "%-6s", character_get_gdesc(game->characters[i]));
-                        strcat(info, "   ");
-                        strcat(info, dummy);
-                        sprintf(dummy, ":  %3ld", loc);
-                        strcat(info, dummy);
-                        sprintf(dummy, " (%d)|", character_get_health(game->characters[i]));
-                        strcat(info, dummy);
-                }
-        }
-        strcat(info, "Players   :|");
-        for (i = 0; i < game->n_players; i++) {
-                loc = player_get_location(game->players[i]);
-                sprintf(dummy, " %6s %3ld (%d)|", player_get_gdesc(game->players[i]), loc, player_get_health(game->players[i]));
-                strcat(info, dummy);
-                if (i == game->player_indices[game->turn]) {
-                        n_objects = player_get_num_objects(game->players[i]);
-                        strcat(info, "          Inventory:|");
-                        for (j = 0; j < n_objects; j++) {
-                                object = game_get_object_from_id(game, player_get_object_at_index(game->players[i], j));
-                                sprintf(dummy, "               %s|", object_get_name(object));
-                                strcat(info, dummy);
+                if (game_snapshot_read_long(f, &n) == ERROR) return ERROR;
+                for (j = 0; j < n; j++) {
+                        if (game_snapshot_read_long(f, &id) == ERROR ||
+                            game_set_character_location(game, space_get_id(game->spaces[i]), id) == ERROR) {
+                                return ERROR;
                         }
                 }
         }
 
-        command = game_get_last_command((const Game*)game);
-        if (!command) {
-                command_set_success(game_get_last_command((const Game*)game), ERROR);
-                return;
+        if (game_snapshot_read_long(f, &n) == ERROR || n < 0 || n > game->n_players) return ERROR;
+        game->num_alive_players = (int)n;
+        for (i = 0; i < game->num_alive_players; i++) {
+                if (game_snapshot_read_long(f, &id) == ERROR || id < 0 || id >= game->n_players) return ERROR;
+                game->player_indices[i] = (int)id;
+        }
+        if (game_snapshot_read_long(f, &n) == ERROR) return ERROR;
+        game->turn = (int)n;
+        if (game_snapshot_read_long(f, &n) == ERROR) return ERROR;
+        game->finished = (Bool)n;
+        if (game_snapshot_read_long(f, &n) == ERROR) return ERROR;
+        game->deterministic = (int)n;
+        if (game_snapshot_read_long(f, &n) == ERROR) return ERROR;
+        game->combat_succeds = (Bool)n;
+        for (i = 0; i < RNG_STATE_SIZE; i++) {
+                if (game_snapshot_read_long(f, &n) == ERROR) return ERROR;
+                random_state[i] = (unsigned long)n;
+        }
+        if (rng_set_state(&game->rng, random_state) == ERROR) return ERROR;
+
+        /*The command is parsed again so its string code is set too*/
+        if (game_snapshot_read_long(f, &code) == ERROR || game_snapshot_read_string(f, command, WORD_SIZE) == ERROR ||
+            game_snapshot_read_long(f, &success) == ERROR) {
+                return ERROR;
         }
+        command_parse(game->last_cmd, command);
+        command_set_code(game->last_cmd, (CommandCode)code);
+        command_set_success(game->last_cmd, (Status)success);
 
-        strcpy(object_name, command_get_arg((const Command*)command));
-        id_aux = game_get_object_id_from_name((const Game*)game, object_name);
+        return OK;
+}
 
-        index_aux = game_get_object_index_from_id(game, id_aux);
+unsigned long game_hash_mix(unsigned long x) {
+        x &= MASK_32;
+        x ^= x >> 16;
+        x = (x * 0x7FEB352DUL) & MASK_32;
+        x ^= x >> 15;
+        x = (x * 0x846CA68BUL) & MASK_32;
+        x ^= x >> 16;
 
-        if (command_get_code(command) == INSPECT && command_get_success(command) == OK) {
-                sprintf(dummy, "Inspection of the object %s is: %s", object_get_name(game->objects[index_aux]),
-                        game_get_description_of_current_object(game, object_get_name(game->objects[index_aux])));
-                strcat(info, dummy);
-        }
+        return x;
+}
 
-        command = game_get_last_command((const Game*)game);
-        if (!command) {
-                command_set_success(game_get_last_command((const Game*)game), ERROR);
-                return;
-        }
-        strcpy(character_name, command_get_arg((const Command*)command));
+void game_hash_feature(Game_hash* hash, Hash_feature feature, Id id, long value) {
+        unsigned long low, high;
+
+        /*Each half chains the feature, the id and the value through the mix from its own seed, so two different
+         triples hardly ever get the same key in both halves*/
+        low = game_hash_mix(HASH_SEED_LOW ^ (unsigned long)feature);
+        low = game_hash_mix(low ^ (unsigned long)id);
+        low = game_hash_mix(low ^ (unsigned long)value);
+        high = game_hash_mix(HASH_SEED_HIGH ^ (unsigned long)feature);
+        high = game_hash_mix(high ^ (unsigned long)id);
+        high = game_hash_mix(high ^ (unsigned long)value);
+
+        hash->low ^= low;
+        hash->high ^= high;
+}
+
+void game_hash_player(Game_hash* hash, const Player* player) {
+        Set_iterator it;
+        Id id = player_get_id(player), object = NO_ID;
 
-        i = game_get_character_index_from_name(game, character_name);
-        if (command_get_code(command) == CHAT && command_get_success(command) == OK) {
-                sprintf(dummy, "Message: %s", character_get_message(game->characters[i]));
-                strcat(info, dummy);
+        game_hash_feature(hash, HASH_PLAYER_LOCATION, id, player_get_location(player));
+        game_hash_feature(hash, HASH_PLAYER_HEALTH, id, player_get_health(player));
+        set_iterator_init(&it, player_get_objects(player));
+        while (set_iterator_next(&it, &object)) {
+                game_hash_feature(hash, HASH_PLAYER_OBJECT, id, object);
         }
 }
 
-void game_print(const Game* game) {
-        int i = 0;
+void game_hash_object(const Game* game, Game_hash* hash, const Object* object) {
+        Id id = object_get_id(object);
 
-        if (!game) {
+        game_hash_feature(hash, HASH_OBJECT_LOCATION, id, game_get_object_location(game, id));
+}
+
+void game_hash_character(const Game* game, Game_hash* hash, const Character* character) {
+        Id id = character_get_id(character);
+
+        game_hash_feature(hash, HASH_CHARACTER_LOCATION, id, game_get_character_location(game, id));
+        game_hash_feature(hash, HASH_CHARACTER_HEALTH, id, character_get_health(character));
+        game_hash_feature(hash, HASH_CHARACTER_FOLLOWING, id, character_get_following(character));
+}
+
+void game_change_turn(Game* game, int turn) {
+        if (game_record_change(game, CHANGE_TURN, NULL, NO_ID, INVALID_INDEX, game->turn) == ERROR) {
                 return;
         }
+        game_hash_feature(&game->state_hash, HASH_TURN, NO_ID, game->turn);
+        game->turn = turn;
+        game_hash_feature(&game->state_hash, HASH_TURN, NO_ID, game->turn);
+}
 
-        printf("\n\n-------------\n\n");
-        printf("=> Players: \n");
-        for (i = 0; i < game->n_players; i++) player_print(game->players[i]);
+Status game_change_player_health(Game* game, Player* player, int health) {
+        int old_health = player_get_health(player);
 
-        printf("=> Objects: \n");
-        for (i = 0; i < game->n_objects; i++) {
-                object_print(game->objects[i]);
-                printf("\n");
-        }
-        printf("The number of objects is: %d\n", game->n_objects);
-        printf("\n");
-        printf("=> Characters: \n");
-        for (i = 0; i < game->n_characters; i++) {
-                character_print(game->characters[i]);
-                printf("\n");
-        }
-        printf("The number of characters is: %d\n", game->n_characters);
-        printf("\n");
-        printf("=> Spaces: \n");
-        for (i = 0; i < game->n_spaces; i++) {
-                space_print(game->spaces[i]);
+        if (game_record_change(game, CHANGE_PLAYER_HEALTH, player, NO_ID, INVALID_INDEX, old_health) == ERROR ||
+            player_set_health(player, health) == ERROR) {
+                return ERROR;
         }
-        printf("The number of spaces is: %d\n", game->n_spaces);
-        printf("The finished status is: %d\n", game->finished);
-        command_print(game->last_cmd);
+        game_hash_feature(&game->state_hash, HASH_PLAYER_HEALTH, player_get_id(player), old_health);
+        game_hash_feature(&game->state_hash, HASH_PLAYER_HEALTH, player_get_id(player), health);
 
-        return;
+        return OK;
 }
 
-/**
-   Implementation of private functions
-*/
-
-const char* game_get_description_of_current_object(const Game* game, const char* name) {
-        Object* object = NULL;
+Status game_change_character_health(Game* game, Character* character, int health) {
+        int old_health = character_get_health(character);
 
-        if (!game || !name) {
-                return "";
+        if (game_record_change(game, CHANGE_CHARACTER_HEALTH, character, character_get_id(character), INVALID_INDEX,
+                               old_health) == ERROR ||
+            character_set_health(character, health) == ERROR) {
+                return ERROR;
         }
+        game_hash_feature(&game->state_hash, HASH_CHARACTER_HEALTH, character_get_id(character), old_health);
+        game_hash_feature(&game->state_hash, HASH_CHARACTER_HEALTH, character_get_id(character), health);
 
-        object = game_get_object_from_id(game, game_get_object_id_from_name(game, name));
-
-        return object_get_description(object);
+        return OK;
 }
 
-Id game_get_space_id_at(const Game* game, int position) {
-        /*Error control*/
+Status game_refresh_state_hash(Game* game) {
         if (!game) {
-                return NO_ID;
-        }
-        if (position < 0 || position >= game->n_spaces) {
-                return NO_ID;
+                return ERROR;
         }
 
-        return space_get_id(game->spaces[position]);
+        /*The entities were changed without passing through game_record_change*/
+        game->n_changes++;
+        return game_compute_state_hash((const Game*)game, &game->state_hash);
 }
 
-void game_get_object_name_by_id(const Game* game, Id id, char* name) {
-        int i;
-        if (!game || id == NO_ID) return;
-        for (i = 0; i < game->n_objects; i++) {
-                if (object_get_id(game->objects[i]) == id) {
-                        strcpy(name, object_get_name(game->objects[i]));
-                        return;
-                }
-        }
-        return;
-}
+Status game_change_player_location(Game* game, Player* player, Id location) {
+        Id old_location = player_get_location(player);
 
-int game_get_object_index_from_name(const Game* game, const char* name) {
-        int i;
-        if (!game || !name) {
-                return INVALID_INDEX;
+        if (game_record_change(game, CHANGE_PLAYER_LOCATION, player, NO_ID, INVALID_INDEX, old_location) == ERROR ||
+            player_set_location(player, location) == ERROR) {
+                return ERROR;
         }
+        game_hash_feature(&game->state_hash, HASH_PLAYER_LOCATION, player_get_id(player), old_location);
+        game_hash_feature(&game->state_hash, HASH_PLAYER_LOCATION, player_get_id(player), location);
 
-        for (i = 0; i < game->n_objects; i++) {
-                if (strcasecmp(object_get_name(game->objects[i]), name) == 0) return i;
-        }
-        return INVALID_INDEX;
+        return OK;
 }
 
-int game_get_object_index_from_id(const Game* game, Id id) {
-        int i;
-        if (!game || id == NO_ID) return INVALID_INDEX;
-        for (i = 0; i < game->n_objects; i++) {
-                if (object_get_id(game->objects[i]) == id) return i;
+Status game_change_player_damage(Game* game, Player* player, int damage) {
+        if (game_record_change(game, CHANGE_PLAYER_DAMAGE, player, NO_ID, INVALID_INDEX, player_get_damage(player)) ==
+            ERROR) {
+                return ERROR;
         }
-        return INVALID_INDEX;
+
+        return player_set_damage(player, damage);
 }
 
-int game_get_character_index_from_id(const Game* game, Id id) {
-        int i;
-        if (!game || id == NO_ID) return INVALID_INDEX;
-        for (i = 0; i < game->n_characters; i++) {
-                if (character_get_id(game->characters[i]) == id) return i;
+Status game_change_player_object(Game* game, Player* player, Id object_id, Bool carried, int order) {
+        if (player_has_object(player, object_id) == carried) {
+                return ERROR;
         }
-        return INVALID_INDEX;
-}
 
-int game_get_link_index_from_id(const Game* game, Id id) {
-        int i;
-        if (!game || id == NO_ID) return INVALID_INDEX;
-        for (i = 0; i < game->n_links; i++) {
-                if (link_get_id(game->links[i]) == id) return i;
+        if (game_record_change(game, CHANGE_PLAYER_OBJECT, player, object_id,
+                               carried == TRUE ? INVALID_INDEX : set_get_index(player_get_objects(player), object_id),
+                               carried == TRUE ? FALSE : TRUE) == ERROR) {
+                return ERROR;
         }
-        return INVALID_INDEX;
+        if (carried == TRUE) {
+                if (player_add_object(player, object_id) == ERROR) return ERROR;
+                if (order != INVALID_INDEX) player_move_object(player, object_id, order);
+        } else if (player_del_object(player, object_id) == NO_ID) {
+                return ERROR;
+        }
+        game_hash_feature(&game->state_hash, HASH_PLAYER_OBJECT, player_get_id(player), object_id);
+
+        return OK;
 }
-int game_get_player_index_from_id(const Game* game, Id id) {
+
+Status game_change_alive_player(Game* game, int position, int player_index) {
         int i;
-        if (!game || id == NO_ID) {
-                return INVALID_INDEX;
-        }
 
-        for (i = 0; i < game->n_players; i++) {
-                if (player_get_id(game->players[i]) == id) {
-                        return i;
+        if (player_index == INVALID_INDEX) {
+                if (position < 0 || position >= game->num_alive_players ||
+                    game_record_change(game, CHANGE_ALIVE_PLAYER, NULL, NO_ID, position, game->player_indices[position]) ==
+                        ERROR) {
+                        return ERROR;
+                }
+                for (i = position; i < game->num_alive_players - 1; i++) {
+                        game->player_indices[i] = game->player_indices[i + 1];
+                }
+                game->player_indices[i] = 0;
+                game->num_alive_players--;
+        } else {
+                if (position < 0 || position > game->num_alive_players || game->num_alive_players >= game->n_players ||
+                    game_record_change(game, CHANGE_ALIVE_PLAYER, NULL, NO_ID, position, INVALID_INDEX) == ERROR) {
+                        return ERROR;
+                }
+                for (i = game->num_alive_players; i > position; i--) {
+                        game->player_indices[i] = game->player_indices[i - 1];
                 }
+                game->player_indices[position] = player_index;
+                game->num_alive_players++;
         }
-        return INVALID_INDEX;
+
+        return OK;
 }
 
-void game_pass_turn(Game* game) {
-        if (!game) {
-                return;
+Status game_change_object_location(Game* game, Id object_id, Id location, int order) {
+        Id old_location = game_get_object_location((const Game*)game, object_id);
+        Space *space = game_get_space((const Game*)game, location), *old_space = NULL;
+        int old_order = INVALID_INDEX;
+
+        if (old_location != location) {
+                old_space = game_get_space((const Game*)game, old_location);
+                old_order = set_get_index(space_get_objects(old_space), object_id);
         }
-        if (game->num_alive_players > 0) {
-                game->turn = (game->turn + 1) % game->num_alive_players;
+
+        if ((location != NO_ID && !space) ||
+            game_record_change(game, CHANGE_OBJECT_LOCATION, NULL, object_id, old_order, old_location) == ERROR) {
+                return ERROR;
         }
-        return;
-}
 
-void game_exclude_player(Game* game) {
-        int i;
-        for (i = game->turn; i < game->num_alive_players - 1; i++) {
-                game->player_indices[i] = game->player_indices[i + 1];
+        /*The space set and the location map are always changed together*/
+        if (space && space_add_object(space, object_id) == ERROR) {
+                return ERROR;
+        }
+        if (space && order != INVALID_INDEX) {
+                space_move_object(space, object_id, order);
+        }
+        if (old_space) {
+                space_del_object(old_space, object_id);
+        }
+        if (location == NO_ID) {
+                map_del(game->object_locations, object_id);
+        } else if (map_set(game->object_locations, object_id, location) == ERROR) {
+                return ERROR;
         }
-        game->player_indices[i] = 0;
-        game->num_alive_players--;
 
-        if (game->turn >= game->num_alive_players && game->num_alive_players != 0) {
-                game->turn--;
+        /*Only the objects of the game are in the hash, the ones still being created get theirs when added*/
+        if (game_get_object_index_from_id((const Game*)game, object_id) != INVALID_INDEX) {
+                game_hash_feature(&game->state_hash, HASH_OBJECT_LOCATION, object_id, old_location);
+                game_hash_feature(&game->state_hash, HASH_OBJECT_LOCATION, object_id, location);
         }
-        return;
+
+        return OK;
 }
 
-const char* game_get_current_player_gdesc(const Game* game) {
-        if (!game) {
-                return " ";
+Status game_change_object_presence(Game* game, Object* object, int position, Bool present) {
+        Game_capacity needed = {0, 0, 0, 0, 0};
+        Id id = object_get_id(object);
+
+        if (present == FALSE) {
+                if (position < 0 || position >= game->n_objects || game->objects[position] != object ||
+                    game_record_change(game, CHANGE_OBJECT_PRESENCE, object, id, position, TRUE) == ERROR) {
+                        return ERROR;
+                }
+                game_unindex_object_name(game, position);
+                game_hash_object((const Game*)game, &game->state_hash, object);
+
+                /*The last object takes its place, the name index keeps the order the objects were added in*/
+                map_del(game->object_index, id);
+                game->n_objects--;
+                if (position < game->n_objects) {
+                        game->objects[position] = game->objects[game->n_objects];
+                        map_set(game->object_index, object_get_id(game->objects[position]), position);
+                }
+                game->objects[game->n_objects] = NULL;
+
+                return OK;
         }
-        if (player_get_health(game->players[game->player_indices[game->turn]]) <= 0) {
-                return "   /+\\";
-        } else {
-                return player_get_gdesc(game->players[game->player_indices[game->turn]]);
+
+        needed.n_objects = game->n_objects + 1;
+        if (position < 0 || position > game->n_objects || game_reserve(game, &needed) == ERROR ||
+            map_set(game->object_index, id, position) == ERROR ||
+            game_record_change(game, CHANGE_OBJECT_PRESENCE, object, id, position, FALSE) == ERROR) {
+                return ERROR;
         }
+        if (position < game->n_objects) {
+                game->objects[game->n_objects] = game->objects[position];
+                map_set(game->object_index, object_get_id(game->objects[game->n_objects]), game->n_objects);
+        }
+        game->objects[position] = object;
+        game->n_objects++;
+        game_index_object_name(game, position);
+        game_hash_object((const Game*)game, &game->state_hash, object);
+
+        return OK;
 }
 
-int game_get_current_turn(const Game* game) {
-        if (!game) {
-                return INVALID_INDEX;
+Status game_change_character_location(Game* game, Id character_id, Id location, int order) {
+        Id old_location = game_get_character_location((const Game*)game, character_id);
+        Space *space = game_get_space((const Game*)game, location), *old_space = NULL;
+        int old_order = INVALID_INDEX;
+
+        if (old_location != location) {
+                old_space = game_get_space((const Game*)game, old_location);
+                old_order = set_get_index(space_get_characters(old_space), character_id);
         }
-        return game->player_indices[game->turn];
-}
 
-void game_write_recent_log(const Game* game, const char* file) {
-        Command* command = NULL;
-        char arg_buff[ARG_SIZE];
-        FILE* f = NULL;
-        if (!game || !file) {
-                return;
+        if ((location != NO_ID && !space) ||
+            game_record_change(game, CHANGE_CHARACTER_LOCATION, NULL, character_id, old_order, old_location) ==
+                ERROR) {
+                return ERROR;
         }
-        command = game_get_last_command(game);
-        if (!command) {
-                return;
+
+        /*The space set and the location map are always changed together*/
+        if (space && space_add_character(space, character_id) == ERROR) {
+                return ERROR;
+        }
+        if (space && order != INVALID_INDEX) {
+                space_move_character(space, character_id, order);
+        }
+        if (old_space) {
+                space_del_character(old_space, character_id);
+        }
+        if (location == NO_ID) {
+                map_del(game->character_locations, character_id);
+        } else if (map_set(game->character_locations, character_id, location) == ERROR) {
+                return ERROR;
         }
 
-        strcpy(arg_buff, command_get_arg(command));
-        f = fopen(file, "a");
-        if (!f) {
-                return;
+        /*Only the characters of the game are in the hash, the ones still being created get theirs when added*/
+        if (game_get_character_index_from_id((const Game*)game, character_id) != INVALID_INDEX) {
+                game_hash_feature(&game->state_hash, HASH_CHARACTER_LOCATION, character_id, old_location);
+                game_hash_feature(&game->state_hash, HASH_CHARACTER_LOCATION, character_id, location);
         }
 
-        fprintf(f, "%s %s: %s (%s)\n", command_get_string_code(command), arg_buff[0] == '\0' ? "" : arg_buff,
-                command_get_success(command) == OK ? "OK" : "ERROR", game_get_player_name(game));
-        fclose(f);
-        return;
+        return OK;
 }
 
-void game_get_players_row_at_space(const Game* game, Id id, char* first_row, char* second_row) {
-        int i, count = 0;
-        char buffer1[MAX_BUFFER1 + 1], buffer2[MAX_BUFFER2 + 1];
-        if (!game || !first_row || !second_row) return;
-        if (id != NO_ID) {
-                for (i = 0; i < game->n_players && count < MAX_ROW_PLAYERS; i++) {
-                        if (player_get_location(game->players[i]) == id && i != game->player_indices[game->turn]) {
-                                strcpy(buffer1, player_get_gdesc(game->players[i]));
-                                strcpy(buffer2, &buffer1[CUT_INDEX - 1]);
-                                if (count < 3)
-                                        sprintf(buffer1, "%3s|", player_get_health(game->players[i]) == 0 ? "/+\\" : buffer2);
-                                else
-                                        sprintf(buffer1, "%3s  ", player_get_health(game->players[i]) == 0 ? "/+\\" : buffer2);
-                                strcat(first_row, buffer1);
-                                count++;
-                        }
+Status game_change_character_presence(Game* game, Character* character, int position, Bool present) {
+        Game_capacity needed = {0, 0, 0, 0, 0};
+        Id id = character_get_id(character);
+
+        if (present == FALSE) {
+                if (position < 0 || position >= game->n_characters || game->characters[position] != character ||
+                    game_record_change(game, CHANGE_CHARACTER_PRESENCE, character, id, position, TRUE) == ERROR) {
+                        return ERROR;
                 }
-        }
-        if (count < MAX_ROW_PLAYERS) {
-                for (; count < MAX_ROW_PLAYERS; count++) {
-                        if (count < 3)
-                                strcat(first_row, id == -1 ? "    " : "   |");
-                        else
-                                strcat(first_row, id == -1 ? "     " : "   | ");
+                game_hash_character((const Game*)game, &game->state_hash, character);
+                game_unindex_character_name(game, position);
+                player_del_follower(game_get_player_from_id(game, character_get_following(character)), id);
+
+                /*The last character takes its place, the name index keeps the order the characters were added in*/
+                map_del(game->character_index, id);
+                game->n_characters--;
+                if (position < game->n_characters) {
+                        game->characters[position] = game->characters[game->n_characters];
+                        map_set(game->character_index, character_get_id(game->characters[position]), position);
                 }
+                game->characters[game->n_characters] = NULL;
+
+                return OK;
         }
 
-        count = 0;
-        if (id != NO_ID) {
-                for (; i < game->n_players; i++) {
-                        if (player_get_location(game->players[i]) == id && i != game->player_indices[game->turn]) {
-                                strcpy(buffer1, player_get_gdesc(game->players[i]));
-                                strcpy(buffer2, &buffer1[CUT_INDEX - 1]);
-                                if (count < 3)
-                                        sprintf(buffer1, "%3s|", player_get_health(game->players[i]) == 0 ? "/+\\" : buffer2);
-                                else
-                                        sprintf(buffer1, "%3s  ", player_get_health(game->players[i]) == 0 ? "/+\\" : buffer2);
-                                strcat(second_row, buffer1);
-                                count++;
-                        }
-                }
+        needed.n_characters = game->n_characters + 1;
+        if (position < 0 || position > game->n_characters || game_reserve(game, &needed) == ERROR ||
+            map_set(game->character_index, id, position) == ERROR ||
+            game_record_change(game, CHANGE_CHARACTER_PRESENCE, character, id, position, FALSE) == ERROR) {
+                return ERROR;
         }
-        if (count < MAX_ROW_PLAYERS) {
-                for (; count < MAX_ROW_PLAYERS; count++) {
-                        if (count < 3)
-                                strcat(second_row, id == -1 ? "    " : "   |");
-                        else
-                                strcat(second_row, "     ");
-                }
+        if (position < game->n_characters) {
+                game->characters[game->n_characters] = game->characters[position];
+                map_set(game->character_index, character_get_id(game->characters[game->n_characters]), game->n_characters);
         }
+        game->characters[position] = character;
+        game->n_characters++;
+        game_index_character_name(game, position);
+        player_add_follower(game_get_player_from_id(game, character_get_following(character)), id);
+        game_hash_character((const Game*)game, &game->state_hash, character);
+
+        return OK;
 }
 
-Status game_set_deterministic_mode(Game* game, int deterministic) {
-        if (!game || !deterministic) {
+Status game_change_character_following(Game* game, Character* character, Id player_id, int order) {
+        Id id = character_get_id(character), old_following = character_get_following(character);
+        Player* old_player = game_get_player_from_id(game, old_following);
+
+        if (game_record_change(game, CHANGE_CHARACTER_FOLLOWING, character, id,
+                               set_get_index(player_get_followers(old_player), id), old_following) == ERROR) {
                 return ERROR;
         }
-        game->deterministic = deterministic;
+
+        /*The character field and the follower sets of the players are always changed together*/
+        player_del_follower(old_player, id);
+        if (character_set_following(character, player_id) == ERROR) {
+                return ERROR;
+        }
+        game_hash_feature(&game->state_hash, HASH_CHARACTER_FOLLOWING, id, old_following);
+        game_hash_feature(&game->state_hash, HASH_CHARACTER_FOLLOWING, id, player_id);
+        if (player_id != NO_ID) {
+                if (player_add_follower(game_get_player_from_id(game, player_id), id) == ERROR) return ERROR;
+                if (order != INVALID_INDEX) player_move_follower(game_get_player_from_id(game, player_id), id, order);
+        }
+
         return OK;
 }
 
-Status game_set_turn(Game* game, int turn) {
-        if (turn <= -1) {
+Status game_change_character_name(Game* game, Character* character, char* name) {
+        int index = game_get_character_index_from_id((const Game*)game, character_get_id(character));
+
+        if (index == INVALID_INDEX || game_record_name(game, character) == ERROR) {
                 return ERROR;
         }
-        game->turn = turn;
+
+        game_unindex_character_name(game, index);
+        if (character_set_name(character, name) == ERROR) {
+                game_index_character_name(game, index);
+                return ERROR;
+        }
+        game_index_character_name(game, index);
+
         return OK;
 }
 
-int game_get_turn(Game* game) { return game->turn; }
+Status game_change_link_open(Game* game, Link* link, Bool open) {
+        Bool old_open = link_get_open(link);
 
-Status game_game_management_save(Game* game, char* filename) {
-        if (!game || filename == NULL) {
+        if (game_record_change(game, CHANGE_LINK_OPEN, link, link_get_id(link), INVALID_INDEX, old_open) == ERROR ||
+            link_set_open(link, open) == ERROR) {
                 return ERROR;
         }
-        return game_management_save(&game, filename);
+        game_hash_feature(&game->state_hash, HASH_LINK_OPEN, link_get_id(link), old_open);
+        game_hash_feature(&game->state_hash, HASH_LINK_OPEN, link_get_id(link), open);
+
+        return OK;
 }
 
-Status game_game_management_load(Game* game, char* filename) {
-        if (!game || filename == NULL) {
+Status game_record_change(Game* game, Change_kind kind, void* target, Id id, int position, long value) {
+        Game_turn* turn = game->recording;
+        Game_change* changes = NULL;
+        int size;
+
+        /*Every change of the state passes through here, recorded or not*/
+        game->n_changes++;
+        if (!turn) {
+                return OK;
+        }
+
+        if (turn->n_changes == turn->size) {
+                size = game_grown_capacity(turn->size, turn->n_changes + 1);
+                if (!(changes = (Game_change*)realloc(turn->changes, size * sizeof(Game_change)))) return ERROR;
+                turn->changes = changes;
+                turn->size = size;
+        }
+        turn->changes[turn->n_changes].kind = kind;
+        turn->changes[turn->n_changes].target = target;
+        turn->changes[turn->n_changes].id = id;
+        turn->changes[turn->n_changes].position = position;
+        turn->changes[turn->n_changes].value = value;
+        turn->changes[turn->n_changes].name = NULL;
+        turn->n_changes++;
+
+        return OK;
+}
+
+Status game_record_name(Game* game, Character* character) {
+        const char* name = character_get_name(character);
+        char* copy = NULL;
+
+        game->n_changes++;
+        if (!game->recording) {
+                return OK;
+        }
+
+        if (!name || !(copy = (char*)malloc(strlen(name) + 1))) {
+                return ERROR;
+        }
+        strcpy(copy, name);
+        if (game_record_change(game, CHANGE_CHARACTER_NAME, character, character_get_id(character), INVALID_INDEX, 0) ==
+            ERROR) {
+                free(copy);
                 return ERROR;
         }
-        return game_management_load(&game, filename);
+        game->recording->changes[game->recording->n_changes - 1].name = copy;
+
+        return OK;
+}
+
+void game_apply_change(Game* game, Game_change* change) {
+        Game_turn* recording = game->recording;
+        Game_turn reverse;
+        Game_change replaced;
+
+        /*Applying the change records the one that reverses it, which takes its place*/
+        reverse.changes = &replaced;
+        reverse.n_changes = 0;
+        reverse.size = 1;
+        game->recording = &reverse;
+        switch (change->kind) {
+                case CHANGE_TURN:
+                        game_change_turn(game, (int)change->value);
+                        break;
+                case CHANGE_ALIVE_PLAYER:
+                        game_change_alive_player(game, change->position, (int)change->value);
+                        break;
+                case CHANGE_FINISHED:
+                        game_set_finished(game, (Bool)change->value);
+                        break;
+                case CHANGE_COMBAT:
+                        game_set_last_player_won_combat(game, (Bool)change->value);
+                        break;
+                case CHANGE_PLAYER_LOCATION:
+                        game_change_player_location(game, (Player*)change->target, (Id)change->value);
+                        break;
+                case CHANGE_PLAYER_HEALTH:
+                        game_change_player_health(game, (Player*)change->target, (int)change->value);
+                        break;
+                case CHANGE_PLAYER_DAMAGE:
+                        game_change_player_damage(game, (Player*)change->target, (int)change->value);
+                        break;
+                case CHANGE_PLAYER_OBJECT:
+                        game_change_player_object(game, (Player*)change->target, change->id, (Bool)change->value,
+                                                  change->position);
+                        break;
+                case CHANGE_OBJECT_PRESENCE:
+                        game_change_object_presence(game, (Object*)change->target, change->position, (Bool)change->value);
+                        break;
+                case CHANGE_OBJECT_LOCATION:
+                        game_change_object_location(game, change->id, (Id)change->value, change->position);
+                        break;
+                case CHANGE_CHARACTER_PRESENCE:
+                        game_change_character_presence(game, (Character*)change->target, change->position,
+                                                       (Bool)change->value);
+                        break;
+                case CHANGE_CHARACTER_LOCATION:
+                        game_change_character_location(game, change->id, (Id)change->value, change->position);
+                        break;
+                case CHANGE_CHARACTER_HEALTH:
+                        game_change_character_health(game, (Character*)change->target, (int)change->value);
+                        break;
+                case CHANGE_CHARACTER_FOLLOWING:
+                        game_change_character_following(game, (Character*)change->target, (Id)change->value,
+                                                        change->position);
+                        break;
+                case CHANGE_CHARACTER_NAME:
+                        game_change_character_name(game, (Character*)change->target, change->name);
+                        break;
+                case CHANGE_LINK_OPEN:
+                        game_change_link_open(game, (Link*)change->target, (Bool)change->value);
+                        break;
+                case CHANGE_SPACE_DISCOVERED:
+                        game_set_space_discovered(game, change->id, (Bool)change->value);
+                        break;
+                case CHANGE_RULE_VALUE:
+                        game_set_rule_value(game, (int*)change->target, (int)change->value);
+                        break;
+                case CHANGE_RULE_FLAG:
+                        game_set_rule_flag(game, (Bool*)change->target, (Bool)change->value);
+                        break;
+        }
+        game->recording = recording;
+
+        /*If it could not be applied the change is left as it was*/
+        if (reverse.n_changes == 1) {
+                free(change->name);
+                *change = replaced;
+        }
+}
+
+void game_free_change(Game_change* change) {
+        /*An entity is kept by the change while it is out of the game, that is, while the change would put it back*/
+        switch (change->kind) {
+                case CHANGE_OBJECT_PRESENCE:
+                        if (change->value == TRUE) object_destroy((Object*)change->target);
+                        break;
+                case CHANGE_CHARACTER_PRESENCE:
+                        if (change->value == TRUE) character_destroy((Character*)change->target);
+                        break;
+                case CHANGE_CHARACTER_NAME:
+                        free(change->name);
+                        break;
+                default:
+                        break;
+        }
+}
+
+void game_turn_destroy(Game_turn* turn) {
+        int i;
+
+        if (!turn) {
+                return;
+        }
+
+        for (i = 0; i < turn->n_changes; i++) {
+                game_free_change(&turn->changes[i]);
+        }
+        free(turn->changes);
+        free(turn);
+}
+
+void game_commit_turn(Game* game) {
+        /*A turn that changed nothing, like a command that failed, is recorded again by the next one*/
+        if (!game->recording || game->recording->n_changes == 0) {
+                return;
+        }
+
+        game_clear_redo(game);
+        game_push_undo(game, game->recording);
+        game->recording = NULL;
+}
+
+void game_push_undo(Game* game, Game_turn* turn) {
+        if (game->n_undo == GAME_MAX_UNDO) {
+                game_turn_destroy(game->undo[game->first_undo]);
+                game->first_undo = (game->first_undo + 1) % GAME_MAX_UNDO;
+                game->n_undo--;
+        }
+        game->undo[(game->first_undo + game->n_undo) % GAME_MAX_UNDO] = turn;
+        game->n_undo++;
+}
+
+void game_clear_redo(Game* game) {
+        while (game->n_redo > 0) {
+                game_turn_destroy(game->redo[--game->n_redo]);
+        }
 }
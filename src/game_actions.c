@@ -8,6 +8,9 @@
  * @copyright GNU Public License
  */
 
+/*strtok_r is POSIX, not ANSI C*/
+#define _POSIX_C_SOURCE 200112L
+
 #include "game_actions.h"
 
 #include <stdio.h>
@@ -228,9 +231,20 @@ Status game_actions_update(Game *game, Command *command) {
                 return ERROR;
         }
         game_set_last_command(game, command);
+        game_reset_draws(game);
 
         cmd = command_get_code(command);
 
+        /*Undo and redo go over the turns recorded, any other command is recorded as a new turn*/
+        if (cmd == UNDO || cmd == REDO) {
+                command_set_success(command, cmd == UNDO ? game_undo(game) : game_redo(game));
+                return OK;
+        }
+        if (game_begin_turn(game) == ERROR) {
+                command_set_success(command, ERROR);
+                return ERROR;
+        }
+
         switch (cmd) {
                 case UNKNOWN:
                         game_actions_unknown(game);
@@ -269,15 +283,20 @@ Status game_actions_update(Game *game, Command *command) {
                         game_actions_open(game);
                         break;
                 case LOAD:
-                        game_actions_load(game);
+                        command_set_success(command, game_actions_load(game));
                         break;
                 case SAVE:
-                        game_actions_save(game);
+                        command_set_success(command, game_actions_save(game));
                         break;
                 default:
                         break;
         }
 
+        /*A command that fails leaves the game as it found it*/
+        if (command_get_success(command) == ERROR) {
+                game_rollback_turn(game);
+        }
+
         return OK;
 }
 
@@ -337,18 +356,16 @@ void game_actions_take(Game *game) {
                         condition = TRUE;
                 }
                 if (condition == TRUE || necessary_object == NO_ID) {
-                        if (game_put_object_on_player(game, space_del_object(space, object_id)) == OK &&
+                        if (game_put_object_on_player(game, game_del_object_location(game, object_id)) == OK &&
                             (object_get_movable(object) == TRUE)) {
                                 game_pass_turn(game);
                                 command_set_success(game_get_last_command((const Game *)game), OK);
                                 return;
                         }
-                } else {
-                        space_add_object(space, object_id);
-                        command_set_success(game_get_last_command((const Game *)game), ERROR);
-                        return;
                 }
 
+                /*Whatever was changed before failing is rolled back with the turn*/
+                command_set_success(game_get_last_command((const Game *)game), ERROR);
         } else {
                 command_set_success(game_get_last_command((const Game *)game), ERROR);
         }
@@ -387,8 +404,8 @@ Status drop_rec(Game *game, Id object_id) {
         Space *space = NULL;
         Object *object = NULL;
         Player *current_player = NULL;
-
-        int i = 0;
+        Set_iterator it;
+        Id dependent_id = NO_ID;
 
         if (!game) {
                 return ERROR;
@@ -410,18 +427,17 @@ Status drop_rec(Game *game, Id object_id) {
                 return ERROR;
         }
 
-        if (game_extract_object_from_player(game, object_id) == object_id && space_add_object(space, object_id) == OK) {
-                for (i = 0; i < player_get_num_objects(current_player); i++) {
-                        if (object_get_dependency(game_get_object_from_id(game, player_get_object_at_index(current_player, i))) ==
-                            object_id) {
-                                drop_rec(game, player_get_object_at_index(current_player, i));
+        if (game_extract_object_from_player(game, object_id) == object_id &&
+            game_set_object_location(game, object_id, space_get_id(space)) == OK) {
+                set_iterator_init(&it, player_get_objects(current_player));
+                while (set_iterator_next(&it, &dependent_id)) {
+                        if (object_get_dependency(game_get_object_from_id(game, dependent_id)) == object_id) {
+                                drop_rec(game, dependent_id);
+                                /*The backpack changed under the iterator, so the walk starts again*/
+                                set_iterator_init(&it, player_get_objects(current_player));
                         }
                 }
                 return OK;
-        } else {
-                if (object_id != NO_ID) {
-                        space_del_object(space, object_id);
-                }
         }
         return ERROR;
 }
@@ -493,7 +509,7 @@ void game_actions_attack(Game *game) {
 
         if (game_get_character_is_alive(game, character_id) && character_get_friendly(character) == FALSE &&
             player_get_location(game_get_current_player(game)) == game_get_character_location((const Game *)game, character_id)) {
-                number = rand() % divisor;
+                number = game_random(game, divisor);
 
                 if (number >= 0 && number <= 4) {
                         game_set_last_player_won_combat(game, FALSE);
@@ -518,9 +534,6 @@ void game_actions_move(Game *game) {
         Direction direction = NO_DIRECTION;
         Space *space = NULL;
         Bool open = FALSE;
-        int i = 0;
-        int n_characters_following = 0;
-        Id *characters_following;
 
         /*Error control*/
         if (!game) {
@@ -569,25 +582,13 @@ void game_actions_move(Game *game) {
                                         command_set_success(game_get_last_command((const Game *)game), ERROR);
                                         return;
                                 }
-                                space_set_discovered(space, TRUE);
+                                game_set_space_discovered(game, space_get_id(space), TRUE);
 
-                                n_characters_following = game_get_n_characters_following_current_player((const Game *)game);
-                                if (n_characters_following == -1) {
+                                if (game_set_followers_location(game, new_location) == ERROR) {
                                         command_set_success(game_get_last_command((const Game *)game), ERROR);
                                         return;
                                 }
 
-                                characters_following = game_get_characters_following_current_player((const Game *)game);
-
-                                for (i = 0; i < n_characters_following; i++) {
-                                        if (game_set_character_location(game, new_location, characters_following[i]) == ERROR) {
-                                                command_set_success(game_get_last_command((const Game *)game), ERROR);
-                                                free(characters_following);
-                                                return;
-                                        }
-                                }
-
-                                free(characters_following);
                                 game_pass_turn(game);
                                 command_set_success(game_get_last_command((const Game *)game), OK);
                                 return;
@@ -654,6 +655,7 @@ void game_actions_use(Game *game) {
         char character_name[MAX_BUFFER + 1];
         char object_name[MAX_BUFFER + 1];
         char *token = NULL;
+        char *rest = NULL;
         int object_health, player_health, character_health;
         Bool alive;
         Character *character = NULL;
@@ -685,14 +687,14 @@ void game_actions_use(Game *game) {
 
         object_health = game_get_object_health_from_name(game, arg);
 
-        token = strtok(arg, " ");
+        token = strtok_r(arg, " ", &rest);
 
         if (token) {
                 strcpy(object_name, token);
-                token = strtok(NULL, " ");
+                token = strtok_r(NULL, " ", &rest);
 
                 if (token && strcmp(token, "over") == 0) {
-                        token = strtok(NULL, " ");
+                        token = strtok_r(NULL, " ", &rest);
 
                         if (token) {
                                 strcpy(character_name, token);
@@ -724,7 +726,7 @@ void game_actions_use(Game *game) {
         character_name[0] = '\0';
         player_health = game_get_player_health(game);
         game_player_gets_attacked_by_use(game, (player_health + object_health));
-        player_del_object(game_get_current_player((const Game *)game), object_id);
+        game_extract_object_from_player(game, object_id);
         game_object_destroy_from_name(game, object_name);
         command_set_success(last_cmd, OK);
         return;
@@ -759,7 +761,7 @@ void game_actions_recruit(Game *game) {
 
         if (game_get_player_location(game) == game_get_character_location(game, character_get_id(current_character)) &&
             character_get_friendly(current_character) == TRUE && character_get_following(current_character) == NO_ID) {
-                character_set_following(current_character, player_id);
+                game_set_character_following(game, character_get_id(current_character), player_id);
                 command_set_success(last_cmd, OK);
                 return;
         }
@@ -797,7 +799,7 @@ void game_actions_abandon(Game *game) {
 
         if (game_get_player_location(game) == game_get_character_location(game, character_get_id(current_character)) &&
             character_get_following(current_character) == player_id) {
-                character_set_following(current_character, NO_ID);
+                game_set_character_following(game, character_get_id(current_character), NO_ID);
                 command_set_success(game_get_last_command((const Game *)game), OK);
                 return;
         }
@@ -811,6 +813,7 @@ void game_actions_open(Game *game) {
         char link_name[MAX_BUFFER + 1];
         char object_name[MAX_BUFFER + 1];
         char *token = NULL;
+        char *rest = NULL;
         Id object_open = NO_ID;
         Id object_location = NO_ID;
         Id object_id = NO_ID;
@@ -823,7 +826,7 @@ void game_actions_open(Game *game) {
 
         strcpy(arg, command_get_arg((const Command *)last_cmd));
 
-        token = strtok(arg, " ");
+        token = strtok_r(arg, " ", &rest);
         if (token) {
                 strcpy(link_name, token);
 
@@ -833,9 +836,9 @@ void game_actions_open(Game *game) {
                         return;
                 }
 
-                token = strtok(NULL, " ");
+                token = strtok_r(NULL, " ", &rest);
                 if (strcmp(token, "with") == 0) {
-                        token = strtok(NULL, " ");
+                        token = strtok_r(NULL, " ", &rest);
                         if (token) {
                                 strcpy(object_name, token);
 
@@ -863,7 +866,7 @@ void game_actions_open(Game *game) {
                                 }
 
                                 if (object_open == link_get_id(current_link) && link_get_open(current_link) == FALSE) {
-                                        link_set_open(current_link, TRUE);
+                                        game_set_link_open(game, link_get_id(current_link), TRUE);
                                         command_set_success(game_get_last_command(game), OK);
                                         return;
                                 }
@@ -878,32 +881,18 @@ void game_actions_open(Game *game) {
 }
 
 Status game_actions_save(Game *game) {
-        char *command_string = NULL;
-        char *token = NULL;
-        char *filename = NULL;
-        char command_copy[MAX_BUFFER];
+        char filename[MAX_BUFFER];
 
         if (!game) {
                 return ERROR;
         }
 
-        strcpy(command_string, command_get_string_code(game_get_last_command(game)));
-        if (strcpy(command_string, command_get_string_code(game_get_last_command(game))) != 0) {
-                return ERROR;
-        }
-
-        strncpy(command_copy, command_string, sizeof(command_copy) - 1);
-        command_copy[sizeof(command_copy) - 1] = '\0';
-
-        token = strtok(command_copy, " ");
-        if (!token || strcmp(token, "save") != 0) {
-                return ERROR;
-        }
-        token = strtok(NULL, " ");
-        if (!token) {
+        /*The name of the file is the argument of the command*/
+        strncpy(filename, command_get_arg(game_get_last_command(game)), sizeof(filename) - 1);
+        filename[sizeof(filename) - 1] = '\0';
+        if (filename[0] == '\0') {
                 return ERROR;
         }
-        filename = token;
 
         if (game_game_management_save(game, filename) == ERROR) {
                 return ERROR;
@@ -914,32 +903,18 @@ Status game_actions_save(Game *game) {
 }
 
 Status game_actions_load(Game *game) {
-        char *command_string = NULL;
-        char *token = NULL;
-        char *filename = NULL;
-        char command_copy[MAX_BUFFER];
+        char filename[MAX_BUFFER];
 
         if (!game) {
                 return ERROR;
         }
 
-        strcpy(command_string, command_get_string_code(game_get_last_command(game)));
-        if (strcpy(command_string, command_get_string_code(game_get_last_command(game))) != 0) {
-                return ERROR;
-        }
-
-        strncpy(command_copy, command_string, sizeof(command_copy) - 1);
-        command_copy[sizeof(command_copy) - 1] = '\0';
-
-        token = strtok(command_copy, " ");
-        if (!token || strcmp(token, "load") != 0) {
-                return ERROR;
-        }
-        token = strtok(NULL, " ");
-        if (!token) {
+        /*The name of the file is the argument of the command*/
+        strncpy(filename, command_get_arg(game_get_last_command(game)), sizeof(filename) - 1);
+        filename[sizeof(filename) - 1] = '\0';
+        if (filename[0] == '\0') {
                 return ERROR;
         }
-        filename = token;
 
         if (game_game_management_load(game, filename) == ERROR) {
                 return ERROR;
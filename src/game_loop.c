@@ -9,43 +9,84 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
 
 #include "command.h"
 #include "game.h"
 #include "game_actions.h"
 #include "game_rules.h"
-#include "graphic_engine.h"
+#include "journal.h"
+#include "logger.h"
+#include "renderer.h"
 
 /**
- * @brief It starts the game, creating, initializing it as well as its graphic engine
+ * @brief It starts the game, creating, initializing it as well as its renderer
  * @author Profesores PPROG
  *
  * @param game Pointer to pointer to the game being created
- * @param gengine Pointer to pointer to graphic engine
+ * @param renderer Pointer to pointer to the renderer
+ * @param journal Pointer to pointer to the journal, NULL if there is none
+ * @param state Pointer to the state of the rules
  * @param file_name String (the file name)
+ * @param journal_name Name of the journal file, or NULL to play without a journal
+ * @param renderer_name Name of the renderer backend
  * @param deterministic if we activate the deterministic mode or not
  * @return 0 if everyting went well, 1 if there was any error
  */
-int game_loop_init(Game **game, Graphic_engine **gengine, char *file_name, int deterministic);
+int game_loop_init(Game **game, Renderer **renderer, Journal **journal, Rule_state *state, char *file_name,
+                   char *journal_name, char *renderer_name, int deterministic);
+
+/**
+ * @brief Creates the game from its file or, if there is a journal, recovers the session it records
+ * @author Abraham Martín
+ *
+ * @param game Pointer to pointer to the game being created
+ * @param journal Pointer to pointer to the journal, NULL if there is none
+ * @param state Pointer to the state of the rules
+ * @param file_name Name of the game data file
+ * @param journal_name Name of the journal file, or NULL to play without a journal
+ * @param deterministic if we activate the deterministic mode or not, which also fixes the seed of a new game
+ * @return 0 if everyting went well, 1 if there was any error
+ */
+int game_loop_create_game(Game **game, Journal **journal, Rule_state *state, char *file_name, char *journal_name,
+                          int deterministic);
 
 /**
  * @brief Implements the basic game loop for the game to run
  * @author Profesores PPROG
  *
  * @param game Pointer to game being played
- * @param gengine Pointer to the graphic engine
- * @param file Name of the file
+ * @param renderer Pointer to the renderer
+ * @param journal Pointer to the journal, or NULL
+ * @param state Pointer to the state of the rules
+ * @param file Name of the log file, or NULL to play without a log
+ */
+void game_loop_run(Game *game, Renderer *renderer, Journal *journal, Rule_state *state, char *file);
+
+/**
+ * @brief Plays a command script without the graphic engine, printing only the log line of each command
+ * @author Abraham Martín
+ *
+ * @param file_name Name of the game data file
+ * @param script_name Name of the file with one command per line
+ * @param deterministic if we activate the deterministic mode or not
+ * @param log_name Name of the log file, or NULL to print the log through stdout
+ * @param journal_name Name of the journal file, or NULL to play without a journal
+ * @return 0 if everyting went well, 1 if there was any error
  */
-void game_loop_run(Game *game, Graphic_engine *gengine, char *file);
+int game_loop_headless(char *file_name, char *script_name, int deterministic, char *log_name, char *journal_name);
 
 /**
  * @brief Frees up the memory occupied by the game and everything related to it
  * @author Profesores PPROG
  *
  * @param game Pointer to the game being played
- * @param gengine Pointer to the graphic engine
+ * @param renderer Pointer to the renderer
+ * @param journal Pointer to the journal, or NULL
  */
-void game_loop_cleanup(Game *game, Graphic_engine *gengine);
+void game_loop_cleanup(Game *game, Renderer *renderer, Journal *journal);
 
 /**
  *@brief The main function of the project.
@@ -53,13 +94,21 @@ void game_loop_cleanup(Game *game, Graphic_engine *gengine);
  */
 int main(int argc, char *argv[]) {
         Game *game = NULL;
-        Graphic_engine *gengine;
-        char *file = "invalid_file";
+        Renderer *renderer = NULL;
+        Journal *journal = NULL;
+        Rule_state state;
+        char *file = NULL;
+        char *journal_name = NULL;
+        char *renderer_name = "text";
+        char *script = NULL;
         int deterministic = 0;
         int i;
 
         if (argc < 2) {
-                fprintf(stderr, "Use: %s <game_data_file> [-d] [-l <log_file>]\n", argv[0]);
+                fprintf(stderr,
+                        "Use: %s <game_data_file> [-d] [-l <log_file>] [-j <journal_file>] [-r <text|null|json>] "
+                        "[--headless <command_file>]\n",
+                        argv[0]);
                 return 1;
         }
 
@@ -74,92 +123,243 @@ int main(int argc, char *argv[]) {
                                 fprintf(stderr, "ERROR, log file undefined after -l\n");
                                 return 1;
                         }
+                } else if (strcmp(argv[i], "-j") == 0) {
+                        if (i + 1 < argc) {
+                                journal_name = argv[i + 1];
+                                i++;
+                        } else {
+                                fprintf(stderr, "ERROR, journal file undefined after -j\n");
+                                return 1;
+                        }
+                } else if (strcmp(argv[i], "-r") == 0) {
+                        if (i + 1 < argc) {
+                                renderer_name = argv[i + 1];
+                                i++;
+                        } else {
+                                fprintf(stderr, "ERROR, renderer undefined after -r\n");
+                                return 1;
+                        }
+                } else if (strcmp(argv[i], "--headless") == 0) {
+                        if (i + 1 < argc) {
+                                script = argv[i + 1];
+                                i++;
+                        } else {
+                                fprintf(stderr, "ERROR, command file undefined after --headless\n");
+                                return 1;
+                        }
                 } else {
                         fprintf(stderr, "ERROR, unrecognized argument %s\n", argv[i]);
-                        fprintf(stderr, "Valid use: %s <game_data_file> [-d] [-l <log_file>]\n", argv[0]);
+                        fprintf(stderr,
+                                "Valid use: %s <game_data_file> [-d] [-l <log_file>] [-j <journal_file>] [-r <text|null|json>] "
+                                "[--headless <command_file>]\n",
+                                argv[0]);
                         return 1;
                 }
         }
 
-        if (!game_loop_init(&game, &gengine, argv[1], deterministic)) {
-                srand(time(NULL));
-                game_loop_run(game, gengine, file);
-                game_loop_cleanup(game, gengine);
+        /*Without -l the headless log goes to stdout*/
+        if (script) {
+                return game_loop_headless(argv[1], script, deterministic, file, journal_name);
+        }
+
+        if (!game_loop_init(&game, &renderer, &journal, &state, argv[1], journal_name, renderer_name, deterministic)) {
+                game_loop_run(game, renderer, journal, &state, file);
+                game_loop_cleanup(game, renderer, journal);
         }
 
         return 0;
 }
 
-int game_loop_init(Game **game, Graphic_engine **gengine, char *file_name, int deterministic) {
+int game_loop_init(Game **game, Renderer **renderer, Journal **journal, Rule_state *state, char *file_name,
+                   char *journal_name, char *renderer_name, int deterministic) {
         /*Error control*/
-        if ((!game) || (!gengine) || (!file_name)) {
+        if ((!game) || (!renderer) || (!journal) || (!state) || (!file_name) || (!renderer_name)) {
                 fprintf(stderr, "Error while initializing game.\n");
                 return 1;
         }
-        if (game_create_from_file(game, file_name) == ERROR) {
-                fprintf(stderr, "Error while initializing game.\n");
-                game_destroy(*game);
+        if (game_loop_create_game(game, journal, state, file_name, journal_name, deterministic)) {
                 return 1;
-        } else {
+        } else if (strcmp(renderer_name, "text") == 0) {
+                /*Any other renderer may be writing to stdout, so it is kept clean*/
                 printf("Juego creado correctamente");
         }
 
-        game_set_deterministic_mode(*game, deterministic);
-        if (deterministic) {
-                srand(1);
-        } else {
-                srand(time(NULL));
+        if ((*renderer = renderer_create(renderer_name, stdout)) == NULL) {
+                fprintf(stderr, "Error while initializing renderer %s.\n", renderer_name);
+                game_destroy(*game);
+                journal_close(*journal);
+                return 1;
         }
 
-        if ((*gengine = graphic_engine_create()) == NULL) {
-                fprintf(stderr, "Error while initializing graphic engine.\n");
-                game_destroy(*game);
+        return 0;
+}
+
+int game_loop_create_game(Game **game, Journal **journal, Rule_state *state, char *file_name, char *journal_name,
+                          int deterministic) {
+        unsigned long seed = deterministic ? GAME_DEFAULT_SEED : (unsigned long)time(NULL);
+
+        *journal = NULL;
+        state->turn = 1;
+        state->times_feeded = 0;
+        state->spider_is_dead = FALSE;
+
+        if (!journal_name) {
+                if (game_create_from_file(game, file_name) == ERROR) {
+                        fprintf(stderr, "Error while initializing game.\n");
+                        game_destroy(*game);
+                        return 1;
+                }
+                game_set_deterministic_mode(*game, deterministic);
+                game_set_seed(*game, seed);
+                return 0;
+        }
+
+        /*With a journal the session goes on from the last turn it recorded*/
+        if (!(*journal = journal_open(journal_name))) {
+                fprintf(stderr, "Error while opening %s.\n", journal_name);
+                return 1;
+        }
+        if (journal_recover(*journal, game, file_name, state) == ERROR) {
+                fprintf(stderr, "Error while recovering the game from %s.\n", journal_name);
+                journal_close(*journal);
+                *journal = NULL;
                 return 1;
         }
 
+        /*A recovered game goes on with the random numbers it had. A new one is seeded and its snapshot written at once,
+          so the seed is recovered too*/
+        game_set_deterministic_mode(*game, deterministic);
+        if (journal_get_n_records(*journal) == 0) {
+                game_set_seed(*game, seed);
+                if (journal_compact(*journal, *game, state) == ERROR) {
+                        fprintf(stderr, "Error while writing the journal.\n");
+                }
+        }
+
         return 0;
 }
 
-void game_loop_run(Game *game, Graphic_engine *gengine, char *file) {
+void game_loop_run(Game *game, Renderer *renderer, Journal *journal, Rule_state *state, char *file) {
         Command *last_cmd;
+        Logger *logger = NULL;
         char arg[WORD_SIZE + 1];
-
-        /*Variables for the game_rules*/
-        int turns_passed = 1;
-        int times_feeded = 0;
-        Bool spider_is_dead = FALSE;
+        char line[MAX_LOG_LINE];
 
         /*Error control*/
-        if (!gengine) {
+        if (!renderer || !state) {
                 return;
         }
+        if (file && !(logger = logger_create(file))) {
+                fprintf(stderr, "Error while opening %s.\n", file);
+        }
 
         last_cmd = game_get_last_command((const Game *)game);
         strcpy(arg, command_get_arg((const Command *)last_cmd));
 
         while ((command_get_code(last_cmd) != EXIT) && (game_get_finished((const Game *)game) == FALSE)) {
-                graphic_engine_paint_game(gengine, game);
+                renderer_paint(renderer, game);
                 command_get_user_input(last_cmd);
                 game_actions_update(game, last_cmd);
+#ifdef DEBUG
                 printf("Comprobando game_rules...\n");
-                game_rule_update(game, last_cmd, turns_passed, &times_feeded, &spider_is_dead);
-                turns_passed++;
+#endif
+                game_rule_update(game, last_cmd, state->turn, &state->times_feeded, &state->spider_is_dead);
+                state->turn++;
 #ifdef DEBUG
                 game_print((const Game *)game);
 #endif
-                game_write_recent_log((const Game *)game, file);
+                if (logger && game_get_recent_log((const Game *)game, line, MAX_LOG_LINE) == OK) {
+                        logger_append(logger, line);
+                }
+                if (journal && journal_append(journal, game, state) == ERROR) {
+                        fprintf(stderr, "Error while writing the journal.\n");
+                }
         }
 
         if (command_get_code(last_cmd) == EXIT) {
-                graphic_engine_paint_game(gengine, game);
+                renderer_paint(renderer, game);
         }
         if (command_get_code(last_cmd) == ATTACK) {
-                graphic_engine_paint_game(gengine, game);
-                printf("All the players are dead. Game Over.\n");
+                renderer_paint(renderer, game);
+                if (strcmp(renderer_get_name(renderer), "text") == 0) {
+                        printf("All the players are dead. Game Over.\n");
+                }
         }
+
+        logger_destroy(logger);
 }
 
-void game_loop_cleanup(Game *game, Graphic_engine *gengine) {
-        if (gengine) graphic_engine_destroy(gengine);
+void game_loop_cleanup(Game *game, Renderer *renderer, Journal *journal) {
+        if (renderer) renderer_destroy(renderer);
+        if (journal) journal_close(journal);
         if (game) game_destroy(game);
 }
+
+int game_loop_headless(char *file_name, char *script_name, int deterministic, char *log_name, char *journal_name) {
+        Game *game = NULL;
+        Journal *journal = NULL;
+        Rule_state state;
+        Command *last_cmd = NULL;
+        FILE *f = NULL, *log = stdout;
+        char *script = NULL, *line = NULL, *end = NULL, *next = NULL;
+        long size;
+
+        /*The whole script is read at once, each line is parsed in place*/
+        f = fopen(script_name, "rb");
+        if (!f) {
+                fprintf(stderr, "Error while reading %s.\n", script_name);
+                return 1;
+        }
+        if (fseek(f, 0L, SEEK_END) != 0 || (size = ftell(f)) < 0 || fseek(f, 0L, SEEK_SET) != 0 ||
+            !(script = (char *)malloc(size + 1)) || fread(script, 1, size, f) != (size_t)size) {
+                fprintf(stderr, "Error while reading %s.\n", script_name);
+                free(script);
+                fclose(f);
+                return 1;
+        }
+        fclose(f);
+        script[size] = '\0';
+        end = script + size;
+
+        if (game_loop_create_game(&game, &journal, &state, file_name, journal_name, deterministic)) {
+                free(script);
+                return 1;
+        }
+
+        if (log_name && !(log = fopen(log_name, "a"))) {
+                fprintf(stderr, "Error while opening %s.\n", log_name);
+                game_destroy(game);
+                journal_close(journal);
+                free(script);
+                return 1;
+        }
+
+        last_cmd = game_get_last_command((const Game *)game);
+        line = script;
+        while ((command_get_code(last_cmd) != EXIT) && (game_get_finished((const Game *)game) == FALSE) && line < end) {
+                next = memchr(line, '\n', end - line);
+                if (next) {
+                        *next = '\0';
+                } else {
+                        next = end;
+                }
+                command_parse(last_cmd, line);
+                game_actions_update(game, last_cmd);
+                game_rule_update(game, last_cmd, state.turn, &state.times_feeded, &state.spider_is_dead);
+                state.turn++;
+                game_print_recent_log((const Game *)game, log);
+                if (journal && journal_append(journal, game, &state) == ERROR) {
+                        fprintf(stderr, "Error while writing the journal.\n");
+                }
+                line = next + 1;
+        }
+
+        if (log != stdout) {
+                fclose(log);
+        }
+        journal_close(journal);
+        game_destroy(game);
+        free(script);
+
+        return 0;
+}
@@ -9,12 +9,17 @@
  * @copyright GNU Public License
  */
 
+/*strtok_r is POSIX, not ANSI C*/
+#define _POSIX_C_SOURCE 200112L
+
 #include "game_management.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "dat_parser.h"
+
 /**
  * @def EMPTY_LINE
  * @brief Defines an empty row for gdesc
@@ -27,544 +32,670 @@
  */
 #define EMPTY_LINE "         \0"
 
-Status game_management_load_spaces(Game **game, char *file) {
-        int i;
-        char line[WORD_SIZE] = "";
-        char *toks = NULL;
-        Space *space = NULL;
-        Id id = NO_ID;
-        char name[WORD_SIZE] = "";
-        Bool discovered;
-        char gdesc[GDESC_LINES][LINE_LENGTH + 1];
-        FILE *f = NULL;
+/**
+ * @def MIN_PENDING
+ * @brief Defines the number of placements reserved the first time one has to wait for the fix-up pass
+ */
+#define MIN_PENDING 16
 
-        /* Error control */
-        if ((!file) || (!game)) {
-                return ERROR;
-        }
+/**
+ * @brief Placement
+ *
+ * An entity read before the space where it has to be placed.
+ */
+typedef struct _Placement {
+        char kind;   /**< Prefix letter of the entity ('o', 'c' or 'p')*/
+        Id id;       /**< Id of the entity*/
+        Id location; /**< Id of the space*/
+} Placement;
 
-        f = fopen(file, "r");
-        if (!f) {
-                return ERROR;
-        }
+/*
+Private functions
+*/
 
-        while (fgets(line, WORD_SIZE, f)) {
-                if (strncmp("#s:", line, 3) == 0) {
-                        /*id*/
-                        toks = strtok(line + 3, "|\n");
-                        if (!toks) return ERROR;
-                        id = atol(toks);
+/**
+ * @brief Retrieves the next field of the record being read, reporting where it was expected if it is missing
+ * @author Abraham Martín
+ *
+ * @param parser Pointer to the parser of the file
+ * @param what Name of the field, for the error message
+ * @return Pointer to the field, or NULL if the record has no more fields
+ */
+const char *game_management_field(Dat_parser *parser, const char *what);
 
-                        /*names*/
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        strcpy(name, toks);
+/**
+ * @brief Retrieves the next field of the record being read as a string of its own, for the setters that keep it,
+ * reporting where it was expected if it is missing
+ * @author Abraham Martín
+ *
+ * @param parser Pointer to the parser of the file
+ * @param what Name of the field, for the error message
+ * @param buffer Buffer where the field is copied, cut if it does not fit
+ * @param size Number of bytes of the buffer
+ * @return Pointer to the buffer, or NULL if the record has no more fields
+ */
+char *game_management_text(Dat_parser *parser, const char *what, char *buffer, int size);
 
-                        /*Discovered*/
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        discovered = atoi(toks);
+/**
+ * @brief Counts the records of each kind of a file, so the game can be sized before loading it, and rewinds the
+ * parser
+ * @author Abraham Martín
+ *
+ * @param parser Pointer to the parser of the file
+ * @param capacity Pointer to the capacity that will be filled
+ */
+void game_management_count(Dat_parser *parser, Game_capacity *capacity);
 
-                        /*gdesc*/
-                        for (i = 0; i < GDESC_LINES; i++) {
-                                toks = strtok(NULL, "|\n");
-                                if (!toks) {
-                                        strcpy(gdesc[i], EMPTY_LINE);
-                                } else {
-                                        strcpy(gdesc[i], toks);
-                                } /* || strlen(toks) != LINE_LENGTH*/
-                        }
+/**
+ * @brief Creates a space from a "#s:" record and adds it to the game
+ * @author Jorge Ochoa
+ *
+ * @param game Pointer to the game being loaded
+ * @param parser Pointer to the parser, placed at the record
+ * @return OK if everything goes well and ERROR if it couldnt complete its task
+ */
+Status game_management_read_space(Game *game, Dat_parser *parser);
 
-#ifdef DEBUG
-                        printf("Leido: %ld|%s|%u|%s|%s|%s|%s|%s|%s|%s|%s|\n", id, name, discovered, gdesc[0], gdesc[1], gdesc[2],
-                               gdesc[3], gdesc[4], gdesc[5], gdesc[6], gdesc[7]);
-#endif
+/**
+ * @brief Creates an object from a "#o:" record and adds it to the game, without placing it
+ * @author Jorge Ochoa
+ *
+ * @param game Pointer to the game being loaded
+ * @param parser Pointer to the parser, placed at the record
+ * @param id Pointer where the id of the object is returned
+ * @param location Pointer where the id of the space of the object is returned
+ * @return OK if everything goes well and ERROR if it couldnt complete its task
+ */
+Status game_management_read_object(Game *game, Dat_parser *parser, Id *id, Id *location);
 
-                        space = space_create(id);
-                        if (space) {
-                                if (space_set_name(space, name) != OK || space_set_discovered(space, discovered) != OK ||
-                                    space_set_gdesc(space, gdesc) != OK || game_add_space(*game, space) != OK) {
-                                        space_destroy(space);
-                                        return ERROR;
-                                }
-                        }
-                }
-        }
+/**
+ * @brief Creates a character from a "#c:" record and adds it to the game, without placing it
+ * @author Jorge Ochoa
+ *
+ * @param game Pointer to the game being loaded
+ * @param parser Pointer to the parser, placed at the record
+ * @param id Pointer where the id of the character is returned
+ * @param location Pointer where the id of the space of the character is returned
+ * @return OK if everything goes well and ERROR if it couldnt complete its task
+ */
+Status game_management_read_character(Game *game, Dat_parser *parser, Id *id, Id *location);
 
-        if (ferror(f)) {
-                fclose(f);
-                return ERROR;
-        }
+/**
+ * @brief Creates a link from a "#l:" record and adds it to the game
+ * @author Jorge Ochoa
+ *
+ * @param game Pointer to the game being loaded
+ * @param parser Pointer to the parser, placed at the record
+ * @return OK if everything goes well and ERROR if it couldnt complete its task
+ */
+Status game_management_read_link(Game *game, Dat_parser *parser);
 
-        fclose(f);
+/**
+ * @brief Creates a player from a "#p:" record and adds it to the game
+ * @author Jorge Ochoa
+ *
+ * @param game Pointer to the game being loaded
+ * @param parser Pointer to the parser, placed at the record
+ * @param id Pointer where the id of the player is returned
+ * @return OK if everything goes well and ERROR if it couldnt complete its task
+ */
+Status game_management_read_player(Game *game, Dat_parser *parser, Id *id);
 
-        return OK;
-}
+/**
+ * @brief Checks that the space of a loaded player exists and marks it as discovered
+ * @author Jorge Ochoa
+ *
+ * @param game Pointer to the game being loaded
+ * @param id Id of the player
+ * @return OK if everything goes well and ERROR if the space does not exist
+ */
+Status game_management_place_player(Game *game, Id id);
 
-Status game_management_load_objects(Game **game, char *file) {
-        char line[WORD_SIZE] = "";
-        char name[WORD_SIZE] = "";
-        char description[WORD_SIZE] = "";
-        char *toks = NULL;
-        Id id = NO_ID, dependency = NO_ID, open = NO_ID, obj_loc = NO_ID;
+/**
+ * @brief Writes into the game the values of one line of a save file
+ * @author Jorge Ochoa
+ *
+ * @param game Pointer to the game being loaded
+ * @param line Line of the save file, starting with # and the kind of entity
+ * @return OK if everything goes well and ERROR if the line is not complete
+ */
+Status game_management_load_line(Game *game, char *line);
+
+Status game_management_save(Game **game, const char *filename) {
+        FILE *file = NULL;
+        Space *space = NULL;
+        Link *link = NULL;
         Object *object = NULL;
-        int health = 0;
-        Bool movable;
-        FILE *f = NULL;
+        Character *character = NULL;
+        Player *player = NULL;
+        unsigned long random_state[RNG_STATE_SIZE];
+        int i = 0;
 
-        /* Error control */
-        if ((!file) || (!game)) {
+        if (!game || !filename) {
                 return ERROR;
         }
 
-        f = fopen(file, "r");
-        if (f == NULL) {
+        file = fopen(filename, "w");
+        if (file == NULL) {
                 return ERROR;
         }
+        /*Save turn*/
+        fprintf(file, "#t: %d\n", game_get_current_turn(*game));
 
-        while (fgets(line, WORD_SIZE, f)) {
-                if (strncmp("#o:", line, 3) == 0) {
-                        /*id*/
-                        toks = strtok(line + 3, "|\n");
-                        if (!toks) return ERROR;
-                        id = atol(toks);
+        /*Save the random numbers, so the loaded game draws the same ones*/
+        if (game_get_random_state(*game, random_state) == OK) {
+                fprintf(file, "#r:%lu|%lu|%lu|%lu|\n", random_state[0], random_state[1], random_state[2],
+                        random_state[3]);
+        }
 
-                        /*name*/
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        strcpy(name, toks);
+        /*Crear spaces*/
+        for (i = 0; i < game_get_n_spaces(*game); i++) {
+                space = game_get_space_from_index(*game, i);
+                fprintf(file, "#s: %ld|%s|%d|%s|%s|%s|%s|%s|%s|%s|%s|\n", space_get_id(space), space_get_name(space),
+                        space_get_discovered(space), space_get_gdesc(space, 0), space_get_gdesc(space, 1),
+                        space_get_gdesc(space, 2), space_get_gdesc(space, 3), space_get_gdesc(space, 4),
+                        space_get_gdesc(space, 5), space_get_gdesc(space, 6), space_get_gdesc(space, 7));
+        }
 
-                        /*location*/
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        obj_loc = atol(toks);
+        /*Crear links*/
+        for (i = 0; i < game_get_n_links(*game); i++) {
+                link = game_get_link_from_index(*game, i);
+                fprintf(file, "#l:%ld|%s|%ld|%ld|%d|%d|\n", link_get_id(link), link_get_name(link), link_get_origin(link),
+                        link_get_destination(link), link_get_direction(link), link_get_open(link));
+        }
 
-                        /*description*/
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        strcpy(description, toks);
+        /*Crear objects*/
+        for (i = 0; i < game_get_n_objects(*game); i++) {
+                object = game_get_object_from_index(*game, i);
+                fprintf(file, "#o:%ld|%s|%ld|%s|%d|%d|%ld|%ld|\n", object_get_id(object), object_get_name(object),
+                        game_get_object_location(*game, object_get_id(object)), object_get_description(object),
+                        object_get_health(object), object_get_movable(object), object_get_dependency(object),
+                        object_get_open(object));
+        }
 
-                        /*health*/
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        health = atoi(toks);
+        /*Crear characters*/
+        for (i = 0; i < game_get_n_characters(*game); i++) {
+                character = game_get_character_from_index(*game, i);
+                fprintf(file, "#e:%ld|%s|%d|%d|%s|%s|%ld|\n", character_get_id(character), character_get_name(character),
+                        character_get_friendly(character), character_get_health(character), character_get_gdesc(character),
+                        character_get_message(character), character_get_following(character));
+        }
 
-                        /*movable*/
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        movable = atoi(toks);
+        /*Crear players*/
+        for (i = 0; i < game_get_n_players(*game); i++) {
+                player = game_get_player_from_index(*game, i);
+                fprintf(file, "#p:%ld|%s|%s|%ld|%d|%d|\n", player_get_id(player), player_get_name(player),
+                        player_get_gdesc(player), player_get_location(player), player_get_health(player),
+                        player_get_backpack_size(player));
+        }
 
-                        /*dependecy*/
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        dependency = atol(toks);
+        fclose(file);
+        return OK;
+}
 
-                        /*open*/
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        open = atol(toks);
+Status game_management_load_game_from_file(Game **game, char *filename) {
+        Dat_parser *parser = NULL;
+        Placement *pending = NULL, *aux = NULL;
+        Game_capacity counts;
+        int n_pending = 0, max_pending = 0, i;
+        Id id = NO_ID, location = NO_ID;
+        Status status = OK;
+        char kind;
 
-#ifdef DEBUG
-                        printf("Leído: %ld|%s|%ld|%s|%d|%u|%ld|%ld|\n", id, name, obj_loc, description, health, movable,
-                               dependency, open);
-#endif
+        /* Error control */
+        if ((!filename) || (!game)) {
+                return ERROR;
+        }
 
-                        object = object_create(id);
-                        if (object) {
-                                if ((object_set_name(object, name) != OK) ||
-                                    (space_add_object(game_get_space(*game, obj_loc), id) != OK) ||
-                                    (object_set_description(object, description) != OK) ||
-                                    (object_set_health(object, health) != OK) || (object_set_movable(object, movable) != OK) ||
-                                    (object_set_dependency(object, dependency) != OK) || (object_set_open(object, open) != OK)) {
-                                        object_destroy(object);
-                                        return ERROR;
+        parser = dat_parser_create(filename);
+        if (!parser) {
+                return ERROR;
+        }
+
+        /*Counting only looks for the line starts, the fields are read once*/
+        game_management_count(parser, &counts);
+        if (game_create(game, &counts) == ERROR) {
+                dat_parser_destroy(parser);
+                return ERROR;
+        }
+
+        /*One read of the file, anything that points to a space not loaded yet waits for the fix-up pass*/
+        while (status == OK && (kind = dat_parser_next_record(parser)) != '\0') {
+                location = NO_ID;
+                switch (kind) {
+                        case 's':
+                                status = game_management_read_space(*game, parser);
+                                break;
+                        case 'o':
+                                status = game_management_read_object(*game, parser, &id, &location);
+                                if (status == OK && game_get_space((const Game *)(*game), location)) {
+                                        status = game_set_object_location(*game, id, location);
+                                        location = NO_ID;
+                                }
+                                break;
+                        case 'c':
+                                status = game_management_read_character(*game, parser, &id, &location);
+                                if (status == OK && game_get_space((const Game *)(*game), location)) {
+                                        status = game_set_character_location(*game, location, id);
+                                        location = NO_ID;
                                 }
+                                break;
+                        case 'l':
+                                status = game_management_read_link(*game, parser);
+                                break;
+                        case 'p':
+                                status = game_management_read_player(*game, parser, &id);
+                                location = id;
+                                break;
+                        default:
+                                break;
+                }
 
-                                if (game_add_object(*game, object) != OK) {
-                                        object_destroy(object);
-                                        return ERROR;
+                if (status == OK && location != NO_ID) {
+                        if (n_pending == max_pending) {
+                                max_pending = max_pending ? 2 * max_pending : MIN_PENDING;
+                                aux = (Placement *)realloc(pending, max_pending * sizeof(Placement));
+                                if (!aux) {
+                                        status = ERROR;
+                                        break;
                                 }
+                                pending = aux;
                         }
+                        pending[n_pending].kind = kind;
+                        pending[n_pending].id = id;
+                        pending[n_pending].location = location;
+                        n_pending++;
                 }
         }
 
-        if (ferror(f)) {
-                fclose(f);
-                return ERROR;
+        dat_parser_destroy(parser);
+
+        /*Fix-up pass, every space is known now*/
+        for (i = 0; status == OK && i < n_pending; i++) {
+                switch (pending[i].kind) {
+                        case 'o':
+                                status = game_set_object_location(*game, pending[i].id, pending[i].location);
+                                break;
+                        case 'c':
+                                status = game_set_character_location(*game, pending[i].location, pending[i].id);
+                                break;
+                        case 'p':
+                                status = game_management_place_player(*game, pending[i].id);
+                                break;
+                }
         }
 
-        fclose(f);
+        free(pending);
 
-        return OK;
+        return status;
 }
 
-Status game_management_load_characters(Game **game, char *file) {
-        char line[WORD_SIZE] = "";
-        char name[WORD_SIZE] = "";
-        char message[WORD_SIZE] = "";
-        char *toks = NULL;
-        Id id = NO_ID, following = NO_ID, loc = NO_ID;
-        Character *character = NULL;
-        Bool friendly = FALSE;
-        int health = 0;
-        char gdesc[WORD_SIZE] = "";
-        FILE *f = NULL;
+/**
+   Implementation of private functions
+*/
 
-        /* Error control */
-        if ((!file) || (!game)) {
-                return ERROR;
-        }
+const char *game_management_field(Dat_parser *parser, const char *what) {
+        const char *field = NULL;
+        char message[WORD_SIZE];
 
-        f = fopen(file, "r");
-        if (f == NULL) {
-                return ERROR;
+        field = dat_parser_next_field(parser, NULL);
+        if (!field) {
+                sprintf(message, "missing field %s", what);
+                dat_parser_error(parser, message);
         }
 
-        while (fgets(line, WORD_SIZE, f)) {
-                if (strncmp("#c:", line, 3) == 0) {
-                        /* id */
-                        toks = strtok(line + 3, "|\n");
-                        if (!toks) return ERROR;
-                        id = atol(toks);
+        return field;
+}
 
-                        /* name */
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        strcpy(name, toks);
+char *game_management_text(Dat_parser *parser, const char *what, char *buffer, int size) {
+        if (!game_management_field(parser, what)) {
+                return NULL;
+        }
 
-                        /* location */
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        loc = atol(toks);
+        return dat_parser_copy_field(parser, buffer, size);
+}
 
-                        /* friendly */
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        friendly = atoi(toks);
+void game_management_count(Dat_parser *parser, Game_capacity *capacity) {
+        char kind;
+
+        capacity->n_spaces = 0;
+        capacity->n_objects = 0;
+        capacity->n_characters = 0;
+        capacity->n_links = 0;
+        capacity->n_players = 0;
+        while ((kind = dat_parser_next_record(parser)) != '\0') {
+                switch (kind) {
+                        case 's':
+                                capacity->n_spaces++;
+                                break;
+                        case 'o':
+                                capacity->n_objects++;
+                                break;
+                        case 'c':
+                                capacity->n_characters++;
+                                break;
+                        case 'l':
+                                capacity->n_links++;
+                                break;
+                        case 'p':
+                                capacity->n_players++;
+                                break;
+                }
+        }
+        dat_parser_rewind(parser);
+}
 
-                        /* health */
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        health = atoi(toks);
+Status game_management_read_space(Game *game, Dat_parser *parser) {
+        int i;
+        const char *toks = NULL;
+        Space *space = NULL;
+        Id id = NO_ID;
+        char name[WORD_SIZE + 1];
+        Bool discovered;
+        char gdesc[GDESC_LINES][LINE_LENGTH + 1];
 
-                        /* gdesc */
-                        toks = strtok(NULL, "|\n");
-                        if (!toks || strlen(toks) > GDESC_SIZE) return ERROR;
-                        strcpy(gdesc, toks);
+        /*id*/
+        if (!(toks = game_management_field(parser, "id"))) return ERROR;
+        id = atol(toks);
 
-                        /* message */
-                        toks = strtok(NULL, "|\n");
-                        if (toks) {
-                                strcpy(message, toks);
-                        } else {
-                                strcpy(message, "");
-                        }
+        /*names*/
+        if (!game_management_text(parser, "name", name, WORD_SIZE + 1)) return ERROR;
 
-                        /* following */
-                        toks = strtok(NULL, "|\n");
-                        if (toks) {
-                                following = atol(toks);
-                        } else {
-                                following = NO_ID;
-                        }
+        /*Discovered*/
+        if (!(toks = game_management_field(parser, "discovered"))) return ERROR;
+        discovered = atoi(toks);
+
+        /*gdesc*/
+        for (i = 0; i < GDESC_LINES; i++) {
+                if (!dat_parser_next_field(parser, NULL)) {
+                        strcpy(gdesc[i], EMPTY_LINE);
+                } else {
+                        dat_parser_copy_field(parser, gdesc[i], LINE_LENGTH + 1);
+                } /* || strlen(toks) != LINE_LENGTH*/
+        }
 
 #ifdef DEBUG
-                        printf("Leído: %ld|%s|%ld|%d|%d|%s|%s|%ld|\n", id, name, loc, friendly, health, gdesc, message,
-                               following);
+        printf("Leido: %ld|%s|%u|%s|%s|%s|%s|%s|%s|%s|%s|\n", id, name, discovered, gdesc[0], gdesc[1], gdesc[2], gdesc[3],
+               gdesc[4], gdesc[5], gdesc[6], gdesc[7]);
 #endif
 
-                        character = character_create(id);
-                        if (character != NULL) {
-                                if ((character_set_name(character, name) != OK) ||
-
-                                    (character_set_friendly(character, friendly) != OK) ||
-                                    (character_set_health(character, health) != OK) ||
-                                    (character_set_gdesc(character, gdesc) != OK) ||
-                                    (character_set_message(character, message) != OK) ||
-                                    (character_set_following(character, following) != OK) ||
-                                    (game_add_character(*game, character) != OK)) {
-                                        character_destroy(character);
-                                        return ERROR;
-                                }
-
-                                if ((space_add_character(game_get_space(*game, loc), id) != OK)) {
-                                        character_destroy(character);
-                                        return ERROR;
-                                }
-                        }
+        space = space_create(id);
+        if (space) {
+                if (space_set_name(space, name) != OK || space_set_discovered(space, discovered) != OK ||
+                    space_set_gdesc(space, gdesc) != OK || game_add_space(game, space) != OK) {
+                        space_destroy(space);
+                        return ERROR;
                 }
         }
 
-        if (ferror(f)) {
-                fclose(f);
-                return ERROR;
-        }
-
-        fclose(f);
-
         return OK;
 }
 
-Status game_management_load_links(Game **game, char *file) {
-        char line[WORD_SIZE] = "";
-        char name[WORD_SIZE] = "";
-        char *toks = NULL;
-        Id id = NO_ID, orig_id = NO_ID, dest_id = NO_ID;
-        Bool open = FALSE;
-        Direction direction = NO_DIRECTION;
-        Link *link = NULL;
-        FILE *f = NULL;
+Status game_management_read_object(Game *game, Dat_parser *parser, Id *id, Id *location) {
+        char name[WORD_SIZE];
+        char description[WORD_SIZE];
+        const char *toks = NULL;
+        Id dependency = NO_ID, open = NO_ID;
+        Object *object = NULL;
+        int health = 0;
+        Bool movable;
 
-        /* Error control */
-        if ((!file) || (!game)) {
-                return ERROR;
-        }
+        /*id*/
+        if (!(toks = game_management_field(parser, "id"))) return ERROR;
+        *id = atol(toks);
 
-        f = fopen(file, "r");
-        if (f == NULL) {
-                return ERROR;
-        }
+        /*name*/
+        if (!game_management_text(parser, "name", name, WORD_SIZE)) return ERROR;
 
-        while (fgets(line, WORD_SIZE, f)) {
-                /*#l:57|Passage|19|25|1|1|*/
-                if (strncmp("#l:", line, 3) == 0) {
-                        /*id*/
-                        toks = strtok(line + 3, "|\n");
-                        if (!toks) return ERROR;
-                        id = atol(toks);
+        /*location*/
+        if (!(toks = game_management_field(parser, "location"))) return ERROR;
+        *location = atol(toks);
 
-                        /*name*/
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        strcpy(name, toks);
+        /*description*/
+        if (!game_management_text(parser, "description", description, WORD_SIZE)) return ERROR;
 
-                        /*origin*/
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        orig_id = atol(toks);
+        /*health*/
+        if (!(toks = game_management_field(parser, "health"))) return ERROR;
+        health = atoi(toks);
 
-                        /*destination*/
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        dest_id = atol(toks);
+        /*movable*/
+        if (!(toks = game_management_field(parser, "movable"))) return ERROR;
+        movable = atoi(toks);
 
-                        /*direction*/
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        direction = atoi(toks);
+        /*dependecy*/
+        if (!(toks = game_management_field(parser, "dependency"))) return ERROR;
+        dependency = atol(toks);
 
-                        /*open*/
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        open = atoi(toks);
+        /*open*/
+        if (!(toks = game_management_field(parser, "open"))) return ERROR;
+        open = atol(toks);
 
 #ifdef DEBUG
-                        printf("Leído: %ld|%s|%ld|%ld|%d|%d|\n", id, name, orig_id, dest_id, direction, open);
+        printf("Leído: %ld|%s|%ld|%s|%d|%u|%ld|%ld|\n", *id, name, *location, description, health, movable, dependency, open);
 #endif
 
-                        link = link_create(id);
-                        if (link != NULL) {
-                                if ((link_set_name(link, name) != OK) || (link_set_origin(link, orig_id) != OK) ||
-                                    (link_set_destination(link, dest_id) != OK) || (link_set_direction(link, direction) != OK) ||
-                                    (link_set_open(link, open) != OK) || (game_add_link(*game, link) != OK)) {
-                                        link_destroy(link);
-                                        return ERROR;
-                                }
-                        }
+        object = object_create(*id);
+        if (object) {
+                if ((object_set_name(object, name) != OK) || (object_set_description(object, description) != OK) ||
+                    (object_set_health(object, health) != OK) || (object_set_movable(object, movable) != OK) ||
+                    (object_set_dependency(object, dependency) != OK) || (object_set_open(object, open) != OK) ||
+                    (game_add_object(game, object) != OK)) {
+                        object_destroy(object);
+                        return ERROR;
                 }
         }
-        if (ferror(f)) {
-                fclose(f);
-                return ERROR;
-        }
-
-        fclose(f);
 
         return OK;
 }
 
-Status game_management_load_players(Game **game, char *file) {
-        char line[WORD_SIZE] = "";
-        char name[WORD_SIZE] = "";
-        char *toks = NULL;
-        char gdesc[P_GDESC_LENGTH + 1];
-        int health, backpack_size;
-        Id id = NO_ID, loc_id = NO_ID;
-        Player *player = NULL;
-        Space *space = NULL;
-        FILE *f = NULL;
+Status game_management_read_character(Game *game, Dat_parser *parser, Id *id, Id *location) {
+        char name[WORD_SIZE];
+        char message[WORD_SIZE];
+        const char *toks = NULL;
+        Id following = NO_ID;
+        Character *character = NULL;
+        Bool friendly = FALSE;
+        int health = 0;
+        char gdesc[GDESC_SIZE + 1];
 
-        /* Error control */
-        if ((!file) || (!game)) {
-                return ERROR;
-        }
+        /* id */
+        if (!(toks = game_management_field(parser, "id"))) return ERROR;
+        *id = atol(toks);
 
-        f = fopen(file, "r");
-        if (f == NULL) {
-                return ERROR;
-        }
+        /* name */
+        if (!game_management_text(parser, "name", name, WORD_SIZE)) return ERROR;
 
-        while (fgets(line, WORD_SIZE, f)) {
-                /*#p:2|mouse|_Oo|01|5|3| */
-                if (strncmp("#p:", line, 3) == 0) {
-                        /*id*/
-                        toks = strtok(line + 3, "|\n");
-                        if (!toks) return ERROR;
-                        id = atol(toks);
+        /* location */
+        if (!(toks = game_management_field(parser, "location"))) return ERROR;
+        *location = atol(toks);
 
-                        /*name*/
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        strcpy(name, toks);
+        /* friendly */
+        if (!(toks = game_management_field(parser, "friendly"))) return ERROR;
+        friendly = atoi(toks);
 
-                        /*gdesc*/
-                        toks = strtok(NULL, "|\n");
-                        if (!toks || strlen(toks) > P_GDESC_LENGTH) return ERROR;
-                        strcpy(gdesc, toks);
-
-                        /*loc_id*/
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        loc_id = atol(toks);
+        /* health */
+        if (!(toks = game_management_field(parser, "health"))) return ERROR;
+        health = atoi(toks);
 
-                        /*space*/
-                        space = game_get_space((const Game *)(*game), loc_id);
-                        if (!space) return ERROR;
+        /* gdesc */
+        if (!game_management_field(parser, "gdesc")) return ERROR;
+        if (dat_parser_get_field_length(parser) > GDESC_SIZE) {
+                dat_parser_error(parser, "gdesc too long");
+                return ERROR;
+        }
+        dat_parser_copy_field(parser, gdesc, GDESC_SIZE + 1);
 
-                        /*health*/
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        health = atoi(toks);
+        /* message */
+        if (dat_parser_next_field(parser, NULL)) {
+                dat_parser_copy_field(parser, message, WORD_SIZE);
+        } else {
+                message[0] = '\0';
+        }
 
-                        /*backpack_size*/
-                        toks = strtok(NULL, "|\n");
-                        if (!toks) return ERROR;
-                        backpack_size = atoi(toks);
+        /* following */
+        toks = dat_parser_next_field(parser, NULL);
+        if (toks) {
+                following = atol(toks);
+        } else {
+                following = NO_ID;
+        }
 
 #ifdef DEBUG
-                        printf("Leído: %ld|%s|%s|%ld|%d|%d|\n", id, name, gdesc, loc_id, health, backpack_size);
+        printf("Leído: %ld|%s|%ld|%d|%d|%s|%s|%ld|\n", *id, name, *location, friendly, health, gdesc, message, following);
 #endif
 
-                        player = player_create(id);
-                        if (player != NULL) {
-                                if ((player_set_name(player, name) != OK) || (player_set_gdesc(player, gdesc) != OK) ||
-                                    (player_set_location(player, loc_id) != OK) || (player_set_health(player, health) != OK) ||
-                                    (player_set_backpack_size(player, backpack_size) != OK) ||
-                                    (game_add_player(*game, player) != OK)) {
-                                        player_destroy(player);
-                                        fclose(f);
-                                        return ERROR;
-                                } else {
-                                        space_set_discovered(space, TRUE);
-                                }
-                        } else {
-                                fclose(f);
-                                return ERROR;
-                        }
+        character = character_create(*id);
+        if (character != NULL) {
+                if ((character_set_name(character, name) != OK) || (character_set_friendly(character, friendly) != OK) ||
+                    (character_set_health(character, health) != OK) || (character_set_gdesc(character, gdesc) != OK) ||
+                    (character_set_message(character, message) != OK) ||
+                    (character_set_following(character, following) != OK) || (game_add_character(game, character) != OK)) {
+                        character_destroy(character);
+                        return ERROR;
                 }
         }
-        if (ferror(f)) {
-                fclose(f);
-                return ERROR;
-        }
-
-        fclose(f);
 
         return OK;
 }
 
-Status game_management_save(Game **game, const char *filename) {
-        FILE *file = NULL;
-        Space *space = NULL;
+Status game_management_read_link(Game *game, Dat_parser *parser) {
+        char name[WORD_SIZE];
+        const char *toks = NULL;
+        Id id = NO_ID, orig_id = NO_ID, dest_id = NO_ID;
+        Bool open = FALSE;
+        Direction direction = NO_DIRECTION;
         Link *link = NULL;
-        Object *object = NULL;
-        Character *character = NULL;
-        Player *player = NULL;
-        int i = 0;
 
-        if (!game || !filename) {
-                return ERROR;
-        }
+        /*id*/
+        if (!(toks = game_management_field(parser, "id"))) return ERROR;
+        id = atol(toks);
 
-        file = fopen(filename, "w");
-        if (file == NULL) {
-                return ERROR;
-        }
-        /*Save turn*/
-        fprintf(file, "#t: %d", game_get_current_turn(*game));
+        /*name*/
+        if (!game_management_text(parser, "name", name, WORD_SIZE)) return ERROR;
 
-        /*Crear spaces*/
-        for (i = 0; i < game_get_n_spaces(*game); i++) {
-                space = game_get_space_from_index(*game, i);
-                fprintf(file, "#s: %ld|%s|%c|%s|%s|%s|%s|%s|%s|%s|%s|\n", space_get_id(space), space_get_name(space),
-                        space_get_discovered(space), space_get_gdesc(space, 0), space_get_gdesc(space, 1),
-                        space_get_gdesc(space, 2), space_get_gdesc(space, 3), space_get_gdesc(space, 4),
-                        space_get_gdesc(space, 5), space_get_gdesc(space, 6), space_get_gdesc(space, 7));
-        }
+        /*origin*/
+        if (!(toks = game_management_field(parser, "origin"))) return ERROR;
+        orig_id = atol(toks);
 
-        /*Crear links*/
-        for (i = 0; i < game_get_n_links(*game); i++) {
-                link = game_get_link_from_index(*game, i);
-                fprintf(file, "#l:%ld|%s|%ld|%ld|%d|%d|\n", link_get_id(link), link_get_name(link), link_get_origin(link),
-                        link_get_destination(link), link_get_direction(link), link_get_open(link));
-        }
+        /*destination*/
+        if (!(toks = game_management_field(parser, "destination"))) return ERROR;
+        dest_id = atol(toks);
 
-        /*Crear objects*/
-        for (i = 0; i < game_get_n_objects(*game); i++) {
-                object = game_get_object_from_index(*game, i);
-                fprintf(file, "#o:%ld|%s|%ld|%s|%d|%d|%ld|%ld|\n", object_get_id(object), object_get_name(object),
-                        game_get_object_location(*game, object_get_id(object)), object_get_description(object),
-                        object_get_health(object), object_get_movable(object), object_get_dependency(object),
-                        object_get_open(object));
-        }
+        /*direction*/
+        if (!(toks = game_management_field(parser, "direction"))) return ERROR;
+        direction = atoi(toks);
 
-        /*Crear characters*/
-        for (i = 0; i < game_get_n_characters(*game); i++) {
-                character = game_get_character_from_index(*game, i);
-                fprintf(file, "#e:%ld|%s|%d|%d|%s|%s|%ld|\n", character_get_id(character), character_get_name(character),
-                        character_get_friendly(character), character_get_health(character), character_get_gdesc(character),
-                        character_get_message(character), character_get_following(character));
-        }
+        /*open*/
+        if (!(toks = game_management_field(parser, "open"))) return ERROR;
+        open = atoi(toks);
 
-        /*Crear players*/
-        for (i = 0; i < game_get_n_players(*game); i++) {
-                player = game_get_player_from_index(*game, i);
-                fprintf(file, "#p:%ld|%s|%ld|%d|%d|\n", player_get_id(player), player_get_name(player),
-                        game_get_player_location(*game), player_get_health(player), player_get_num_objects(player));
+#ifdef DEBUG
+        printf("Leído: %ld|%s|%ld|%ld|%d|%d|\n", id, name, orig_id, dest_id, direction, open);
+#endif
+
+        link = link_create(id);
+        if (link != NULL) {
+                if ((link_set_name(link, name) != OK) || (link_set_origin(link, orig_id) != OK) ||
+                    (link_set_destination(link, dest_id) != OK) || (link_set_direction(link, direction) != OK) ||
+                    (link_set_open(link, open) != OK) || (game_add_link(game, link) != OK)) {
+                        link_destroy(link);
+                        return ERROR;
+                }
         }
 
-        fclose(file);
         return OK;
 }
 
-Status game_management_load_game_from_file(Game **game, char *filename) {
-        if (!game) {
+Status game_management_read_player(Game *game, Dat_parser *parser, Id *id) {
+        char name[WORD_SIZE + 1];
+        const char *toks = NULL;
+        char gdesc[P_GDESC_LENGTH + 1];
+        int health, backpack_size;
+        Id loc_id = NO_ID;
+        Player *player = NULL;
+
+        /*id*/
+        if (!(toks = game_management_field(parser, "id"))) return ERROR;
+        *id = atol(toks);
+
+        /*name*/
+        if (!game_management_text(parser, "name", name, WORD_SIZE + 1)) return ERROR;
+
+        /*gdesc*/
+        if (!game_management_field(parser, "gdesc")) return ERROR;
+        if (dat_parser_get_field_length(parser) > P_GDESC_LENGTH) {
+                dat_parser_error(parser, "gdesc too long");
                 return ERROR;
         }
+        dat_parser_copy_field(parser, gdesc, P_GDESC_LENGTH + 1);
+
+        /*loc_id*/
+        if (!(toks = game_management_field(parser, "location"))) return ERROR;
+        loc_id = atol(toks);
+
+        /*health*/
+        if (!(toks = game_management_field(parser, "health"))) return ERROR;
+        health = atoi(toks);
+
+        /*backpack_size*/
+        if (!(toks = game_management_field(parser, "backpack size"))) return ERROR;
+        backpack_size = atoi(toks);
+
+#ifdef DEBUG
+        printf("Leído: %ld|%s|%s|%ld|%d|%d|\n", *id, name, gdesc, loc_id, health, backpack_size);
+#endif
 
-        if (game_management_load_spaces(game, filename) == ERROR) {
+        player = player_create(*id);
+        if (player == NULL) {
                 return ERROR;
         }
-        if (game_management_load_players(game, filename) == ERROR) {
+        if ((player_set_name(player, name) != OK) || (player_set_gdesc(player, gdesc) != OK) ||
+            (player_set_location(player, loc_id) != OK) || (player_set_health(player, health) != OK) ||
+            (player_set_backpack_size(player, backpack_size) != OK) || (game_add_player(game, player) != OK)) {
+                player_destroy(player);
                 return ERROR;
         }
-        if (game_management_load_objects(game, filename) == ERROR) {
+
+        return OK;
+}
+
+Status game_management_place_player(Game *game, Id id) {
+        Space *space = NULL;
+
+        space = game_get_space((const Game *)game, player_get_location(game_get_player_from_id((const Game *)game, id)));
+        if (!space) return ERROR;
+
+        return space_set_discovered(space, TRUE);
+}
+
+Status game_management_load(Game **game, const char *file) {
+        FILE *f = NULL;
+        char line[MAX_LINES];
+        Status status = OK;
+
+        if (!game || !file) {
                 return ERROR;
         }
-        if (game_management_load_characters(game, filename) == ERROR) {
+
+        f = fopen(file, "r");
+        if (!f) {
                 return ERROR;
         }
-        if (game_management_load_links(game, filename) == ERROR) {
-                return ERROR;
+
+        /*The file is closed even if a line cannot be read, the game half loaded is then up to the caller*/
+        while (status == OK && fgets(line, sizeof(line), f)) {
+                if (line[0] == '#') {
+                        status = game_management_load_line(*game, line);
+                }
         }
 
-        return OK;
+        fclose(f);
+        return status;
 }
 
-Status game_management_load(Game **game, const char *file) {
-        FILE *f = NULL;
-        char line[MAX_LINES];
+Status game_management_load_line(Game *game, char *line) {
         char *toks = NULL;
+        char *rest = NULL;
         Character *character = NULL;
         Player *player = NULL;
         Object *object = NULL;
@@ -578,176 +709,176 @@ Status game_management_load(Game **game, const char *file) {
         char gdesc[WORD_SIZE];
         char gdesc_spaces[GDESC_LINES][LINE_LENGTH + 1];
         char message[MAX_LINES];
+        unsigned long random_state[RNG_STATE_SIZE];
         Bool movable, discovered;
         Direction direction;
 
-        if (!game || !file) {
+        if (!game || !line) {
                 return ERROR;
         }
 
-        f = fopen(file, "r");
-        if (!f) {
-                return ERROR;
-        }
-
-        while (fgets(line, sizeof(line), f)) {
-                if (line[0] == '#') {
-                        switch (line[1]) {
-                                case 't': {
-                                        sscanf(line, "#t:%d", &turn);
-                                        game_set_turn(*game, turn);
-                                        break;
-                                }
-                                case 's': {
-                                        toks = strtok(line + 3, "|\n");
-                                        if (!toks) return ERROR;
-                                        id = atol(toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks) return ERROR;
-                                        strcpy(name, toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks) return ERROR;
-                                        discovered = atoi(toks);
-                                        for (i = 0; i < GDESC_LINES; i++) {
-                                                toks = strtok(NULL, "|\n");
-                                                if (!toks || strlen(toks) != LINE_LENGTH) {
-                                                        strcpy(gdesc_spaces[i], EMPTY_LINE);
-                                                } else {
-                                                        strcpy(gdesc_spaces[i], toks);
-                                                }
-                                        }
-                                        space = game_get_space(*game, id);
-                                        space_set_name(space, name);
-                                        space_set_discovered(space, discovered);
-                                        space_set_gdesc(space, gdesc_spaces);
-                                        break;
-                                }
-                                case 'p': {
-                                        toks = strtok(line + 3, "|\n");
-                                        if (!toks) return ERROR;
-                                        id = atol(toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks) return ERROR;
-                                        strcpy(name, toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks || strlen(toks) > P_GDESC_LENGTH) return ERROR;
-                                        strcpy(gdesc, toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks) return ERROR;
-                                        loc_id = atol(toks);
-                                        space = game_get_space(*game, loc_id);
-                                        if (!space) return ERROR;
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks) return ERROR;
-                                        health = atoi(toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks) return ERROR;
-                                        backpack_size = atoi(toks);
-                                        player = game_get_player_from_id(*game, id);
-                                        player_set_name(player, name);
-                                        player_set_location(player, loc_id);
-                                        player_set_health(player, health);
-                                        player_set_gdesc(player, gdesc);
-                                        player_set_backpack_size(player, backpack_size);
-                                        break;
-                                }
-                                case 'o': {
-                                        toks = strtok(line + 3, "|\n");
-                                        if (!toks) return ERROR;
-                                        id = atol(toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks) return ERROR;
-                                        strcpy(name, toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks) return ERROR;
-                                        strcpy(gdesc, toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks) return ERROR;
-                                        health = atoi(toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks) return ERROR;
-                                        movable = atoi(toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks) return ERROR;
-                                        dependency = atol(toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks) return ERROR;
-                                        open = atol(toks);
-                                        object = game_get_object_from_id(*game, id);
-                                        object_set_name(object, name);
-                                        object_set_description(object, gdesc);
-                                        object_set_health(object, health);
-                                        object_set_dependency(object, dependency);
-                                        object_set_movable(object, movable);
-                                        object_set_open(object, open);
-                                        break;
-                                }
-                                case 'c': {
-                                        toks = strtok(line + 3, "|\n");
-                                        if (!toks) return ERROR;
-                                        id = atol(toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks) return ERROR;
-                                        strcpy(name, toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks) return ERROR;
-                                        friendly = atoi(toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks) return ERROR;
-                                        health = atoi(toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks || strlen(toks) > GDESC_SIZE) return ERROR;
-                                        strcpy(gdesc, toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (toks) {
-                                                strcpy(message, toks);
-                                        } else {
-                                                strcpy(message, "");
-                                        }
-                                        toks = strtok(NULL, "|\n");
-                                        if (toks) {
-                                                following = atol(toks);
-                                        } else {
-                                                following = NO_ID;
-                                        }
-                                        character = game_get_character_from_name(*game, name);
-                                        character_set_name(character, name);
-                                        character_set_gdesc(character, gdesc);
-                                        character_set_friendly(character, friendly);
-                                        character_set_message(character, message);
-                                        character_set_following(character, following);
-                                        break;
-                                }
-                                case 'l': {
-                                        toks = strtok(line + 3, "|\n");
-                                        if (!toks) return ERROR;
-                                        id = atol(toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks) return ERROR;
-                                        strcpy(name, toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks) return ERROR;
-                                        orig_id = atol(toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks) return ERROR;
-                                        dest_id = atol(toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks) return ERROR;
-                                        direction = atoi(toks);
-                                        toks = strtok(NULL, "|\n");
-                                        if (!toks) return ERROR;
-                                        open = atoi(toks);
-                                        link = game_get_link_from_name(*game, name);
-                                        link_set_name(link, name);
-                                        link_set_origin(link, orig_id);
-                                        link_set_destination(link, dest_id);
-                                        link_set_direction(link, direction);
-                                        break;
+        switch (line[1]) {
+                case 't': {
+                        sscanf(line, "#t:%d", &turn);
+                        game_set_turn(game, turn);
+                        break;
+                }
+                case 'r': {
+                        if (sscanf(line, "#r:%lu|%lu|%lu|%lu|", &random_state[0], &random_state[1],
+                                   &random_state[2], &random_state[3]) != RNG_STATE_SIZE ||
+                            game_set_random_state(game, random_state) == ERROR) {
+                                return ERROR;
+                        }
+                        break;
+                }
+                case 's': {
+                        toks = strtok_r(line + 3, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        id = atol(toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        strcpy(name, toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        discovered = atoi(toks);
+                        for (i = 0; i < GDESC_LINES; i++) {
+                                toks = strtok_r(NULL, "|\n", &rest);
+                                if (!toks || strlen(toks) != LINE_LENGTH) {
+                                        strcpy(gdesc_spaces[i], EMPTY_LINE);
+                                } else {
+                                        strcpy(gdesc_spaces[i], toks);
                                 }
                         }
+                        space = game_get_space(game, id);
+                        space_set_name(space, name);
+                        space_set_discovered(space, discovered);
+                        space_set_gdesc(space, gdesc_spaces);
+                        break;
+                }
+                case 'p': {
+                        toks = strtok_r(line + 3, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        id = atol(toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        strcpy(name, toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks || strlen(toks) > P_GDESC_LENGTH) return ERROR;
+                        strcpy(gdesc, toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        loc_id = atol(toks);
+                        space = game_get_space(game, loc_id);
+                        if (!space) return ERROR;
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        health = atoi(toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        backpack_size = atoi(toks);
+                        player = game_get_player_from_id(game, id);
+                        player_set_name(player, name);
+                        player_set_location(player, loc_id);
+                        player_set_health(player, health);
+                        player_set_gdesc(player, gdesc);
+                        player_set_backpack_size(player, backpack_size);
+                        break;
+                }
+                case 'o': {
+                        toks = strtok_r(line + 3, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        id = atol(toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        strcpy(name, toks);
+                        /*The location is skipped, the objects stay where they are*/
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        strcpy(gdesc, toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        health = atoi(toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        movable = atoi(toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        dependency = atol(toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        open = atol(toks);
+                        object = game_get_object_from_id(game, id);
+                        game_set_object_name(game, id, name);
+                        object_set_description(object, gdesc);
+                        object_set_health(object, health);
+                        object_set_dependency(object, dependency);
+                        object_set_movable(object, movable);
+                        object_set_open(object, open);
+                        break;
+                }
+                case 'e': {
+                        toks = strtok_r(line + 3, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        id = atol(toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        strcpy(name, toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        friendly = atoi(toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        health = atoi(toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks || strlen(toks) > GDESC_SIZE) return ERROR;
+                        strcpy(gdesc, toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (toks) {
+                                strcpy(message, toks);
+                        } else {
+                                strcpy(message, "");
+                        }
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (toks) {
+                                following = atol(toks);
+                        } else {
+                                following = NO_ID;
+                        }
+                        character = game_get_character_from_name(game, name);
+                        character_set_name(character, name);
+                        character_set_gdesc(character, gdesc);
+                        character_set_friendly(character, friendly);
+                        character_set_message(character, message);
+                        game_set_character_following(game, character_get_id(character), following);
+                        break;
+                }
+                case 'l': {
+                        toks = strtok_r(line + 3, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        id = atol(toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        strcpy(name, toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        orig_id = atol(toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        dest_id = atol(toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        direction = atoi(toks);
+                        toks = strtok_r(NULL, "|\n", &rest);
+                        if (!toks) return ERROR;
+                        open = atoi(toks);
+                        link = game_get_link_from_name(game, name);
+                        link_set_name(link, name);
+                        game_set_link_connection(game, link_get_id(link), orig_id, dest_id, direction);
+                        break;
                 }
         }
 
-        fclose(f);
         return OK;
 }
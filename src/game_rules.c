@@ -177,6 +177,11 @@ Status game_rule_update(Game* game, Command* last_cmd, int turn, int* times_feed
                 return ERROR;
         }
 
+        /*Undoing or redoing a turn is not a turn itself*/
+        if (command_get_code(last_cmd) == UNDO || command_get_code(last_cmd) == REDO) {
+                return OK;
+        }
+
         strcpy(arg, command_get_arg((const Command*)last_cmd));
 
         /*if ((game_get_n_players(game)) == 1) {
@@ -209,14 +214,14 @@ Status game_rule_update(Game* game, Command* last_cmd, int turn, int* times_feed
         if (character_get_name(game_get_character_from_name(game, "spider")) != NULL) {
                 if ((strcasecmp(character_get_name(game_get_character_from_name(game, "spider")), arg) == 0) &&
                     ((character_get_health(game_get_character_from_name(game, arg))) <= 0) && ((*spider_is_dead) == FALSE)) {
-                        *spider_is_dead = TRUE;
-                        character_set_name(game_get_character_from_name(game, "spider"), "spider_");
+                        game_set_rule_flag(game, spider_is_dead, TRUE);
+                        game_set_character_name(game, character_get_id(game_get_character_from_name(game, "spider")), "spider_");
                 }
         }
 
         if ((*spider_is_dead) == TRUE) {
                 if (game_rule_spider_dies(game) == OK) {
-                        *spider_is_dead = FALSE;
+                        game_set_rule_flag(game, spider_is_dead, FALSE);
                         return OK;
                 }
         }
@@ -224,7 +229,7 @@ Status game_rule_update(Game* game, Command* last_cmd, int turn, int* times_feed
         /*Feed queen condition*/ /*No testeado, (Error en Use)*/
         if ((command_get_code(last_cmd) == USE) && (strcasecmp(command_get_arg(last_cmd), "Food over Queen_Ant") == 0) &&
             (command_get_success(last_cmd) == OK)) {
-                ++(*times_feeded);
+                game_set_rule_value(game, times_feeded, *times_feeded + 1);
         }
 
         if (*times_feeded == 5) {
@@ -352,8 +357,7 @@ Status game_rule_spider_dies(Game* game) {
         }
 
         /*CAMBIAR POR SPIDER_LOCATION*/
-        if (space_add_object(game_get_space((const Game*)game, 3), FANG_ID) == ERROR ||
-            space_add_object(game_get_space((const Game*)game, 3), STRING_ID) == ERROR) {
+        if (game_set_object_location(game, FANG_ID, 3) == ERROR || game_set_object_location(game, STRING_ID, 3) == ERROR) {
                 object_destroy(fangs);
                 object_destroy(string);
                 return ERROR;
@@ -400,7 +404,7 @@ Status game_rule_feed_queen(Game* game) {
                 return ERROR;
         }
 
-        if (space_add_character(game_get_space((const Game*)game, QUEEN_ANT_LOCATION), NEW_ANT_ID) == ERROR) {
+        if (game_set_character_location(game, QUEEN_ANT_LOCATION, NEW_ANT_ID) == ERROR) {
                 character_destroy(ally_ant);
                 return ERROR;
         }
@@ -436,7 +440,7 @@ Status game_rule_ant_invasion(Game* game) {
                 character_destroy(ant1);
                 return ERROR;
         }
-        if ((space_add_character(game_get_space((const Game*)game, ANTS_SPAWN_LOCATION), ANT1_ID) == ERROR)) {
+        if ((game_set_character_location(game, ANTS_SPAWN_LOCATION, ANT1_ID) == ERROR)) {
                 character_destroy(ant1);
                 return ERROR;
         }
@@ -454,5 +458,5 @@ Status game_rule_attack_with_fangs(Game* game) {
                 return ERROR;
         }
 
-        return game_set_player_damage(game_get_last_player((const Game*)game), FANG_DAMAGE);
+        return game_set_player_damage(game, game_get_last_player((const Game*)game), FANG_DAMAGE);
 }
@@ -0,0 +1,670 @@
+/**
+ * @brief It implements the game server, that plays many independent games in one process, one for each client. One
+ * thread waits for the sockets and a pool of workers plays the sessions that are ready
+ *
+ * @file game_server.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 24-05-2025
+ * @copyright GNU Public License
+ */
+
+/*The sockets, epoll and the file descriptors are POSIX and Linux, not ANSI C*/
+#define _POSIX_C_SOURCE 200112L
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "command.h"
+#include "game.h"
+#include "game_actions.h"
+#include "game_rules.h"
+#include "types.h"
+#include "worker_pool.h"
+
+/**
+ * @def SERVER_DEFAULT_PORT
+ * @brief Defines the TCP port the server listens on when no other address is given
+ */
+#define SERVER_DEFAULT_PORT 7777
+
+/**
+ * @def SERVER_MAX_SESSIONS
+ * @brief Defines the max number of clients playing at the same time, the next ones are refused
+ */
+#define SERVER_MAX_SESSIONS 1024
+
+/**
+ * @def SERVER_MAX_EVENTS
+ * @brief Defines the max number of ready sockets handled in each round of the loop
+ */
+#define SERVER_MAX_EVENTS 64
+
+/**
+ * @def SERVER_BACKLOG
+ * @brief Defines the max number of connections waiting to be accepted
+ */
+#define SERVER_BACKLOG 128
+
+/**
+ * @def SERVER_LINE_SIZE
+ * @brief Defines the max length of a command line, longer lines are answered with an error and not played
+ */
+#define SERVER_LINE_SIZE 48
+
+/**
+ * @def SERVER_READ_SIZE
+ * @brief Defines the max number of bytes read from a client each time it is ready, so every client gets its turn
+ */
+#define SERVER_READ_SIZE 1024
+
+/**
+ * @def SERVER_OUTPUT_SIZE
+ * @brief Defines the max number of bytes waiting to be sent to a client, a client that does not read its answers
+ * is disconnected when they do not fit
+ */
+#define SERVER_OUTPUT_SIZE 8192
+
+/**
+ * @def SEED_STEP
+ * @brief Defines the difference between the seeds of two clients accepted one after the other
+ */
+#define SEED_STEP 7919UL
+
+/**
+ * @def LINE_TOO_LONG
+ * @brief Defines the answer to a command line longer than SERVER_LINE_SIZE
+ */
+#define LINE_TOO_LONG "ERROR: command too long"
+
+/**
+ * @def FILE_COMMAND
+ * @brief Defines the answer to a save or load, which would open files of the server
+ */
+#define FILE_COMMAND "ERROR: save and load are not available to remote players"
+
+/**
+ * @brief Session
+ *
+ * A client connected to the server and the game it is playing, with the part of its input that is not a whole
+ * line yet and the answers it has not read yet.
+ * */
+typedef struct _Session {
+        int fd;                              /**< Socket of the client*/
+        int index;                           /**< Position of the session in the array of the server*/
+        Game *game;                          /**< Game of the client*/
+        unsigned long seed;                  /**< Seed of the random numbers of the game*/
+        Rule_state state;                    /**< State of the rules of the game*/
+        char input[SERVER_LINE_SIZE];        /**< Start of the line being received*/
+        int input_length;                    /**< Number of bytes of input in use*/
+        Bool discarding;                     /**< TRUE while skipping the rest of a line too long*/
+        char output[SERVER_OUTPUT_SIZE];     /**< Answers not sent yet*/
+        int output_length;                   /**< Number of bytes of output in use*/
+        unsigned int events;                 /**< Events the socket of the client is watched for*/
+        Bool finished;                       /**< TRUE once the game is over or the client stopped sending, the session
+                                                  ends when the output is sent*/
+} Session;
+
+/**
+ * @brief Server
+ *
+ * The listening socket, the epoll instance that watches every socket and the sessions being played. Every socket
+ * is watched with EPOLLONESHOT and only watched again once its session has been played, so a session is never
+ * ready twice and runs on one worker at a time: its game needs no lock.
+ * */
+typedef struct _Server {
+        int listen_fd;                            /**< Socket that accepts the clients*/
+        int epoll_fd;                             /**< Epoll instance*/
+        char *file_name;                          /**< Game data file every game is created from*/
+        int deterministic;                        /**< Whether the games are played in deterministic mode*/
+        unsigned long n_accepted;                 /**< Number of clients accepted, to give each game its own seed*/
+        Worker_pool *pool;                        /**< Workers that play the sessions*/
+        pthread_mutex_t lock;                     /**< Lock of the sessions, taken when one starts or ends*/
+        Session *sessions[SERVER_MAX_SESSIONS];   /**< Sessions being played*/
+        int n_sessions;                           /**< Number of sessions*/
+} Server;
+
+/**
+ * @brief Set by SIGINT and SIGTERM to stop the server
+ */
+static volatile sig_atomic_t stop = 0;
+
+/*
+Private functions
+*/
+
+/**
+ * @brief Handles SIGINT and SIGTERM, asking the loop to stop
+ * @author Abraham Martín
+ *
+ * @param signal_number Number of the signal
+ */
+void game_server_stop(int signal_number);
+
+/**
+ * @brief Opens the listening socket on a port of localhost
+ * @author Abraham Martín
+ *
+ * @param port TCP port
+ * @return The socket, or -1 if it could not be opened
+ */
+int game_server_listen_tcp(int port);
+
+/**
+ * @brief Opens the listening socket on a Unix socket, removing any file left with that name
+ * @author Abraham Martín
+ *
+ * @param path Name of the socket file
+ * @return The socket, or -1 if it could not be opened
+ */
+int game_server_listen_unix(const char *path);
+
+/**
+ * @brief Makes the operations on a file descriptor return instead of waiting
+ * @author Abraham Martín
+ *
+ * @param fd File descriptor
+ * @return OK if everything goes well, ERROR otherwise
+ */
+Status game_server_set_nonblocking(int fd);
+
+/**
+ * @brief Waits for the sockets and hands the sessions that are ready to the workers until the server is stopped
+ * @author Abraham Martín
+ *
+ * @param server Pointer to the server
+ * @return OK if the server stopped because it was asked to, ERROR if epoll failed
+ */
+Status game_server_run(Server *server);
+
+/**
+ * @brief Accepts every client waiting, handing each new session to the workers to create its game
+ * @author Abraham Martín
+ *
+ * @param server Pointer to the server
+ */
+void game_server_accept(Server *server);
+
+/**
+ * @brief Plays a session that is ready, run by the workers. The first time it creates the game of the session
+ * @author Abraham Martín
+ *
+ * @param task Pointer to the session
+ * @param context Pointer to the server
+ */
+void game_server_serve(void *task, void *context);
+
+/**
+ * @brief Watches the socket of a session again, for the events it is waiting for. The session may be handed to
+ * another worker as soon as this is done
+ * @author Abraham Martín
+ *
+ * @param server Pointer to the server
+ * @param session Pointer to the session
+ * @param operation EPOLL_CTL_ADD the first time, EPOLL_CTL_MOD after
+ * @return OK if everything goes well, ERROR otherwise
+ */
+Status game_server_watch(Server *server, Session *session, int operation);
+
+/**
+ * @brief Reads what a client sent and plays each whole line as a command of its game
+ * @author Abraham Martín
+ *
+ * @param session Pointer to the session of the client
+ * @return OK if the session goes on, ERROR if the client left or failed
+ */
+Status game_server_read(Session *session);
+
+/**
+ * @brief Plays a command line in the game of a session and adds its log line to the answers. Save and load are
+ * refused without touching the game, since their argument is a path of the server
+ * @author Abraham Martín
+ *
+ * @param session Pointer to the session
+ * @param line Command line, without the newline
+ * @return OK if the answer fits in the output, ERROR otherwise
+ */
+Status game_server_play(Session *session, char *line);
+
+/**
+ * @brief Adds a line to the answers of a session
+ * @author Abraham Martín
+ *
+ * @param session Pointer to the session
+ * @param line Line, without the newline
+ * @return OK if it fits in the output, ERROR otherwise
+ */
+Status game_server_answer(Session *session, const char *line);
+
+/**
+ * @brief Sends to a client as much of its answers as its socket takes, and sets the events the session waits for
+ * @author Abraham Martín
+ *
+ * @param session Pointer to the session
+ * @return OK if the session goes on, ERROR if the client failed or its game is over and everything was sent
+ */
+Status game_server_write(Session *session);
+
+/**
+ * @brief Closes the socket of a session and frees it with its game. Only the worker playing the session, or the main
+ * thread once the workers are stopped, may close it
+ * @author Abraham Martín
+ *
+ * @param server Pointer to the server
+ * @param session Pointer to the session
+ */
+void game_server_close(Server *server, Session *session);
+
+/**
+ *@brief The main function of the server.
+ *
+ * Use: game_server <game_data_file> [-d] [-p <port> | -u <socket_file>] [-w <workers>]. Each client plays its own
+ * game, sending one command per line and getting the log line of each command back. There is one worker for each
+ * processor unless -w says otherwise.
+ */
+int main(int argc, char *argv[]) {
+        Server server;
+        char *socket_name = NULL;
+        int port = SERVER_DEFAULT_PORT;
+        int n_workers = (int)sysconf(_SC_NPROCESSORS_ONLN);
+        int i;
+        Status status;
+
+        if (argc < 2) {
+                fprintf(stderr, "Use: %s <game_data_file> [-d] [-p <port> | -u <socket_file>] [-w <workers>]\n",
+                        argv[0]);
+                return 1;
+        }
+
+        server.file_name = argv[1];
+        server.deterministic = 0;
+        server.n_accepted = 0;
+        server.n_sessions = 0;
+        for (i = 2; i < argc; i++) {
+                if (strcmp(argv[i], "-d") == 0) {
+                        server.deterministic = 1;
+                } else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+                        port = atoi(argv[++i]);
+                } else if (strcmp(argv[i], "-u") == 0 && i + 1 < argc) {
+                        socket_name = argv[++i];
+                } else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) {
+                        n_workers = atoi(argv[++i]);
+                } else {
+                        fprintf(stderr, "ERROR, unrecognized argument %s\n", argv[i]);
+                        fprintf(stderr,
+                                "Valid use: %s <game_data_file> [-d] [-p <port> | -u <socket_file>] [-w <workers>]\n",
+                                argv[0]);
+                        return 1;
+                }
+        }
+
+        /*A client leaving while its answers are being sent must not kill the server*/
+        signal(SIGPIPE, SIG_IGN);
+        signal(SIGINT, game_server_stop);
+        signal(SIGTERM, game_server_stop);
+
+        server.listen_fd = socket_name ? game_server_listen_unix(socket_name) : game_server_listen_tcp(port);
+        if (server.listen_fd == -1) {
+                fprintf(stderr, "Error while opening the socket of the server.\n");
+                return 1;
+        }
+        server.epoll_fd = epoll_create(SERVER_MAX_EVENTS);
+        if (server.epoll_fd == -1) {
+                fprintf(stderr, "Error while creating the epoll instance.\n");
+                close(server.listen_fd);
+                return 1;
+        }
+
+        if (n_workers < 1) {
+                n_workers = 1;
+        } else if (n_workers > WORKER_POOL_MAX_WORKERS) {
+                n_workers = WORKER_POOL_MAX_WORKERS;
+        }
+        if (pthread_mutex_init(&server.lock, NULL) != 0 ||
+            !(server.pool = worker_pool_create(n_workers, game_server_serve, &server))) {
+                fprintf(stderr, "Error while starting the workers.\n");
+                close(server.epoll_fd);
+                close(server.listen_fd);
+                return 1;
+        }
+
+        status = game_server_run(&server);
+
+        /*The sessions being played are finished first, the rest are not touched by the workers any more*/
+        worker_pool_destroy(server.pool);
+        while (server.n_sessions > 0) {
+                game_server_close(&server, server.sessions[server.n_sessions - 1]);
+        }
+        pthread_mutex_destroy(&server.lock);
+        close(server.epoll_fd);
+        close(server.listen_fd);
+        if (socket_name) {
+                unlink(socket_name);
+        }
+
+        return status == OK ? 0 : 1;
+}
+
+/**
+   Implementation of private functions
+*/
+
+void game_server_stop(int signal_number) {
+        (void)signal_number;
+        stop = 1;
+}
+
+int game_server_listen_tcp(int port) {
+        struct sockaddr_in address;
+        int fd, reuse = 1;
+
+        if ((fd = socket(AF_INET, SOCK_STREAM, 0)) == -1) {
+                return -1;
+        }
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        /*Only clients of this machine can play*/
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_port = htons((unsigned short)port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (bind(fd, (struct sockaddr *)&address, sizeof(address)) == -1 || listen(fd, SERVER_BACKLOG) == -1 ||
+            game_server_set_nonblocking(fd) == ERROR) {
+                close(fd);
+                return -1;
+        }
+
+        return fd;
+}
+
+int game_server_listen_unix(const char *path) {
+        struct sockaddr_un address;
+        int fd;
+
+        if (strlen(path) >= sizeof(address.sun_path) || (fd = socket(AF_UNIX, SOCK_STREAM, 0)) == -1) {
+                return -1;
+        }
+
+        memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        strcpy(address.sun_path, path);
+        unlink(path);
+        if (bind(fd, (struct sockaddr *)&address, sizeof(address)) == -1 || listen(fd, SERVER_BACKLOG) == -1 ||
+            game_server_set_nonblocking(fd) == ERROR) {
+                close(fd);
+                return -1;
+        }
+
+        return fd;
+}
+
+Status game_server_set_nonblocking(int fd) {
+        int flags = fcntl(fd, F_GETFL, 0);
+
+        if (flags == -1 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) == -1) {
+                return ERROR;
+        }
+
+        return OK;
+}
+
+Status game_server_run(Server *server) {
+        struct epoll_event event, events[SERVER_MAX_EVENTS];
+        Session *session = NULL;
+        int n_events, i;
+
+        /*The listening socket is the only one without a session*/
+        event.events = EPOLLIN;
+        event.data.ptr = NULL;
+        if (epoll_ctl(server->epoll_fd, EPOLL_CTL_ADD, server->listen_fd, &event) == -1) {
+                return ERROR;
+        }
+
+        while (!stop) {
+                n_events = epoll_wait(server->epoll_fd, events, SERVER_MAX_EVENTS, -1);
+                if (n_events == -1) {
+                        if (errno == EINTR) continue;
+                        return ERROR;
+                }
+
+                for (i = 0; i < n_events; i++) {
+                        session = (Session *)events[i].data.ptr;
+                        if (!session) {
+                                game_server_accept(server);
+                                continue;
+                        }
+
+                        /*The socket is not watched until the worker is done, no other thread touches the session*/
+                        if (worker_pool_submit(server->pool, session) == ERROR) {
+                                game_server_close(server, session);
+                        }
+                }
+        }
+
+        return OK;
+}
+
+void game_server_accept(Server *server) {
+        Session *session = NULL;
+        int fd;
+
+        while ((fd = accept(server->listen_fd, NULL, NULL)) != -1) {
+                if (game_server_set_nonblocking(fd) == ERROR || !(session = (Session *)calloc(1, sizeof(Session)))) {
+                        close(fd);
+                        continue;
+                }
+                session->fd = fd;
+
+                /*In deterministic mode every game draws the same numbers, otherwise each one gets its own*/
+                session->seed = server->deterministic ? GAME_DEFAULT_SEED
+                                                      : (unsigned long)time(NULL) + SEED_STEP * server->n_accepted;
+                server->n_accepted++;
+                session->state.turn = 1;
+                session->state.times_feeded = 0;
+                session->state.spider_is_dead = FALSE;
+                session->discarding = FALSE;
+                session->events = EPOLLIN;
+                session->finished = FALSE;
+
+                pthread_mutex_lock(&server->lock);
+                if (server->n_sessions == SERVER_MAX_SESSIONS) {
+                        pthread_mutex_unlock(&server->lock);
+                        free(session);
+                        close(fd);
+                        continue;
+                }
+                session->index = server->n_sessions;
+                server->sessions[server->n_sessions++] = session;
+                pthread_mutex_unlock(&server->lock);
+
+                /*Loading the world may take long, so the game is created by a worker*/
+                if (worker_pool_submit(server->pool, session) == ERROR) {
+                        game_server_close(server, session);
+                }
+        }
+}
+
+void game_server_serve(void *task, void *context) {
+        Session *session = (Session *)task;
+        Server *server = (Server *)context;
+        Status status = OK;
+
+        if (!session->game) {
+                if (game_create_from_file(&session->game, server->file_name) == ERROR) {
+                        fprintf(stderr, "Error while creating a game from %s.\n", server->file_name);
+                        game_server_close(server, session);
+                        return;
+                }
+                game_set_deterministic_mode(session->game, server->deterministic);
+                game_set_seed(session->game, session->seed);
+                if (game_server_watch(server, session, EPOLL_CTL_ADD) == ERROR) {
+                        game_server_close(server, session);
+                }
+                return;
+        }
+
+        /*Whatever the socket was ready for, reading and writing do not wait, and a socket closed or failed makes
+          them fail*/
+        if (session->events & EPOLLIN) {
+                status = game_server_read(session);
+        } else {
+                status = game_server_write(session);
+        }
+
+        if (status == ERROR || game_server_watch(server, session, EPOLL_CTL_MOD) == ERROR) {
+                game_server_close(server, session);
+        }
+}
+
+Status game_server_watch(Server *server, Session *session, int operation) {
+        struct epoll_event event;
+
+        /*The socket is only watched for room while there is something waiting to be sent, and for input while the
+          game goes on*/
+        event.events = session->events | EPOLLONESHOT;
+        event.data.ptr = session;
+        if (epoll_ctl(server->epoll_fd, operation, session->fd, &event) == -1) {
+                return ERROR;
+        }
+
+        return OK;
+}
+
+Status game_server_read(Session *session) {
+        char buffer[SERVER_READ_SIZE];
+        int n, i;
+
+        n = read(session->fd, buffer, SERVER_READ_SIZE);
+        if (n == -1) {
+                /*Nothing to read: the socket may be ready for the answers left*/
+                if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) return game_server_write(session);
+                return ERROR;
+        }
+        if (n == 0) {
+                /*A last line without a newline is played too, as in the command files*/
+                if (session->input_length > 0 && !session->discarding && !session->finished) {
+                        session->input[session->input_length] = '\0';
+                        if (game_server_play(session, session->input) == ERROR) return ERROR;
+                }
+                session->finished = TRUE;
+                return game_server_write(session);
+        }
+
+        /*Once the game is over the rest of the input is ignored*/
+        for (i = 0; i < n && !session->finished; i++) {
+                if (buffer[i] != '\n') {
+                        if (session->input_length < SERVER_LINE_SIZE - 1) {
+                                session->input[session->input_length++] = buffer[i];
+                        } else {
+                                session->discarding = TRUE;
+                        }
+                        continue;
+                }
+
+                if (session->input_length > 0 && session->input[session->input_length - 1] == '\r') {
+                        session->input_length--;
+                }
+                session->input[session->input_length] = '\0';
+                if (session->discarding) {
+                        if (game_server_answer(session, LINE_TOO_LONG) == ERROR) return ERROR;
+                } else if (game_server_play(session, session->input) == ERROR) {
+                        return ERROR;
+                }
+                session->input_length = 0;
+                session->discarding = FALSE;
+        }
+
+        return game_server_write(session);
+}
+
+Status game_server_play(Session *session, char *line) {
+        Command *last_cmd = game_get_last_command((const Game *)session->game);
+        char log_line[MAX_LOG_LINE];
+
+        command_parse(last_cmd, line);
+        if (command_get_code(last_cmd) == SAVE || command_get_code(last_cmd) == LOAD) {
+                return game_server_answer(session, FILE_COMMAND);
+        }
+        game_actions_update(session->game, last_cmd);
+        game_rule_update(session->game, last_cmd, session->state.turn, &session->state.times_feeded,
+                         &session->state.spider_is_dead);
+        session->state.turn++;
+
+        if (command_get_code(last_cmd) == EXIT || game_get_finished((const Game *)session->game) == TRUE) {
+                session->finished = TRUE;
+        }
+        if (game_get_recent_log((const Game *)session->game, log_line, MAX_LOG_LINE) == ERROR) {
+                return game_server_answer(session, "");
+        }
+
+        return game_server_answer(session, log_line);
+}
+
+Status game_server_answer(Session *session, const char *line) {
+        int length = (int)strlen(line);
+
+        if (session->output_length + length + 1 > SERVER_OUTPUT_SIZE) {
+                return ERROR;
+        }
+        memcpy(session->output + session->output_length, line, length);
+        session->output_length += length;
+        session->output[session->output_length++] = '\n';
+
+        return OK;
+}
+
+Status game_server_write(Session *session) {
+        int n, done = 0;
+
+        while (done < session->output_length) {
+                n = write(session->fd, session->output + done, session->output_length - done);
+                if (n == -1 && errno == EINTR) {
+                        continue;
+                }
+                if (n == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                        break;
+                }
+                if (n <= 0) {
+                        return ERROR;
+                }
+                done += n;
+        }
+        memmove(session->output, session->output + done, session->output_length - done);
+        session->output_length -= done;
+
+        if (session->output_length == 0 && session->finished) {
+                return ERROR;
+        }
+
+        session->events = (session->finished ? 0 : EPOLLIN) | (session->output_length > 0 ? EPOLLOUT : 0);
+
+        return OK;
+}
+
+void game_server_close(Server *server, Session *session) {
+        Session *last = NULL;
+
+        epoll_ctl(server->epoll_fd, EPOLL_CTL_DEL, session->fd, NULL);
+        close(session->fd);
+        game_destroy(session->game);
+
+        /*The last session takes the place of the one closed*/
+        pthread_mutex_lock(&server->lock);
+        last = server->sessions[--server->n_sessions];
+        last->index = session->index;
+        server->sessions[session->index] = last;
+        pthread_mutex_unlock(&server->lock);
+        free(session);
+}
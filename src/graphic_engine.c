@@ -12,10 +12,13 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "command.h"
 #include "libscreen.h"
+#include "map.h"
 #include "space.h"
+#include "text_builder.h"
 #include "types.h"
 
 /**
@@ -90,18 +93,6 @@
  */
 #define EMPTY " "
 
-/**
- * @def ONE
- * @brief Defines the number 1 for general use
- */
-#define ONE 1
-
-/**
- * @def AUX_LENGTH
- * @brief Defines the length for a general purpose buffer
- */
-#define AUX_LENGTH 17
-
 /**
  * @def LEFT_ARROW
  * @brief Defines a left direction symbol.
@@ -126,20 +117,154 @@
  */
 #define DOWN_ARROW "v"
 
+/**
+ * @def TILE_WIDTH
+ * @brief Defines the width of the inside of the box of a space
+ */
+#define TILE_WIDTH 17
+
+/**
+ * @def TILE_TITLE
+ * @brief Defines the line of a tile with the enemy and the id of the space
+ */
+#define TILE_TITLE 0
+
+/**
+ * @def TILE_PLAYERS
+ * @brief Defines the first of the two lines of a tile with the players in the space
+ */
+#define TILE_PLAYERS 1
+
+/**
+ * @def TILE_GDESC
+ * @brief Defines the first line of a tile with the drawing of the space
+ */
+#define TILE_GDESC 3
+
+/**
+ * @def TILE_OBJECTS
+ * @brief Defines the line of a tile with the objects in the space
+ */
+#define TILE_OBJECTS (TILE_GDESC + GDESC_LINES)
+
+/**
+ * @def TILE_LINES
+ * @brief Defines the number of lines of a tile
+ */
+#define TILE_LINES (TILE_OBJECTS + 1)
+
+/**
+ * @def MIN_TILES
+ * @brief Defines the number of tiles the cache holds when it is first needed
+ */
+#define MIN_TILES 16
+
+/**
+ * @def SIGNATURE_PRIME
+ * @brief Defines the multiplier used to mix the signatures of the map
+ */
+#define SIGNATURE_PRIME 16777619UL
+
+/**
+ * @brief Tile
+ *
+ * The inside of the box of a space, as the map draws it, and the signature the space had when it was drawn.
+ */
+typedef struct _Tile {
+        unsigned long signature;                /**< Signature of the space when the tile was drawn*/
+        char lines[TILE_LINES][TILE_WIDTH + 1]; /**< Lines of the tile*/
+} Tile;
+
 /**
  * @brief _Graphic_engine private struct
+ *
+ * The signatures of the last frame tell which areas have to be painted again, the banner and the help are only
+ * painted in the first frame. The tile of each space shown is kept until the space changes.
  * */
 
 struct _Graphic_engine {
         Area *map /**< Map region pointer*/, *descript /**< Descript region pointer*/, *banner /**< Banner region pointer*/,
             *help /**< Help region pointer*/, *feedback /**< Feedback region pointer*/;
+        Bool painted;                 /**< TRUE once the first frame has been painted*/
+        unsigned long map_signature;  /**< Signature of what the map showed in the last frame*/
+        unsigned long info_signature; /**< Signature of what the description showed in the last frame*/
+        unsigned long info_check;     /**< Signature of the whole description in the last frame, only with DEBUG*/
+        Map *tile_index;              /**< Position in tiles of the tile of each space, by id*/
+        Tile *tiles;                  /**< Tiles of the spaces shown so far*/
+        int n_tiles;                  /**< Number of tiles*/
+        int tile_capacity;            /**< Number of tiles the array can hold*/
+        Tile blank;                   /**< Tile drawn where there is no space*/
 };
 
+/*
+Private functions
+*/
+
+/**
+ * @brief Computes a signature of everything the map area shows: the space of the current player, the spaces around
+ * it and the links between them
+ * @author Abraham Martín
+ *
+ * @param game A pointer to a Game
+ * @return The signature of the map
+ */
+unsigned long graphic_engine_map_signature(const Game *game);
+
+/**
+ * @brief Makes room in the cache for the tiles of a number of spaces. It is called before the frame takes any tile,
+ * since growing the cache moves the tiles already taken
+ * @author Abraham Martín
+ *
+ * @param ge A pointer to a Graphic_engine
+ * @param n_tiles Number of tiles the cache has to hold
+ * @return OK if there is room for them, ERROR otherwise
+ */
+Status graphic_engine_reserve_tiles(Graphic_engine *ge, int n_tiles);
+
+/**
+ * @brief Retrieves the tile of a space, drawing it again only if the space changed since it was drawn. The cache is
+ * never grown here, so the tiles taken before stay valid
+ * @author Abraham Martín
+ *
+ * @param ge A pointer to a Graphic_engine
+ * @param game A pointer to a Game
+ * @param space_id Id of the space
+ * @return The tile of the space, or a blank tile if there is no such space or there is no room for it
+ */
+const Tile *graphic_engine_get_tile(Graphic_engine *ge, const Game *game, Id space_id);
+
+/**
+ * @brief Draws the tile of a space: its enemy and id if it is discovered, the other players in it, its drawing and
+ * its objects
+ * @author Abraham Martín
+ *
+ * @param game A pointer to a Game
+ * @param space_id Id of the space
+ * @param tile Pointer to the tile to draw
+ */
+void graphic_engine_render_tile(const Game *game, Id space_id, Tile *tile);
+
+/**
+ * @brief Paints the box of a space above or below the space of the player
+ * @author Abraham Martín
+ *
+ * @param ge A pointer to a Graphic_engine
+ * @param tile Tile of the space
+ */
+void graphic_engine_paint_column_room(Graphic_engine *ge, const Tile *tile);
+
+/**
+ * @brief Paints the spaces to the west and to the east of the player with the space of the player between them
+ * @author Abraham Martín
+ *
+ * @param ge A pointer to a Graphic_engine
+ * @param game A pointer to a Game
+ * @param id_act Id of the space of the player
+ */
+void graphic_engine_paint_middle_row(Graphic_engine *ge, const Game *game, Id id_act);
+
 Graphic_engine *graphic_engine_create(void) {
-        static Graphic_engine *ge = NULL;
-        if (ge) {
-                return ge;
-        }
+        Graphic_engine *ge = NULL;
 
         screen_init(HEIGHT_MAP + HEIGHT_BAN + HEIGHT_HLP + HEIGHT_FDB + 4, WIDTH_MAP + WIDTH_DES + 3);
         ge = (Graphic_engine *)malloc(sizeof(Graphic_engine));
@@ -152,6 +277,15 @@ Graphic_engine *graphic_engine_create(void) {
         ge->banner = screen_area_init((int)((WIDTH_MAP + WIDTH_DES + 1 - WIDTH_BAN) / 2), HEIGHT_MAP + 2, WIDTH_BAN, HEIGHT_BAN);
         ge->help = screen_area_init(1, HEIGHT_MAP + HEIGHT_BAN + 2, WIDTH_MAP + WIDTH_DES + 1, HEIGHT_HLP);
         ge->feedback = screen_area_init(1, HEIGHT_MAP + HEIGHT_BAN + HEIGHT_HLP + 3, WIDTH_MAP + WIDTH_DES + 1, HEIGHT_FDB);
+        ge->painted = FALSE;
+        ge->map_signature = 0;
+        ge->info_signature = 0;
+        ge->info_check = 0;
+        ge->tile_index = map_create();
+        ge->tiles = NULL;
+        ge->n_tiles = 0;
+        ge->tile_capacity = 0;
+        graphic_engine_render_tile(NULL, NO_ID, &ge->blank);
 
         return ge;
 }
@@ -165,273 +299,302 @@ void graphic_engine_destroy(Graphic_engine *ge) {
         screen_area_destroy(ge->help);
         screen_area_destroy(ge->feedback);
 
+        map_destroy(ge->tile_index);
+        free(ge->tiles);
+
         screen_destroy();
         free(ge);
 }
 
 void graphic_engine_paint_game(Graphic_engine *ge, Game *game) {
         int i;
-        Id id_act = NO_ID, id_back = NO_ID, id_next = NO_ID, id_left = NO_ID, id_right = NO_ID;
-        Space *space_act = NULL, *space_left = NULL, *space_right = NULL, *space_back = NULL, *space_next = NULL;
+        Id id_act = NO_ID, id_back = NO_ID, id_next = NO_ID;
         char str[WORD_SIZE], *toks;
         CommandCode last_cmd = UNKNOWN;
         extern char *cmd_to_str[N_CMD][N_CMDT];
         Status status = ERROR;
-        char l_walls[ONE + 1], r_walls[ONE + 1], aux1[AUX_LENGTH + 1], aux2[AUX_LENGTH + 1], aux3[AUX_LENGTH + 1];
-        char aux4[AUX_LENGTH + 1], aux5[AUX_LENGTH + 1], aux6[AUX_LENGTH + 1];
-        char *gdesc = NULL;
-        char *gdesc_act = NULL;
-        char *gdesc_left = NULL;
-        char *gdesc_right = NULL;
-
-        /* Paint the in the map area */
-        screen_area_clear(ge->map);
-        if ((id_act = game_get_player_location((const Game *)game)) != NO_ID) {
-                space_act = game_get_space((const Game *)game, id_act);
+        unsigned long signature;
+        Bool map_dirty = FALSE;
+        Text_builder line;
+
+        /* Paint the in the map area, only if what it shows has changed */
+        signature = graphic_engine_map_signature((const Game *)game);
+        if (ge->painted == FALSE || signature != ge->map_signature) {
+                ge->map_signature = signature;
+                map_dirty = TRUE;
+                screen_area_clear(ge->map);
+        }
+        if (map_dirty == TRUE && (id_act = game_get_player_location((const Game *)game)) != NO_ID) {
+                graphic_engine_reserve_tiles(ge, game_get_n_spaces(game));
                 id_back = game_get_connection((const Game *)game, id_act, N);
                 id_next = game_get_connection((const Game *)game, id_act, S);
-                id_right = game_get_connection((const Game *)game, id_act, E);
-                id_left = game_get_connection((const Game *)game, id_act, W);
 
                 if (id_back != NO_ID) {
-                        space_back = game_get_space((const Game *)game, id_back);
-                        gdesc = (char *)character_get_gdesc(game_get_enemy_character_at_space((const Game *)game, (int)id_back));
-
-                        if (space_get_discovered(game_get_space((const Game *)game, id_back)) == TRUE) {
-                                sprintf(str, "         %s%s %s", EMPTY_LONG_ROW, FLOOR_ROOF, EMPTY_LONG_ROW);
-                                screen_area_puts(ge->map, str);
-                                sprintf(str, "        %s |  %11s %3d|%s", EMPTY_LONG_ROW, gdesc == NULL ? "" : gdesc,
-                                        (int)id_back, EMPTY_LONG_ROW);
-
-                                screen_area_puts(ge->map, str);
+                        graphic_engine_paint_column_room(ge, graphic_engine_get_tile(ge, (const Game *)game, id_back));
+                        text_builder_init(&line, str, WORD_SIZE);
+                        text_builder_append(&line, "         " EMPTY_LONG_ROW "         ");
+                        text_builder_append(&line,
+                                            game_connection_is_open((const Game *)game, id_act, N) == TRUE ? UP_ARROW : EMPTY);
+                        screen_area_puts(ge->map, str);
+                } else {
+                        for (i = 0; i < TILE_LINES + 3; i++) {
+                                screen_area_puts(ge->map, EMPTY);
                         }
+                }
 
-                        aux1[0] = '\0';
-                        aux2[0] = '\0';
-
-                        game_get_players_row_at_space((const Game *)game, id_back, aux1, aux2);
-                        sprintf(str, "         %s|%s|%s", EMPTY_LONG_ROW,
-                                (strcasecmp(aux1, "                  ") == 0) ? "                  " : aux1, EMPTY_LONG_ROW);
-
-                        screen_area_puts(ge->map, str);
-                        sprintf(str, "         %s|%s|%s", EMPTY_LONG_ROW,
-                                (strcasecmp(aux1, "                  ") == 0) ? "                  " : aux2, EMPTY_LONG_ROW);
-                        screen_area_puts(ge->map, str);
+                graphic_engine_paint_middle_row(ge, (const Game *)game, id_act);
 
-                        for (i = 0; i < GDESC_LINES; i++) {
-                                sprintf(str, "         %s|    %s    |%s", EMPTY_LONG_ROW,
-                                        space_get_gdesc((const Space *)space_back, i), EMPTY_LONG_ROW);
-                                screen_area_puts(ge->map, str);
-                        }
-                        strcpy(aux1, EMPTY);
-                        game_get_object_list_at_space((const Game *)game, id_back, aux1);
-                        sprintf(str, "         %s|%-17s| %s", EMPTY_LONG_ROW, aux1, EMPTY_LONG_ROW);
-                        screen_area_puts(ge->map, str);
-                        sprintf(str, "         %s%s %s", EMPTY_LONG_ROW, FLOOR_ROOF, EMPTY_LONG_ROW);
-                        screen_area_puts(ge->map, str);
-                        sprintf(str, "         %s         %s", EMPTY_LONG_ROW,
-                                game_connection_is_open((const Game *)game, id_act, N) == TRUE ? UP_ARROW : EMPTY);
+                if (id_next != NO_ID) {
+                        text_builder_init(&line, str, WORD_SIZE);
+                        text_builder_append(&line, "           " EMPTY_LONG_ROW "       ");
+                        text_builder_append(&line,
+                                            game_connection_is_open((const Game *)game, id_act, S) == TRUE ? DOWN_ARROW : EMPTY);
                         screen_area_puts(ge->map, str);
+                        graphic_engine_paint_column_room(ge, graphic_engine_get_tile(ge, (const Game *)game, id_next));
                 } else {
-                        for (i = 0; i < GDESC_LINES + 7; i++) {
-                                sprintf(str, "         %s %s %s", EMPTY_LONG_ROW, EMPTY_LONG_ROW, EMPTY_LONG_ROW);
-                                screen_area_puts(ge->map, str);
+                        for (i = 0; i < TILE_LINES + 3; i++) {
+                                screen_area_puts(ge->map, EMPTY);
                         }
                 }
+        }
 
-                if (id_act != NO_ID) {
-                        space_left = game_get_space((const Game *)game, id_left);
-                        space_right = game_get_space((const Game *)game, id_right);
-                        if (space_left) {
-                                strcpy(l_walls, WALL);
-                                sprintf(aux1, "%d", (int)id_left);
-                        } else {
-                                strcpy(l_walls, EMPTY);
-                                strcpy(aux1, EMPTY);
-                        }
-                        if (space_right) {
-                                strcpy(r_walls, WALL);
-                                sprintf(aux2, "%d", (int)id_right);
-                        } else {
-                                strcpy(r_walls, EMPTY);
-                                strcpy(aux2, EMPTY);
-                        }
-                        sprintf(str, "        %s %s %s ", space_left ? FLOOR_ROOF : EMPTY_LONG_ROW, FLOOR_ROOF,
-                                space_right ? FLOOR_ROOF : EMPTY_LONG_ROW);
-                        screen_area_puts(ge->map, str);
-                        gdesc_left = (char *)character_get_gdesc(game_get_enemy_character_at_space((const Game *)game, id_left));
-                        gdesc_act = (char *)character_get_gdesc(game_get_enemy_character_at_space((const Game *)game, id_act));
-                        gdesc_right =
-                            (char *)character_get_gdesc(game_get_enemy_character_at_space((const Game *)game, id_right));
-
-                        if (space_get_discovered(game_get_space((const Game *)game, id_act)) == TRUE) {
-                                sprintf(str, "        %s       %6s %3s%s |%6s %6s %3d| %s       %6s %3s%s", l_walls,
-                                        gdesc_left == NULL ? "" : gdesc, aux1, l_walls,
-                                        game_get_current_player_gdesc((const Game *)game), gdesc_act == NULL ? "" : gdesc_act,
-                                        (int)id_act, r_walls, gdesc_right == NULL ? "" : gdesc_right, aux2, r_walls);
-                        }
-                        screen_area_puts(ge->map, str);
+        /* Paint in the description area, only if what it shows has changed */
+        signature = game_get_info_signature((const Game *)game);
+#ifdef DEBUG
+        if (ge->painted == TRUE && signature == ge->info_signature &&
+            game_compute_info_signature((const Game *)game) != ge->info_check) {
+                fprintf(stderr, "The description changed but it was not painted again.\n");
+        }
+        ge->info_check = game_compute_info_signature((const Game *)game);
+#endif
+        if (ge->painted == FALSE || signature != ge->info_signature) {
+                ge->info_signature = signature;
+                screen_area_clear(ge->descript);
+
+                game_get_info((const Game *)game, str, WORD_SIZE);
+                toks = strtok(str, "|\n");
+                while (toks) {
+                        screen_area_puts(ge->descript, toks);
+                        toks = strtok(NULL, "|\n");
+                }
+        }
 
-                        /*Print de los players*/
-                        /*Players de la izquierda*/
-                        aux1[0] = '\0';
-                        aux2[0] = '\0';
-                        game_get_players_row_at_space((const Game *)game, id_left, aux1, aux2);
-                        /*Players de la actual*/
-                        aux3[0] = '\0';
-                        aux4[0] = '\0';
-                        game_get_players_row_at_space((const Game *)game, id_act, aux3, aux4);
-                        /*Players de la derecha*/
-                        aux5[0] = '\0';
-                        aux6[0] = '\0';
-                        game_get_players_row_at_space((const Game *)game, id_right, aux5, aux6);
-
-                        sprintf(str, "        %s%s%s |%s| %s%s%s", l_walls,
-                                ((strcasecmp(aux1, "                 ") == 0) || (strcasecmp(aux1, "   |   |   |   | ") == 0))
-                                    ? "                 "
-                                    : aux1,
-                                l_walls,
-                                ((strcasecmp(aux3, "                 ") == 0) || (strcasecmp(aux3, "   |   |   |   | ") == 0))
-                                    ? "                 "
-                                    : aux3,
-                                r_walls,
-                                ((strcasecmp(aux5, "                 ") == 0) || (strcasecmp(aux5, "   |   |   |   | ") == 0))
-                                    ? "                 "
-                                    : aux5,
-                                r_walls);
+        /* The banner and the help never change */
+        if (ge->painted == FALSE) {
+                /* Paint in the banner area */
+                screen_area_puts(ge->banner, "    The anthill game ");
+
+                /* Paint in the help area */
+                screen_area_clear(ge->help);
+                sprintf(str, " The commands you can use are:");
+                screen_area_puts(ge->help, str);
+                sprintf(str,
+                        "move or m, take or t, drop or d, inspect or i, attack or a, use or u, recruit or r, abandon or ab, "
+                        "open or o, chat or c, undo or un, redo or re, load or l, save or s exit or e.");
+                screen_area_puts(ge->help, str);
+        }
+        ge->painted = TRUE;
 
-                        screen_area_puts(ge->map, str);
-                        sprintf(str, "        %s%s%s |%s| %s%s%s", l_walls,
-                                ((strcasecmp(aux2, "                 ") == 0) || (strcasecmp(aux2, "   |   |   |     ") == 0))
-                                    ? "                 "
-                                    : aux2,
-                                l_walls,
-                                ((strcasecmp(aux4, "                 ") == 0) || (strcasecmp(aux4, "   |   |   |     ") == 0))
-                                    ? "                 "
-                                    : aux4,
-                                r_walls,
-                                ((strcasecmp(aux6, "                 ") == 0) || (strcasecmp(aux6, "   |   |   |     ") == 0))
-                                    ? "                 "
-                                    : aux6,
-                                r_walls);
+        /* Paint in the feedback area */
+        last_cmd = command_get_code(game_get_last_command((const Game *)game));
+        status = command_get_success(game_get_last_command((const Game *)game));
+        sprintf(str, " %s (%s): %s", cmd_to_str[last_cmd - NO_CMD][CMDL], cmd_to_str[last_cmd - NO_CMD][CMDS],
+                status == 1 ? "OK" : "ERROR");
+        screen_area_puts(ge->feedback, str);
 
-                        screen_area_puts(ge->map, str);
+        /* Dump to the terminal */
+        screen_paint(game_get_current_turn((const Game *)game));
+        if (!(game_get_finished((const Game *)game)) && last_cmd != EXIT) printf("prompt:> ");
+}
 
-                        for (i = 0; i < GDESC_LINES; i++) {
-                                sprintf(
-                                    str, "        %s  %-15s%s%s|    %s    |%s%s    %s    %s", l_walls,
-                                    space_get_gdesc((const Space *)space_left, i), l_walls,
-                                    i == 1 && game_connection_is_open((const Game *)game, id_act, W) == TRUE ? LEFT_ARROW : EMPTY,
-                                    space_get_gdesc((const Space *)space_act, i),
-                                    i == 1 && game_connection_is_open((const Game *)game, id_act, E) == TRUE ? RIGHT_ARROW
-                                                                                                             : EMPTY,
-                                    r_walls, space_get_gdesc((const Space *)space_right, i), r_walls);
-                                screen_area_puts(ge->map, str);
-                        }
-                        strcpy(aux1, EMPTY);
-                        strcpy(aux2, EMPTY);
-                        strcpy(aux3, EMPTY);
-                        game_get_object_list_at_space((const Game *)game, id_left, aux1);
-                        game_get_object_list_at_space((const Game *)game, id_act, aux2);
-                        game_get_object_list_at_space((const Game *)game, id_right, aux3);
-                        sprintf(str, "        %s%-17s%s |%-17s| %s%-17s%s", l_walls, aux1, l_walls, aux2, r_walls, aux3, r_walls);
-                        screen_area_puts(ge->map, str);
-                        sprintf(str, "        %s %s %s", space_left ? FLOOR_ROOF : EMPTY_LONG_ROW, FLOOR_ROOF,
-                                space_right ? FLOOR_ROOF : EMPTY_LONG_ROW);
-                        screen_area_puts(ge->map, str);
-                }
+/**
+   Implementation of private functions
+*/
+
+unsigned long graphic_engine_map_signature(const Game *game) {
+        unsigned long signature = 0;
+        Id id_act = NO_ID;
+        Direction direction;
+        const char *gdesc = NULL;
+
+        id_act = game_get_player_location(game);
+        signature = game_get_space_signature(game, id_act);
+        if (id_act == NO_ID) {
+                return signature;
+        }
 
-                if (id_next != NO_ID) {
-                        sprintf(str, "           %s       %s", EMPTY_LONG_ROW,
-                                game_connection_is_open((const Game *)game, id_act, S) == TRUE ? DOWN_ARROW : EMPTY);
-                        screen_area_puts(ge->map, str);
-                        space_next = game_get_space((const Game *)game, id_next);
-                        sprintf(str, "         %s%s %s", EMPTY_LONG_ROW, FLOOR_ROOF, EMPTY_LONG_ROW);
-                        screen_area_puts(ge->map, str);
+        for (gdesc = game_get_current_player_gdesc(game); *gdesc; gdesc++) {
+                signature = ((signature ^ (unsigned char)*gdesc) * SIGNATURE_PRIME) & 0xFFFFFFFFUL;
+        }
+        /*The map shows the spaces to the north, south, east and west*/
+        for (direction = N; direction <= W; direction++) {
+                signature ^= game_get_space_signature(game, game_get_connection(game, id_act, direction));
+                signature = ((signature ^ (unsigned long)game_connection_is_open(game, id_act, direction)) * SIGNATURE_PRIME) &
+                            0xFFFFFFFFUL;
+        }
 
-                        /*if (space_get_discovered(space_next) == TRUE) {
-                                sprintf(str, "        %s |       %6s %3d| %s", EMPTY_LONG_ROW,
-                                        character_get_gdesc(game_get_enemy_character_at_space((const Game *)game, id_next)),
-                                        (int)id_next, EMPTY_LONG_ROW);
-                                screen_area_puts(ge->map, str);
-                        }*/
+        return signature;
+}
 
-                        gdesc = (char *)character_get_gdesc(game_get_enemy_character_at_space((const Game *)game, (int)id_back));
+Status graphic_engine_reserve_tiles(Graphic_engine *ge, int n_tiles) {
+        Tile *tiles = NULL;
+        int capacity;
 
-                        if (space_get_discovered(game_get_space((const Game *)game, id_next)) == TRUE) {
-                                sprintf(str, "        %s |  %11s %3d|%s", EMPTY_LONG_ROW, gdesc == NULL ? "" : gdesc,
-                                        (int)id_next, EMPTY_LONG_ROW);
+        if (n_tiles <= ge->tile_capacity) {
+                return OK;
+        }
 
-                                screen_area_puts(ge->map, str);
-                        }
+        capacity = ge->tile_capacity < MIN_TILES ? MIN_TILES : ge->tile_capacity;
+        while (capacity < n_tiles) {
+                capacity *= 2;
+        }
+        if (!(tiles = (Tile *)realloc(ge->tiles, capacity * sizeof(Tile)))) {
+                return ERROR;
+        }
+        ge->tiles = tiles;
+        ge->tile_capacity = capacity;
 
-                        aux1[0] = '\0';
-                        aux2[0] = '\0';
-                        game_get_players_row_at_space((const Game *)game, id_next, aux1, aux2);
+        return OK;
+}
 
-                        sprintf(str, "         %s|%s|%s", EMPTY_LONG_ROW,
-                                ((strcasecmp(aux1, "   |   |   |   | ") == 0) || (strcasecmp(aux1, "                 ")) == 0)
-                                    ? "                 "
-                                    : aux1,
-                                EMPTY_LONG_ROW);
+const Tile *graphic_engine_get_tile(Graphic_engine *ge, const Game *game, Id space_id) {
+        unsigned long signature;
+        long index;
 
-                        screen_area_puts(ge->map, str);
-                        sprintf(str, "         %s|%s|%s", EMPTY_LONG_ROW,
-                                ((strcasecmp(aux2, "   |   |   |     ") == 0) || (strcasecmp(aux2, "                 ")) == 0)
-                                    ? "                 "
-                                    : aux2,
-                                EMPTY_LONG_ROW);
-                        screen_area_puts(ge->map, str);
+        if (space_id == NO_ID || !game_get_space(game, space_id)) {
+                return &ge->blank;
+        }
 
-                        for (i = 0; i < GDESC_LINES; i++) {
-                                sprintf(str, "         %s|    %s    |%s", EMPTY_LONG_ROW,
-                                        space_get_gdesc((const Space *)space_next, i), EMPTY_LONG_ROW);
-                                screen_area_puts(ge->map, str);
-                        }
-                        strcpy(aux1, EMPTY);
-                        game_get_object_list_at_space((const Game *)game, id_next, aux1);
-                        sprintf(str, "         %s|%-17s| %s", EMPTY_LONG_ROW, aux1, EMPTY_LONG_ROW);
-                        screen_area_puts(ge->map, str);
-                        sprintf(str, "         %s%s %s", EMPTY_LONG_ROW, FLOOR_ROOF, EMPTY_LONG_ROW);
-                        screen_area_puts(ge->map, str);
-                } else {
-                        for (i = 0; i < GDESC_LINES + 7; i++) {
-                                sprintf(str, "        %s %s %s", EMPTY_LONG_ROW, EMPTY_LONG_ROW, EMPTY_LONG_ROW);
-                                screen_area_puts(ge->map, str);
-                        }
+        signature = game_get_space_signature(game, space_id);
+        index = map_get(ge->tile_index, space_id);
+        if (index == NO_ID) {
+                /*First time the space is shown, the room was reserved for the whole frame*/
+                if (ge->n_tiles == ge->tile_capacity || map_set(ge->tile_index, space_id, ge->n_tiles) == ERROR) {
+                        return &ge->blank;
                 }
+                index = ge->n_tiles++;
+        } else if (ge->tiles[index].signature == signature) {
+                return &ge->tiles[index];
         }
 
-        /* Paint in the description area */
-        screen_area_clear(ge->descript);
+        graphic_engine_render_tile(game, space_id, &ge->tiles[index]);
+        ge->tiles[index].signature = signature;
 
-        game_get_info((const Game *)game, str);
-        toks = strtok(str, "|\n");
-        while (toks) {
-                screen_area_puts(ge->descript, toks);
-                toks = strtok(NULL, "|\n");
+        return &ge->tiles[index];
+}
+
+void graphic_engine_render_tile(const Game *game, Id space_id, Tile *tile) {
+        char objects[TILE_WIDTH + 1];
+        Text_builder tb;
+        Space *space = NULL;
+        Character *enemy = NULL;
+        int i;
+
+        for (i = 0; i < TILE_LINES; i++) {
+                text_builder_init(&tb, tile->lines[i], TILE_WIDTH + 1);
+                text_builder_append_padded(&tb, "", -TILE_WIDTH);
+        }
+        if (!game || !(space = game_get_space(game, space_id))) {
+                return;
         }
 
-        /* Paint in the banner area */
-        screen_area_puts(ge->banner, "    The anthill game ");
+        if (space_get_discovered(space) == TRUE) {
+                enemy = game_get_enemy_character_at_space(game, space_id);
+                text_builder_init(&tb, tile->lines[TILE_TITLE], TILE_WIDTH + 1);
+                text_builder_append_padded(&tb, enemy ? character_get_gdesc(enemy) : "", TILE_WIDTH - 4);
+                text_builder_append(&tb, " ");
+                text_builder_append_number(&tb, space_id, 3);
+        }
 
-        /* Paint in the help area */
-        screen_area_clear(ge->help);
-        sprintf(str, " The commands you can use are:");
-        screen_area_puts(ge->help, str);
-        sprintf(str,
-                "move or m, take or t, drop or d, inspect or i, attack or a, use or u, recruit or r, abandon or ab, open or o, "
-                "chat or c, load or l, save or s exit or e.");
-        screen_area_puts(ge->help, str);
+        /*The rows of players are left blank when there are no other players in the space*/
+        game_get_players_row_at_space(game, space_id, tile->lines[TILE_PLAYERS], tile->lines[TILE_PLAYERS + 1],
+                                      TILE_WIDTH + 1);
+        if (strcmp(tile->lines[TILE_PLAYERS], "   |   |   |   | ") == 0) {
+                strcpy(tile->lines[TILE_PLAYERS], EMPTY_INNER_ROW);
+        }
+        if (strcmp(tile->lines[TILE_PLAYERS + 1], "   |   |   |     ") == 0) {
+                strcpy(tile->lines[TILE_PLAYERS + 1], EMPTY_INNER_ROW);
+        }
 
-        /* Paint in the feedback area */
-        last_cmd = command_get_code(game_get_last_command((const Game *)game));
-        status = command_get_success(game_get_last_command((const Game *)game));
-        sprintf(str, " %s (%s): %s", cmd_to_str[last_cmd - NO_CMD][CMDL], cmd_to_str[last_cmd - NO_CMD][CMDS],
-                status == 1 ? "OK" : "ERROR");
-        screen_area_puts(ge->feedback, str);
+        for (i = 0; i < GDESC_LINES; i++) {
+                text_builder_init(&tb, tile->lines[TILE_GDESC + i], TILE_WIDTH + 1);
+                text_builder_append(&tb, "    ");
+                text_builder_append_padded(&tb, space_get_gdesc((const Space *)space, i), 4 - TILE_WIDTH);
+        }
 
-        /* Dump to the terminal */
-        screen_paint(game_get_current_turn((const Game *)game));
-        if (!(game_get_finished((const Game *)game)) && last_cmd != EXIT) printf("prompt:> ");
+        objects[0] = '\0';
+        game_get_object_list_at_space(game, space_id, objects, TILE_WIDTH + 1);
+        text_builder_init(&tb, tile->lines[TILE_OBJECTS], TILE_WIDTH + 1);
+        text_builder_append_padded(&tb, objects, -TILE_WIDTH);
+}
+
+void graphic_engine_paint_column_room(Graphic_engine *ge, const Tile *tile) {
+        char str[WIDTH_MAP + 1];
+        Text_builder line;
+        int i;
+
+        screen_area_puts(ge->map, "         " EMPTY_LONG_ROW FLOOR_ROOF);
+        for (i = 0; i < TILE_LINES; i++) {
+                text_builder_init(&line, str, WIDTH_MAP + 1);
+                text_builder_append(&line, "         " EMPTY_LONG_ROW WALL);
+                text_builder_append(&line, tile->lines[i]);
+                text_builder_append(&line, WALL);
+                screen_area_puts(ge->map, str);
+        }
+        screen_area_puts(ge->map, "         " EMPTY_LONG_ROW FLOOR_ROOF);
+}
+
+void graphic_engine_paint_middle_row(Graphic_engine *ge, const Game *game, Id id_act) {
+        char str[WIDTH_MAP + 1], title[TILE_WIDTH + 1];
+        const Tile *left = NULL, *act = NULL, *right = NULL;
+        const char *l_walls = NULL, *r_walls = NULL;
+        Text_builder line;
+        Id id_left = NO_ID, id_right = NO_ID;
+        int i;
+
+        id_left = game_get_connection(game, id_act, W);
+        id_right = game_get_connection(game, id_act, E);
+        left = graphic_engine_get_tile(ge, game, id_left);
+        act = graphic_engine_get_tile(ge, game, id_act);
+        right = graphic_engine_get_tile(ge, game, id_right);
+        l_walls = left != &ge->blank ? WALL : EMPTY;
+        r_walls = right != &ge->blank ? WALL : EMPTY;
+
+        /*The player is drawn over the blank start of the title of its space*/
+        text_builder_init(&line, title, TILE_WIDTH + 1);
+        text_builder_append_padded(&line, game_get_current_player_gdesc(game), 6);
+        text_builder_append(&line, act->lines[TILE_TITLE] + 6);
+
+        text_builder_init(&line, str, WIDTH_MAP + 1);
+        text_builder_append(&line, "        ");
+        text_builder_append(&line, left != &ge->blank ? FLOOR_ROOF : EMPTY_LONG_ROW);
+        text_builder_append(&line, " " FLOOR_ROOF " ");
+        text_builder_append(&line, right != &ge->blank ? FLOOR_ROOF : EMPTY_LONG_ROW);
+        screen_area_puts(ge->map, str);
+
+        for (i = 0; i < TILE_LINES; i++) {
+                text_builder_init(&line, str, WIDTH_MAP + 1);
+                text_builder_append(&line, "        ");
+                text_builder_append(&line, l_walls);
+                text_builder_append(&line, left->lines[i]);
+                text_builder_append(&line, l_walls);
+                text_builder_append(
+                    &line, i == TILE_GDESC + 1 && game_connection_is_open(game, id_act, W) == TRUE ? LEFT_ARROW : EMPTY);
+                text_builder_append(&line, WALL);
+                text_builder_append(&line, i == TILE_TITLE ? title : act->lines[i]);
+                text_builder_append(&line, WALL);
+                text_builder_append(
+                    &line, i == TILE_GDESC + 1 && game_connection_is_open(game, id_act, E) == TRUE ? RIGHT_ARROW : EMPTY);
+                text_builder_append(&line, r_walls);
+                text_builder_append(&line, right->lines[i]);
+                text_builder_append(&line, r_walls);
+                screen_area_puts(ge->map, str);
+        }
+
+        text_builder_init(&line, str, WIDTH_MAP + 1);
+        text_builder_append(&line, "        ");
+        text_builder_append(&line, left != &ge->blank ? FLOOR_ROOF : EMPTY_LONG_ROW);
+        text_builder_append(&line, " " FLOOR_ROOF " ");
+        text_builder_append(&line, right != &ge->blank ? FLOOR_ROOF : EMPTY_LONG_ROW);
+        screen_area_puts(ge->map, str);
 }
@@ -59,6 +59,16 @@ Status inventory_destroy(Inventory *inventory) {
         return OK;
 }
 
+Status inventory_copy(Inventory *inventory, const Inventory *source) {
+        if (!inventory || !source) {
+                return ERROR;
+        }
+
+        inventory->max_objs = source->max_objs;
+
+        return set_copy(inventory->objs, source->objs);
+}
+
 int inventory_get_max_objs(const Inventory *inventory) {
         /*Error control*/
         if (!inventory) {
@@ -94,6 +104,14 @@ Id inventory_get_object_id_at_index(const Inventory *inventory, int index) {
         return set_get_id_at_index(inventory->objs, index);
 }
 
+const Set *inventory_get_objects(const Inventory *inventory) {
+        /*Error control*/
+        if (!inventory) {
+                return NULL;
+        }
+        return inventory->objs;
+}
+
 Status inventory_add_object(Inventory *inventory, Id id) {
         /*Error control*/
         if ((!inventory) || (id == NO_ID) || set_get_nIds(inventory->objs) == inventory->max_objs) {
@@ -113,6 +131,15 @@ Id inventory_del_object(Inventory *inventory, Id id) {
         return set_del(inventory->objs, id);
 }
 
+Status inventory_move_object(Inventory *inventory, Id id, int index) {
+        /*Error control*/
+        if (!inventory || id == NO_ID) {
+                return ERROR;
+        }
+
+        return set_move(inventory->objs, id, index);
+}
+
 Bool inventory_has_object(const Inventory *inventory, Id object) {
         if (!inventory || object == NO_ID) {
                 return FALSE;
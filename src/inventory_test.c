@@ -73,6 +73,10 @@ int main(int argc, char **argv) {
         if (all || test == 17) test1_inventory_has_object();
         if (all || test == 18) test2_inventory_has_object();
         if (all || test == 19) test3_inventory_has_object();
+        if (all || test == 20) test1_inventory_copy();
+        if (all || test == 21) test2_inventory_copy();
+        if (all || test == 22) test1_inventory_move_object();
+        if (all || test == 23) test2_inventory_move_object();
 
 
         PRINT_PASSED_PERCENTAGE;
@@ -215,3 +219,43 @@ void test3_inventory_has_object(){
         inventory_add_object(i, 5);
         PRINT_TEST_RESULT(inventory_has_object(i, 5) == FALSE);
 }
+
+void test1_inventory_copy() {
+        Inventory *inventory = NULL, *copy = NULL;
+        inventory = inventory_create();
+        copy = inventory_create();
+        inventory_set_max_objs(inventory, 3);
+        inventory_add_object(inventory, 8);
+        PRINT_TEST_RESULT(inventory_copy(copy, inventory) == OK && inventory_get_max_objs(copy) == 3 &&
+                          inventory_get_num_objects(copy) == 1 && inventory_has_object(copy, 8) == TRUE);
+        inventory_destroy(inventory);
+        inventory_destroy(copy);
+}
+
+void test2_inventory_copy() {
+        Inventory *copy = NULL;
+        copy = inventory_create();
+        PRINT_TEST_RESULT(inventory_copy(copy, NULL) == ERROR);
+        inventory_destroy(copy);
+}
+
+void test1_inventory_move_object() {
+        Inventory *inventory = NULL;
+        inventory = inventory_create();
+        inventory_set_max_objs(inventory, 3);
+        inventory_add_object(inventory, 8);
+        inventory_add_object(inventory, 9);
+        PRINT_TEST_RESULT(inventory_move_object(inventory, 9, 0) == OK &&
+                          inventory_get_object_id_at_index(inventory, 0) == 9 &&
+                          inventory_get_object_id_at_index(inventory, 1) == 8);
+        inventory_destroy(inventory);
+}
+
+void test2_inventory_move_object() {
+        Inventory *inventory = NULL;
+        inventory = inventory_create();
+        inventory_set_max_objs(inventory, 3);
+        inventory_add_object(inventory, 8);
+        PRINT_TEST_RESULT(inventory_move_object(inventory, 8, 1) == ERROR);
+        inventory_destroy(inventory);
+}
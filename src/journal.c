@@ -0,0 +1,416 @@
+/**
+ * @brief It implements the journal module
+ *
+ * @file journal.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 23-05-2025
+ * @copyright GNU Public License
+ */
+
+/*write, ftruncate and the file descriptors are POSIX, not ANSI C*/
+#define _POSIX_C_SOURCE 200112L
+
+#include "journal.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "command.h"
+#include "game_actions.h"
+#include "text_builder.h"
+
+/**
+ * @def SNAPSHOT_SUFFIX
+ * @brief Defines what is added to the name of the journal to name its snapshot
+ */
+#define SNAPSHOT_SUFFIX ".snap"
+
+/**
+ * @def TEMPORARY_SUFFIX
+ * @brief Defines what is added to the name of the snapshot while it is being written
+ */
+#define TEMPORARY_SUFFIX ".tmp"
+
+/**
+ * @def MAX_RECORD
+ * @brief Defines the size of a record: its number, the outcome, the draws, the command and its argument
+ */
+#define MAX_RECORD 512
+
+/**
+ * @brief _Journal private struct
+ *
+ * Each record is a line "<number> <outcome> <draws> <draw>... <command> [<argument>]" written with a single write,
+ * so a crash can only leave the last line cut. The snapshot starts with the number of records it holds, so the
+ * records of the journal it already holds are skipped.
+ * */
+struct _Journal {
+        char *snapshot_name;  /**< Name of the snapshot file*/
+        char *temporary_name; /**< Name of the snapshot while it is being written*/
+        int fd;               /**< File descriptor of the journal, opened for appending*/
+        long n_records;       /**< Number of records of the session, the next record gets this number*/
+        long n_pending;       /**< Number of records in the journal file, not held by the snapshot*/
+};
+
+/*
+Private functions
+*/
+
+/**
+ * @brief Reads the snapshot of a journal, if there is one
+ * @author Abraham Martín
+ *
+ * @param journal Pointer to the journal
+ * @param game Pointer to pointer to the game being created, left as NULL if there is no snapshot
+ * @param state Pointer where the state of the rules is stored
+ * @return OK if there is no snapshot or it could be read, ERROR otherwise
+ */
+Status journal_read_snapshot(Journal *journal, Game **game, Rule_state *state);
+
+/**
+ * @brief Replays every complete record of the journal file not held by the snapshot, and drops the last record if
+ * it was cut
+ * @author Abraham Martín
+ *
+ * @param journal Pointer to the journal, with n_records set to the records held by the snapshot
+ * @param game Pointer to the game
+ * @param state Pointer to the state of the rules
+ * @return OK if every record had the outcome it recorded, ERROR otherwise
+ */
+Status journal_replay(Journal *journal, Game *game, Rule_state *state);
+
+/**
+ * @brief Parses a record and plays its turn
+ * @author Abraham Martín
+ *
+ * @param record Line of the record, without the newline
+ * @param number Pointer where the number of the record is stored
+ * @param game Pointer to the game, or NULL to only read the number
+ * @param state Pointer to the state of the rules
+ * @return OK if the record is well formed and its turn had the recorded outcome, ERROR otherwise
+ */
+Status journal_replay_record(char *record, long *number, Game *game, Rule_state *state);
+
+/**
+ * @brief Writes some bytes to the journal file, retrying if the write is interrupted or partial
+ * @author Abraham Martín
+ *
+ * @param fd File descriptor of the journal
+ * @param data Bytes to write
+ * @param length Number of bytes
+ * @return OK if every byte was written, ERROR otherwise
+ */
+Status journal_write(int fd, const char *data, int length);
+
+Journal *journal_open(const char *file_name) {
+        Journal *journal = NULL;
+        size_t length;
+
+        if (!file_name) {
+                return NULL;
+        }
+
+        journal = (Journal *)malloc(sizeof(Journal));
+        if (!journal) {
+                return NULL;
+        }
+        length = strlen(file_name) + strlen(SNAPSHOT_SUFFIX);
+        journal->snapshot_name = (char *)malloc(length + 1);
+        journal->temporary_name = (char *)malloc(length + strlen(TEMPORARY_SUFFIX) + 1);
+        journal->fd = open(file_name, O_RDWR | O_CREAT | O_APPEND, 0644);
+        if (!journal->snapshot_name || !journal->temporary_name || journal->fd == -1) {
+                if (journal->fd != -1) close(journal->fd);
+                free(journal->snapshot_name);
+                free(journal->temporary_name);
+                free(journal);
+                return NULL;
+        }
+        strcpy(journal->snapshot_name, file_name);
+        strcat(journal->snapshot_name, SNAPSHOT_SUFFIX);
+        strcpy(journal->temporary_name, journal->snapshot_name);
+        strcat(journal->temporary_name, TEMPORARY_SUFFIX);
+        journal->n_records = 0;
+        journal->n_pending = 0;
+
+        return journal;
+}
+
+void journal_close(Journal *journal) {
+        if (!journal) {
+                return;
+        }
+
+        close(journal->fd);
+        free(journal->snapshot_name);
+        free(journal->temporary_name);
+        free(journal);
+}
+
+Status journal_recover(Journal *journal, Game **game, char *world_file, Rule_state *state) {
+        if (!journal || !game || !world_file || !state) {
+                return ERROR;
+        }
+
+        *game = NULL;
+        state->turn = 1;
+        state->times_feeded = 0;
+        state->spider_is_dead = FALSE;
+        journal->n_records = 0;
+        journal->n_pending = 0;
+
+        if (journal_read_snapshot(journal, game, state) == ERROR) {
+                fprintf(stderr, "Error while reading %s.\n", journal->snapshot_name);
+                return ERROR;
+        }
+        if (!*game && game_create_from_file(game, world_file) == ERROR) {
+                game_destroy(*game);
+                *game = NULL;
+                return ERROR;
+        }
+
+        if (journal_replay(journal, *game, state) == ERROR) {
+                game_destroy(*game);
+                *game = NULL;
+                return ERROR;
+        }
+
+        /*The turns played from now on draw new numbers*/
+        game_set_forced_draws(*game, NULL, 0);
+
+        return OK;
+}
+
+Status journal_append(Journal *journal, Game *game, const Rule_state *state) {
+        Text_builder tb;
+        Command *command = NULL;
+        char record[MAX_RECORD];
+        const int *draws = NULL;
+        int i, n_draws;
+
+        if (!journal || !game || !state || !(command = game_get_last_command(game))) {
+                return ERROR;
+        }
+
+        n_draws = game_get_n_draws(game);
+        draws = game_get_draws(game);
+        text_builder_init(&tb, record, MAX_RECORD);
+        text_builder_append_number(&tb, journal->n_records, 0);
+        text_builder_append(&tb, " ");
+        text_builder_append_number(&tb, command_get_success(command) == OK ? 1 : 0, 0);
+        text_builder_append(&tb, " ");
+        text_builder_append_number(&tb, n_draws, 0);
+        for (i = 0; i < n_draws; i++) {
+                text_builder_append(&tb, " ");
+                text_builder_append_number(&tb, draws[i], 0);
+        }
+        text_builder_append(&tb, " ");
+        text_builder_append(&tb, command_get_string_code(command));
+        if (command_get_arg(command)[0] != '\0') {
+                text_builder_append(&tb, " ");
+                text_builder_append(&tb, command_get_arg(command));
+        }
+        text_builder_append(&tb, "\n");
+        if (text_builder_is_truncated(&tb) == TRUE ||
+            journal_write(journal->fd, record, text_builder_get_length(&tb)) == ERROR) {
+                return ERROR;
+        }
+        journal->n_records++;
+        journal->n_pending++;
+
+        if (journal->n_pending >= JOURNAL_SNAPSHOT_RECORDS) {
+                return journal_compact(journal, game, state);
+        }
+
+        return OK;
+}
+
+Status journal_compact(Journal *journal, Game *game, const Rule_state *state) {
+        FILE *f = NULL;
+        long header[4];
+        Status status;
+
+        if (!journal || !game || !state) {
+                return ERROR;
+        }
+
+        f = fopen(journal->temporary_name, "wb");
+        if (!f) {
+                return ERROR;
+        }
+        header[0] = journal->n_records;
+        header[1] = state->turn;
+        header[2] = state->times_feeded;
+        header[3] = state->spider_is_dead;
+        fwrite(header, sizeof(long), 4, f);
+        status = game_write_snapshot((const Game *)game, f);
+        if (fclose(f) != 0 || status == ERROR) {
+                remove(journal->temporary_name);
+                return ERROR;
+        }
+
+        /*The snapshot replaces the old one at once, a crash before emptying the journal only leaves records that the
+         next recovery skips*/
+        if (rename(journal->temporary_name, journal->snapshot_name) != 0) {
+                remove(journal->temporary_name);
+                return ERROR;
+        }
+        if (ftruncate(journal->fd, 0) == -1) {
+                return ERROR;
+        }
+        journal->n_pending = 0;
+        game_forget_history(game);
+
+        return OK;
+}
+
+long journal_get_n_records(const Journal *journal) {
+        if (!journal) {
+                return -1;
+        }
+
+        return journal->n_records;
+}
+
+/**
+   Implementation of private functions
+*/
+
+Status journal_read_snapshot(Journal *journal, Game **game, Rule_state *state) {
+        FILE *f = NULL;
+        long header[4];
+
+        f = fopen(journal->snapshot_name, "rb");
+        if (!f) {
+                return OK;
+        }
+
+        if (fread(header, sizeof(long), 4, f) != 4 || header[0] < 0 || game_read_snapshot(game, f) == ERROR) {
+                fclose(f);
+                return ERROR;
+        }
+        fclose(f);
+        journal->n_records = header[0];
+        state->turn = (int)header[1];
+        state->times_feeded = (int)header[2];
+        state->spider_is_dead = header[3] ? TRUE : FALSE;
+
+        return OK;
+}
+
+Status journal_replay(Journal *journal, Game *game, Rule_state *state) {
+        struct stat info;
+        char *data = NULL, *line = NULL, *end = NULL, *next = NULL;
+        long size, done = 0, number;
+        ssize_t n;
+
+        if (fstat(journal->fd, &info) == -1) {
+                return ERROR;
+        }
+        size = (long)info.st_size;
+        data = (char *)malloc(size + 1);
+        if (!data) {
+                return ERROR;
+        }
+        if (lseek(journal->fd, 0, SEEK_SET) == -1) {
+                free(data);
+                return ERROR;
+        }
+        while (done < size) {
+                n = read(journal->fd, data + done, (size_t)(size - done));
+                if (n < 0 && errno == EINTR) {
+                        continue;
+                }
+                if (n <= 0) {
+                        free(data);
+                        return ERROR;
+                }
+                done += n;
+        }
+        end = data + size;
+
+        for (line = data; line < end; line = next + 1) {
+                next = (char *)memchr(line, '\n', end - line);
+                if (!next) {
+                        /*The last record was being written when the program died*/
+                        if (ftruncate(journal->fd, (off_t)(line - data)) == -1) {
+                                free(data);
+                                return ERROR;
+                        }
+                        break;
+                }
+                *next = '\0';
+
+                /*Records already held by the snapshot are only counted*/
+                if (journal_replay_record(line, &number, NULL, state) == ERROR) {
+                        fprintf(stderr, "Malformed journal record %ld.\n", journal->n_records);
+                        free(data);
+                        return ERROR;
+                }
+                if (number < journal->n_records) {
+                        continue;
+                }
+                if (number != journal->n_records || journal_replay_record(line, &number, game, state) == ERROR) {
+                        fprintf(stderr, "Journal record %ld does not match the game.\n", number);
+                        free(data);
+                        return ERROR;
+                }
+                journal->n_records++;
+                journal->n_pending++;
+        }
+
+        free(data);
+
+        return OK;
+}
+
+Status journal_replay_record(char *record, long *number, Game *game, Rule_state *state) {
+        Command *command = NULL;
+        int draws[MAX_DRAWS];
+        long success, n_draws, i;
+        char *cursor = NULL;
+
+        *number = strtol(record, &cursor, 10);
+        if (cursor == record) return ERROR;
+        success = strtol(cursor, &cursor, 10);
+        n_draws = strtol(cursor, &cursor, 10);
+        if (n_draws < 0 || n_draws > MAX_DRAWS) return ERROR;
+        for (i = 0; i < n_draws; i++) {
+                draws[i] = (int)strtol(cursor, &cursor, 10);
+        }
+        if (*cursor != ' ') return ERROR;
+        if (!game) return OK;
+
+        /*The turn is played as the game loop plays it, with the numbers it drew*/
+        command = game_get_last_command(game);
+        command_parse(command, cursor + 1);
+        game_set_forced_draws(game, draws, (int)n_draws);
+        game_actions_update(game, command);
+        game_rule_update(game, command, state->turn, &state->times_feeded, &state->spider_is_dead);
+        state->turn++;
+
+        return (command_get_success(command) == OK) == (success == 1) ? OK : ERROR;
+}
+
+Status journal_write(int fd, const char *data, int length) {
+        int done = 0;
+        ssize_t n;
+
+        while (done < length) {
+                n = write(fd, data + done, (size_t)(length - done));
+                if (n < 0 && errno == EINTR) {
+                        continue;
+                }
+                if (n <= 0) {
+                        return ERROR;
+                }
+                done += (int)n;
+        }
+
+        return OK;
+}
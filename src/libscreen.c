@@ -0,0 +1,405 @@
+/**
+ * @brief It implements the screen interface, sending to the terminal only the cells that changed since the last frame
+ *
+ * @file libscreen.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 19-05-2025
+ * @copyright GNU Public License
+ */
+
+/*write and the file descriptors are POSIX, not ANSI C*/
+#define _POSIX_C_SOURCE 200112L
+
+#include "libscreen.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/**
+ * @def BG_CHAR
+ * @brief Defines the character of the cells that are not in any area
+ */
+#define BG_CHAR '~'
+
+/**
+ * @def FG_CHAR
+ * @brief Defines the character of the empty cells of an area
+ */
+#define FG_CHAR ' '
+
+/**
+ * @def FG_COLOR
+ * @brief Defines the attributes of the cells of the areas: black over white
+ */
+#define FG_COLOR "\033[0;30;47m"
+
+/**
+ * @def RESET_COLOR
+ * @brief Defines the escape sequence that goes back to the default attributes
+ */
+#define RESET_COLOR "\033[0m"
+
+/**
+ * @def CLEAR_SCREEN
+ * @brief Defines the escape sequence that clears the terminal
+ */
+#define CLEAR_SCREEN "\033[2J"
+
+/**
+ * @def CLEAR_BELOW
+ * @brief Defines the escape sequence that clears from the cursor to the end of the terminal
+ */
+#define CLEAR_BELOW "\033[J"
+
+/**
+ * @def ESCAPE_SIZE
+ * @brief Defines the room needed by the longest escape sequence written to a frame
+ */
+#define ESCAPE_SIZE 32
+
+/**
+ * @def MAX_GAP
+ * @brief Defines the longest run of unchanged cells that is sent again instead of moving the cursor over it, as
+ * moving it takes more bytes
+ */
+#define MAX_GAP 4
+
+/**
+ * @def INITIAL_OUTPUT_SIZE
+ * @brief Defines the initial size of the buffer where the frames are built
+ */
+#define INITIAL_OUTPUT_SIZE 4096
+
+/**
+ * @def NO_COLOR
+ * @brief Defines the color of a cell that has never been sent to the terminal
+ */
+#define NO_COLOR -1
+
+/**
+ * @brief _Area private struct
+ * */
+struct _Area {
+        int x;      /**< Column of the up-left corner*/
+        int y;      /**< Row of the up-left corner*/
+        int width;  /**< Number of columns*/
+        int height; /**< Number of rows*/
+        int cursor; /**< Row of the area where the next string is written*/
+};
+
+/**
+ * @brief Screen
+ *
+ * The screen being composed and the one the terminal is showing, cell by cell, with the frame color of each.
+ * */
+typedef struct {
+        char *data;           /**< Cells of the screen being composed*/
+        char *shown;          /**< Cells the terminal is showing*/
+        int *shown_color;     /**< Frame color the terminal is showing in each cell, NO_COLOR if it was never sent*/
+        int rows;             /**< Number of rows*/
+        int columns;          /**< Number of columns*/
+        char *output;         /**< Buffer where each frame is built before writing it*/
+        size_t output_size;   /**< Size of output*/
+        size_t output_length; /**< Number of bytes of output in use*/
+} Screen;
+
+/**
+ * @brief The screen every area belongs to
+ */
+static Screen screen = {NULL, NULL, NULL, 0, 0, NULL, 0, 0};
+
+/*
+Private functions
+*/
+
+/**
+ * @brief Retrieves the escape sequence that sets the attributes of the cells outside the areas
+ * @author Abraham Martín
+ *
+ * @param color Frame color
+ * @return The escape sequence
+ */
+const char *frame_color_to_string(Frame_color color);
+
+/**
+ * @brief Appends some bytes to the frame being built, growing the buffer if needed
+ * @author Abraham Martín
+ *
+ * @param str Bytes to append
+ * @param length Number of bytes
+ * @return 0 if they could be appended, -1 otherwise
+ */
+int screen_output_append(const char *str, size_t length);
+
+/**
+ * @brief Writes the whole frame to the terminal, retrying if the write is interrupted or partial
+ * @author Abraham Martín
+ */
+void screen_output_flush(void);
+
+/**
+ * @brief It asserts whether the cursor of an area is below its last row
+ * @author Abraham Martín
+ *
+ * @param area Pointer to an area
+ * @return 1 if the cursor is out of the area, 0 otherwise
+ */
+int screen_area_cursor_is_out_of_bounds(Area *area);
+
+/**
+ * @brief Moves every row of an area one row up, leaving the cursor on the last one
+ * @author Abraham Martín
+ *
+ * @param area Pointer to an area
+ */
+void screen_area_scroll_up(Area *area);
+
+void screen_init(int rows, int columns) {
+        int i;
+
+        screen_destroy();
+        if (rows <= 0 || columns <= 0) {
+                return;
+        }
+
+        screen.data = (char *)malloc(rows * columns);
+        screen.shown = (char *)malloc(rows * columns);
+        screen.shown_color = (int *)malloc(rows * columns * sizeof(int));
+        screen.output = (char *)malloc(INITIAL_OUTPUT_SIZE);
+        if (!screen.data || !screen.shown || !screen.shown_color || !screen.output) {
+                screen_destroy();
+                return;
+        }
+        screen.rows = rows;
+        screen.columns = columns;
+        screen.output_size = INITIAL_OUTPUT_SIZE;
+        screen.output_length = 0;
+
+        memset(screen.data, BG_CHAR, rows * columns);
+        for (i = 0; i < rows * columns; i++) {
+                screen.shown_color[i] = NO_COLOR;
+        }
+
+        /*The first frame is painted over a clear terminal*/
+        screen_output_append(CLEAR_SCREEN, strlen(CLEAR_SCREEN));
+}
+
+void screen_destroy(void) {
+        free(screen.data);
+        free(screen.shown);
+        free(screen.shown_color);
+        free(screen.output);
+        screen.data = NULL;
+        screen.shown = NULL;
+        screen.shown_color = NULL;
+        screen.output = NULL;
+        screen.rows = 0;
+        screen.columns = 0;
+        screen.output_size = 0;
+        screen.output_length = 0;
+}
+
+void screen_paint(Frame_color color) {
+        char escape[ESCAPE_SIZE];
+        const char *attributes = NULL, *current = NULL;
+        int row, column, cell, next = -1, i;
+        int changed, bridge;
+
+        if (!screen.data) {
+                return;
+        }
+
+        /*Whatever was printed before must reach the terminal before this frame*/
+        fflush(stdout);
+
+        for (row = 0; row < screen.rows; row++) {
+                for (column = 0; column < screen.columns; column++) {
+                        cell = row * screen.columns + column;
+                        changed = screen.shown_color[cell] == NO_COLOR || screen.shown[cell] != screen.data[cell] ||
+                                  (screen.data[cell] == BG_CHAR && screen.shown_color[cell] != (int)color);
+                        if (!changed) {
+                                continue;
+                        }
+
+                        /*A short run of unchanged cells with the same attributes is cheaper to send again*/
+                        bridge = next != -1 && cell > next && cell - next <= MAX_GAP && next / screen.columns == row;
+                        for (i = next; bridge && i < cell; i++) {
+                                bridge = (screen.data[i] == BG_CHAR ? frame_color_to_string(color) : FG_COLOR) == current;
+                        }
+                        if (bridge) {
+                                screen_output_append(&screen.data[next], cell - next);
+                        } else if (cell != next) {
+                                /*The cursor only has to be moved when the cell does not follow the last one sent*/
+                                sprintf(escape, "\033[%d;%dH", row + 1, column + 1);
+                                screen_output_append(escape, strlen(escape));
+                        }
+                        attributes = screen.data[cell] == BG_CHAR ? frame_color_to_string(color) : FG_COLOR;
+                        if (attributes != current) {
+                                screen_output_append(attributes, strlen(attributes));
+                                current = attributes;
+                        }
+                        screen_output_append(&screen.data[cell], 1);
+
+                        screen.shown[cell] = screen.data[cell];
+                        screen.shown_color[cell] = (int)color;
+                        next = column + 1 < screen.columns ? cell + 1 : -1;
+                }
+        }
+
+        /*The prompt goes below the screen, over whatever was typed in the last turn*/
+        if (current) {
+                screen_output_append(RESET_COLOR, strlen(RESET_COLOR));
+        }
+        sprintf(escape, "\033[%d;1H", screen.rows + 1);
+        screen_output_append(escape, strlen(escape));
+        screen_output_append(CLEAR_BELOW, strlen(CLEAR_BELOW));
+
+        screen_output_flush();
+}
+
+Area *screen_area_init(int x, int y, int width, int height) {
+        Area *area = NULL;
+
+        if (!screen.data || x < 0 || y < 0 || width <= 0 || height <= 0 || x + width > screen.columns ||
+            y + height > screen.rows) {
+                return NULL;
+        }
+
+        area = (Area *)malloc(sizeof(Area));
+        if (!area) {
+                return NULL;
+        }
+        area->x = x;
+        area->y = y;
+        area->width = width;
+        area->height = height;
+        screen_area_clear(area);
+
+        return area;
+}
+
+void screen_area_destroy(Area *area) { free(area); }
+
+void screen_area_clear(Area *area) {
+        int i;
+
+        if (!area || !screen.data) {
+                return;
+        }
+
+        screen_area_reset_cursor(area);
+        for (i = 0; i < area->height; i++) {
+                memset(screen.data + (area->y + i) * screen.columns + area->x, FG_CHAR, area->width);
+        }
+}
+
+void screen_area_reset_cursor(Area *area) {
+        if (area) {
+                area->cursor = 0;
+        }
+}
+
+void screen_area_puts(Area *area, char *str) {
+        char *line = NULL;
+        int i, length;
+
+        if (!area || !str || !screen.data) {
+                return;
+        }
+
+        /*Strings wider than the area go on as many rows as needed*/
+        for (length = (int)strlen(str); length > 0; str += area->width, length -= area->width) {
+                if (screen_area_cursor_is_out_of_bounds(area)) {
+                        screen_area_scroll_up(area);
+                }
+
+                line = screen.data + (area->y + area->cursor) * screen.columns + area->x;
+                memset(line, FG_CHAR, area->width);
+                for (i = 0; i < area->width && i < length; i++) {
+                        /*A cell holds one byte, so multibyte characters (accents) are shown as '?'*/
+                        line[i] = ((unsigned char)str[i] < ' ' || (unsigned char)str[i] > '~') ? '?' : str[i];
+                }
+                area->cursor++;
+        }
+}
+
+/**
+   Implementation of private functions
+*/
+
+const char *frame_color_to_string(Frame_color color) {
+        switch (color) {
+                case GREEN:
+                        return "\033[0;34;42m";
+                case BLACK:
+                        return "\033[0;30;40m";
+                case RED:
+                        return "\033[0;34;41m";
+                case YELLOW:
+                        return "\033[0;34;43m";
+                case PURPLE:
+                        return "\033[0;34;45m";
+                case CYAN:
+                        return "\033[0;34;46m";
+                case WHITE:
+                        return "\033[0;34;47m";
+                case BLUE:
+                default:
+                        return "\033[0;34;44m";
+        }
+}
+
+int screen_output_append(const char *str, size_t length) {
+        char *output = NULL;
+        size_t size;
+
+        if (screen.output_length + length > screen.output_size) {
+                size = 2 * screen.output_size;
+                while (screen.output_length + length > size) {
+                        size *= 2;
+                }
+                if (!(output = (char *)realloc(screen.output, size))) {
+                        return -1;
+                }
+                screen.output = output;
+                screen.output_size = size;
+        }
+        memcpy(screen.output + screen.output_length, str, length);
+        screen.output_length += length;
+
+        return 0;
+}
+
+void screen_output_flush(void) {
+        size_t done = 0;
+        ssize_t n;
+
+        while (done < screen.output_length) {
+                n = write(STDOUT_FILENO, screen.output + done, screen.output_length - done);
+                if (n < 0 && errno == EINTR) {
+                        continue;
+                }
+                if (n <= 0) {
+                        break;
+                }
+                done += n;
+        }
+        screen.output_length = 0;
+}
+
+int screen_area_cursor_is_out_of_bounds(Area *area) { return area->cursor >= area->height; }
+
+void screen_area_scroll_up(Area *area) {
+        int i;
+        char *row = NULL;
+
+        for (i = 0; i < area->height - 1; i++) {
+                row = screen.data + (area->y + i) * screen.columns + area->x;
+                memcpy(row, row + screen.columns, area->width);
+        }
+        area->cursor = area->height - 1;
+}
@@ -58,6 +58,22 @@ Status link_destroy(Link *link) {
         return OK;
 }
 
+Link *link_copy(const Link *link) {
+        Link *copy = NULL;
+
+        if (link == NULL) {
+                return NULL;
+        }
+
+        copy = (Link *)malloc(sizeof(Link));
+        if (copy == NULL) {
+                return NULL;
+        }
+        *copy = *link;
+
+        return copy;
+}
+
 Status link_set_id(Link *link, Id id) {
         if (link == NULL || id == NO_ID) {
                 return ERROR;
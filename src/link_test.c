@@ -81,6 +81,8 @@ int main(int argc, char **argv) {
         if (all || test == 31) test3_link_set_open();
         if (all || test == 32) test1_link_get_open();
         if (all || test == 33) test2_link_get_open();
+        if (all || test == 34) test1_link_copy();
+        if (all || test == 35) test2_link_copy();
 
         PRINT_PASSED_PERCENTAGE;
 
@@ -278,3 +280,19 @@ void test1_link_get_open() {
 }
 
 void test2_link_get_open() { PRINT_TEST_RESULT(link_get_open(NULL) == FALSE); }
+
+void test1_link_copy() {
+        Link *l = NULL, *copy = NULL;
+        l = link_create(5);
+        link_set_origin(l, 11);
+        link_set_open(l, TRUE);
+        copy = link_copy(l);
+        PRINT_TEST_RESULT(copy != NULL && link_get_id(copy) == 5 && link_get_origin(copy) == 11 &&
+                          link_get_open(copy) == TRUE);
+        link_destroy(l);
+        link_destroy(copy);
+}
+
+void test2_link_copy() {
+        PRINT_TEST_RESULT(link_copy(NULL) == NULL);
+}
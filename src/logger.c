@@ -0,0 +1,170 @@
+/**
+ * @brief It implements the logger module
+ *
+ * @file logger.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 22-05-2025
+ * @copyright GNU Public License
+ */
+
+/*write and the file descriptors are POSIX, not ANSI C*/
+#define _POSIX_C_SOURCE 200112L
+
+#include "logger.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief _Logger private struct
+ *
+ * The records are kept in the buffer one after the other, each one ending with a newline, until the buffer is full
+ * or the oldest pending record has waited too long. Then the whole buffer is written at once.
+ * */
+struct _Logger {
+        int fd;         /**< File descriptor of the log file, opened for appending*/
+        char *buffer;   /**< Records not written yet*/
+        int length;     /**< Number of bytes of buffer in use*/
+        time_t oldest;  /**< Time when the oldest pending record was added*/
+};
+
+/*
+Private functions
+*/
+
+/**
+ * @brief Writes some bytes to the log file, retrying if the write is interrupted or partial
+ * @author Abraham Martín
+ *
+ * @param fd File descriptor of the log file
+ * @param data Bytes to write
+ * @param length Number of bytes
+ * @return OK if every byte was written, ERROR otherwise
+ */
+Status logger_write(int fd, const char *data, int length);
+
+Logger *logger_create(const char *file_name) {
+        Logger *logger = NULL;
+
+        if (!file_name) {
+                return NULL;
+        }
+
+        logger = (Logger *)malloc(sizeof(Logger));
+        if (!logger) {
+                return NULL;
+        }
+        logger->buffer = (char *)malloc(LOGGER_BUFFER_SIZE);
+        if (!logger->buffer) {
+                free(logger);
+                return NULL;
+        }
+        logger->fd = open(file_name, O_WRONLY | O_CREAT | O_APPEND, 0644);
+        if (logger->fd == -1) {
+                free(logger->buffer);
+                free(logger);
+                return NULL;
+        }
+        logger->length = 0;
+        logger->oldest = 0;
+
+        return logger;
+}
+
+void logger_destroy(Logger *logger) {
+        if (!logger) {
+                return;
+        }
+
+        logger_flush(logger);
+        close(logger->fd);
+        free(logger->buffer);
+        free(logger);
+}
+
+Status logger_append(Logger *logger, const char *record) {
+        int length;
+
+        if (!logger) {
+                return OK;
+        }
+        if (!record) {
+                return ERROR;
+        }
+
+        length = (int)strlen(record);
+        if (logger->length + length + 1 > LOGGER_BUFFER_SIZE && logger_flush(logger) == ERROR) {
+                return ERROR;
+        }
+
+        /*A record that does not fit even in the empty buffer is written on its own*/
+        if (length + 1 > LOGGER_BUFFER_SIZE) {
+                if (logger_write(logger->fd, record, length) == ERROR) {
+                        return ERROR;
+                }
+                return logger_write(logger->fd, "\n", 1);
+        }
+
+        if (logger->length == 0) {
+                logger->oldest = time(NULL);
+        }
+        memcpy(logger->buffer + logger->length, record, length);
+        logger->buffer[logger->length + length] = '\n';
+        logger->length += length + 1;
+
+        if (difftime(time(NULL), logger->oldest) >= LOGGER_FLUSH_SECONDS) {
+                return logger_flush(logger);
+        }
+
+        return OK;
+}
+
+Status logger_flush(Logger *logger) {
+        Status status;
+
+        if (!logger || logger->length == 0) {
+                return OK;
+        }
+
+        status = logger_write(logger->fd, logger->buffer, logger->length);
+        logger->length = 0;
+
+        return status;
+}
+
+int logger_get_pending(const Logger *logger) {
+        if (!logger) {
+                return -1;
+        }
+
+        return logger->length;
+}
+
+/**
+   Implementation of private functions
+*/
+
+Status logger_write(int fd, const char *data, int length) {
+        int done = 0;
+        ssize_t n;
+
+        while (done < length) {
+                n = write(fd, data + done, (size_t)(length - done));
+                if (n < 0 && errno == EINTR) {
+                        continue;
+                }
+                if (n <= 0) {
+                        return ERROR;
+                }
+                done += (int)n;
+        }
+
+        return OK;
+}
@@ -0,0 +1,155 @@
+/**
+ * @brief It tests the logger module
+ *
+ * @file logger_test.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 22-05-2025
+ * @copyright GNU Public License
+ */
+
+#include "logger.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "logger_test.h"
+#include "test.h"
+
+/**
+ * @def MAX_TESTS
+ * @brief Defines the maximum number of tests
+ */
+#define MAX_TESTS 9
+
+/**
+ * @def TEST_FILE
+ * @brief Defines the name of the file written by the tests
+ */
+#define TEST_FILE "logger_test.log"
+
+/**
+ * @brief Reads the test file
+ *
+ * @param contents String where the file is copied
+ * @param size Size of contents
+ * @return Number of bytes read
+ */
+int logger_test_read(char *contents, int size);
+
+/**
+ * @brief Main function for LOGGER unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv) {
+        int test = 0;
+        int all = 1;
+
+        if (argc < 2) {
+                printf("Running all test for module Logger:\n");
+        } else {
+                test = atoi(argv[1]);
+                all = 0;
+                printf("Running test %d:\t", test);
+                if (test < 1 && test > MAX_TESTS) {
+                        printf("Error: unknown test %d\t", test);
+                        exit(EXIT_SUCCESS);
+                }
+        }
+
+        if (all || test == 1) test1_logger_create();
+        if (all || test == 2) test2_logger_create();
+        if (all || test == 3) test1_logger_append();
+        if (all || test == 4) test2_logger_append();
+        if (all || test == 5) test3_logger_append();
+        if (all || test == 6) test1_logger_flush();
+        if (all || test == 7) test2_logger_flush();
+        if (all || test == 8) test1_logger_destroy();
+        if (all || test == 9) test1_logger_get_pending();
+
+        remove(TEST_FILE);
+
+        PRINT_PASSED_PERCENTAGE;
+
+        return EXIT_SUCCESS;
+}
+
+int logger_test_read(char *contents, int size) {
+        FILE *f = NULL;
+        int n;
+
+        f = fopen(TEST_FILE, "r");
+        if (!f) {
+                return 0;
+        }
+        n = (int)fread(contents, 1, size - 1, f);
+        contents[n] = '\0';
+        fclose(f);
+
+        return n;
+}
+
+void test1_logger_create() {
+        Logger *logger = NULL;
+        remove(TEST_FILE);
+        logger = logger_create(TEST_FILE);
+        PRINT_TEST_RESULT(logger != NULL);
+        logger_destroy(logger);
+}
+
+void test2_logger_create() { PRINT_TEST_RESULT(logger_create(NULL) == NULL); }
+
+void test1_logger_append() {
+        Logger *logger = NULL;
+        remove(TEST_FILE);
+        logger = logger_create(TEST_FILE);
+        PRINT_TEST_RESULT(logger_append(logger, "Take Leaf: OK (ant)") == OK && logger_get_pending(logger) == 20);
+        logger_destroy(logger);
+}
+
+void test2_logger_append() { PRINT_TEST_RESULT(logger_append(NULL, "Take Leaf: OK (ant)") == OK); }
+
+void test3_logger_append() {
+        Logger *logger = NULL;
+        char record[LOGGER_BUFFER_SIZE / 2 + 1];
+        remove(TEST_FILE);
+        logger = logger_create(TEST_FILE);
+        memset(record, 'a', sizeof(record) - 1);
+        record[sizeof(record) - 1] = '\0';
+        logger_append(logger, record);
+        PRINT_TEST_RESULT(logger_append(logger, record) == OK && logger_get_pending(logger) == (int)sizeof(record));
+        logger_destroy(logger);
+}
+
+void test1_logger_flush() {
+        Logger *logger = NULL;
+        char contents[64];
+        remove(TEST_FILE);
+        logger = logger_create(TEST_FILE);
+        logger_append(logger, "Move North: OK (ant)");
+        logger_append(logger, "Take Leaf: ERROR (mouse)");
+        PRINT_TEST_RESULT(logger_flush(logger) == OK && logger_get_pending(logger) == 0 &&
+                          logger_test_read(contents, sizeof(contents)) > 0 &&
+                          !strcmp(contents, "Move North: OK (ant)\nTake Leaf: ERROR (mouse)\n"));
+        logger_destroy(logger);
+}
+
+void test2_logger_flush() { PRINT_TEST_RESULT(logger_flush(NULL) == OK); }
+
+void test1_logger_destroy() {
+        Logger *logger = NULL;
+        char contents[64];
+        remove(TEST_FILE);
+        logger = logger_create(TEST_FILE);
+        logger_append(logger, "Exit : OK (bug)");
+        logger_destroy(logger);
+        PRINT_TEST_RESULT(logger_test_read(contents, sizeof(contents)) > 0 && !strcmp(contents, "Exit : OK (bug)\n"));
+}
+
+void test1_logger_get_pending() { PRINT_TEST_RESULT(logger_get_pending(NULL) == -1); }
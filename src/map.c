@@ -0,0 +1,300 @@
+/**
+ * @brief It implements the map module
+ *
+ * @file map.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 10-05-2025
+ * @copyright GNU Public License
+ */
+
+#include "map.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "set.h"
+
+/**
+ * @def INITIAL_SLOTS
+ * @brief Defines the number of slots reserved the first time a key is stored
+ */
+#define INITIAL_SLOTS 8
+
+/**
+ * @brief _Map private struct
+ *
+ * Open addressing with linear probing. A slot is free when its key is NO_ID, and the table
+ * doubles whenever it gets half full.
+ * */
+struct _Map {
+        Id* keys;     /**< Keys of the table, NO_ID marks a free slot*/
+        long* values; /**< Value of each slot*/
+        int n_keys;   /**< Number of keys stored*/
+        int n_slots;  /**< Size of the table, always a power of two*/
+};
+
+/*
+Private functions
+*/
+
+/**
+ * @brief Finds the slot that holds a key
+ * @author Abraham Martín
+ *
+ * @param m Pointer to a map
+ * @param key Id to be found
+ * @return The slot of the key, or -1 if it is not in the map
+ */
+int map_find_slot(const Map* m, Id key);
+
+/**
+ * @brief Moves every key to a bigger table
+ * @author Abraham Martín
+ *
+ * @param m Pointer to a map
+ * @param n_slots Size of the new table, a power of two bigger than the current one
+ * @return OK if the memory could be reserved, ERROR otherwise
+ */
+Status map_grow(Map* m, int n_slots);
+
+Map* map_create(void) {
+        Map* m = NULL;
+
+        m = (Map*)malloc(sizeof(Map));
+        if (!m) {
+                return NULL;
+        }
+        m->keys = NULL;
+        m->values = NULL;
+        m->n_keys = 0;
+        m->n_slots = 0;
+
+        return m;
+}
+
+Status map_destroy(Map* m) {
+        if (m) {
+                free(m->keys);
+                free(m->values);
+        }
+        free(m);
+
+        return OK;
+}
+
+Status map_copy(Map* m, const Map* source) {
+        Id* keys = NULL;
+        long* values = NULL;
+
+        if (!m || !source) {
+                return ERROR;
+        }
+
+        /*The table takes the size of the source one, so every key stays in its slot and nothing is rehashed*/
+        if (m->n_slots != source->n_slots) {
+                if (source->n_slots > 0) {
+                        keys = (Id*)malloc(source->n_slots * sizeof(Id));
+                        values = (long*)malloc(source->n_slots * sizeof(long));
+                        if (!keys || !values) {
+                                free(keys);
+                                free(values);
+                                return ERROR;
+                        }
+                }
+                free(m->keys);
+                free(m->values);
+                m->keys = keys;
+                m->values = values;
+                m->n_slots = source->n_slots;
+        }
+        if (source->n_slots > 0) {
+                memcpy(m->keys, source->keys, source->n_slots * sizeof(Id));
+                memcpy(m->values, source->values, source->n_slots * sizeof(long));
+        }
+        m->n_keys = source->n_keys;
+
+        return OK;
+}
+
+int map_get_n_keys(const Map* m) {
+        if (!m) {
+                return -1;
+        }
+
+        return m->n_keys;
+}
+
+Status map_set(Map* m, Id key, long value) {
+        int slot;
+
+        if (!m || key == NO_ID) {
+                return ERROR;
+        }
+
+        slot = map_find_slot(m, key);
+        if (slot != -1) {
+                m->values[slot] = value;
+                return OK;
+        }
+
+        if (2 * (m->n_keys + 1) > m->n_slots && map_grow(m, m->n_slots == 0 ? INITIAL_SLOTS : 2 * m->n_slots) == ERROR) {
+                return ERROR;
+        }
+
+        slot = set_hash_id(key, m->n_slots);
+        while (m->keys[slot] != NO_ID) {
+                slot = (slot + 1) & (m->n_slots - 1);
+        }
+        m->keys[slot] = key;
+        m->values[slot] = value;
+        m->n_keys++;
+
+        return OK;
+}
+
+long map_get(const Map* m, Id key) {
+        int slot;
+
+        if (!m || key == NO_ID) {
+                return NO_ID;
+        }
+
+        slot = map_find_slot(m, key);
+        if (slot == -1) {
+                return NO_ID;
+        }
+
+        return m->values[slot];
+}
+
+Bool map_has(const Map* m, Id key) {
+        if (!m || key == NO_ID) {
+                return FALSE;
+        }
+
+        return map_find_slot(m, key) != -1 ? TRUE : FALSE;
+}
+
+Status map_del(Map* m, Id key) {
+        int slot, next, home;
+
+        if (!m || key == NO_ID) {
+                return ERROR;
+        }
+
+        slot = map_find_slot(m, key);
+        if (slot == -1) {
+                return ERROR;
+        }
+
+        /*Backward shift deletion, the following keys of the cluster are pulled back*/
+        m->keys[slot] = NO_ID;
+        m->n_keys--;
+        next = (slot + 1) & (m->n_slots - 1);
+        while (m->keys[next] != NO_ID) {
+                home = set_hash_id(m->keys[next], m->n_slots);
+                if (((next - home) & (m->n_slots - 1)) >= ((next - slot) & (m->n_slots - 1))) {
+                        m->keys[slot] = m->keys[next];
+                        m->values[slot] = m->values[next];
+                        m->keys[next] = NO_ID;
+                        slot = next;
+                }
+                next = (next + 1) & (m->n_slots - 1);
+        }
+
+        return OK;
+}
+
+Status map_reserve(Map* m, int n_keys) {
+        int n_slots;
+
+        if (!m || n_keys < 0) {
+                return ERROR;
+        }
+
+        n_slots = m->n_slots == 0 ? INITIAL_SLOTS : m->n_slots;
+        while (2 * n_keys > n_slots) {
+                n_slots *= 2;
+        }
+        if (n_slots == m->n_slots) {
+                return OK;
+        }
+
+        return map_grow(m, n_slots);
+}
+
+Status map_clear(Map* m) {
+        int i;
+
+        if (!m) {
+                return ERROR;
+        }
+
+        for (i = 0; i < m->n_slots; i++) {
+                m->keys[i] = NO_ID;
+        }
+        m->n_keys = 0;
+
+        return OK;
+}
+
+/**
+   Implementation of private functions
+*/
+
+int map_find_slot(const Map* m, Id key) {
+        int slot;
+
+        if (m->n_keys == 0) {
+                return -1;
+        }
+
+        slot = set_hash_id(key, m->n_slots);
+        while (m->keys[slot] != NO_ID) {
+                if (m->keys[slot] == key) {
+                        return slot;
+                }
+                slot = (slot + 1) & (m->n_slots - 1);
+        }
+
+        return -1;
+}
+
+Status map_grow(Map* m, int n_slots) {
+        Id* old_keys = m->keys;
+        long* old_values = m->values;
+        int old_slots = m->n_slots;
+        int i, slot;
+
+        m->keys = (Id*)malloc(n_slots * sizeof(Id));
+        m->values = (long*)malloc(n_slots * sizeof(long));
+        if (!m->keys || !m->values) {
+                free(m->keys);
+                free(m->values);
+                m->keys = old_keys;
+                m->values = old_values;
+                return ERROR;
+        }
+        for (i = 0; i < n_slots; i++) {
+                m->keys[i] = NO_ID;
+        }
+        m->n_slots = n_slots;
+
+        for (i = 0; i < old_slots; i++) {
+                if (old_keys[i] != NO_ID) {
+                        slot = set_hash_id(old_keys[i], m->n_slots);
+                        while (m->keys[slot] != NO_ID) {
+                                slot = (slot + 1) & (n_slots - 1);
+                        }
+                        m->keys[slot] = old_keys[i];
+                        m->values[slot] = old_values[i];
+                }
+        }
+
+        free(old_keys);
+        free(old_values);
+
+        return OK;
+}
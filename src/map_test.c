@@ -0,0 +1,209 @@
+/**
+ * @brief It tests the map module
+ *
+ * @file map_test.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 10-05-2025
+ * @copyright GNU Public License
+ */
+
+#include "map.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "map_test.h"
+#include "test.h"
+
+/**
+ * @def MAX_TESTS
+ * @brief Defines the maximum number of tests
+ */
+#define MAX_TESTS 15
+
+/**
+ * @def MANY_KEYS
+ * @brief Defines a number of keys big enough to make the map grow several times
+ */
+#define MANY_KEYS 1000
+
+/**
+ * @brief Main function for MAP unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv) {
+        int test = 0;
+        int all = 1;
+
+        if (argc < 2) {
+                printf("Running all test for module Map:\n");
+        } else {
+                test = atoi(argv[1]);
+                all = 0;
+                printf("Running test %d:\t", test);
+                if (test < 1 && test > MAX_TESTS) {
+                        printf("Error: unknown test %d\t", test);
+                        exit(EXIT_SUCCESS);
+                }
+        }
+
+        if (all || test == 1) test1_map_create();
+        if (all || test == 2) test1_map_set();
+        if (all || test == 3) test2_map_set();
+        if (all || test == 4) test3_map_set();
+        if (all || test == 5) test1_map_get();
+        if (all || test == 6) test2_map_get();
+        if (all || test == 7) test3_map_get();
+        if (all || test == 8) test1_map_del();
+        if (all || test == 9) test2_map_del();
+        if (all || test == 10) test3_map_del();
+        if (all || test == 11) test1_map_clear();
+        if (all || test == 12) test1_map_reserve();
+        if (all || test == 13) test2_map_reserve();
+        if (all || test == 14) test1_map_copy();
+        if (all || test == 15) test2_map_copy();
+
+        PRINT_PASSED_PERCENTAGE;
+
+        return EXIT_SUCCESS;
+}
+
+void test1_map_create() {
+        Map *m = NULL;
+        m = map_create();
+        PRINT_TEST_RESULT(m != NULL && map_get_n_keys(m) == 0);
+        map_destroy(m);
+}
+
+void test1_map_set() {
+        Map *m = NULL;
+        m = map_create();
+        PRINT_TEST_RESULT(map_set(m, 4, 1) == OK);
+        map_destroy(m);
+}
+
+void test2_map_set() {
+        Map *m = NULL;
+        m = map_create();
+        PRINT_TEST_RESULT(map_set(m, NO_ID, 1) == ERROR);
+        map_destroy(m);
+}
+
+void test3_map_set() {
+        Map *m = NULL;
+        m = map_create();
+        map_set(m, 4, 1);
+        map_set(m, 4, 2);
+        PRINT_TEST_RESULT(map_get_n_keys(m) == 1 && map_get(m, 4) == 2);
+        map_destroy(m);
+}
+
+void test1_map_get() {
+        Map *m = NULL;
+        m = map_create();
+        map_set(m, 12, 7);
+        PRINT_TEST_RESULT(map_get(m, 12) == 7);
+        map_destroy(m);
+}
+
+void test2_map_get() {
+        Map *m = NULL;
+        m = map_create();
+        PRINT_TEST_RESULT(map_get(m, 12) == NO_ID);
+        map_destroy(m);
+}
+
+void test3_map_get() {
+        Map *m = NULL;
+        PRINT_TEST_RESULT(map_get(m, 12) == NO_ID);
+}
+
+void test1_map_del() {
+        Map *m = NULL;
+        m = map_create();
+        map_set(m, 12, 7);
+        PRINT_TEST_RESULT(map_del(m, 12) == OK && map_has(m, 12) == FALSE);
+        map_destroy(m);
+}
+
+void test2_map_del() {
+        Map *m = NULL;
+        m = map_create();
+        PRINT_TEST_RESULT(map_del(m, 12) == ERROR);
+        map_destroy(m);
+}
+
+void test3_map_del() {
+        Map *m = NULL;
+        int i, result = 1;
+        m = map_create();
+        for (i = 0; i < MANY_KEYS; i++) {
+                map_set(m, i, 10 * i);
+        }
+        for (i = 0; i < MANY_KEYS; i += 2) {
+                map_del(m, i);
+        }
+        for (i = 0; i < MANY_KEYS; i++) {
+                if (map_get(m, i) != (i % 2 ? 10 * i : NO_ID)) result = 0;
+        }
+        PRINT_TEST_RESULT(result && map_get_n_keys(m) == MANY_KEYS / 2);
+        map_destroy(m);
+}
+
+void test1_map_clear() {
+        Map *m = NULL;
+        m = map_create();
+        map_set(m, 1, 1);
+        map_set(m, 2, 2);
+        map_clear(m);
+        PRINT_TEST_RESULT(map_get_n_keys(m) == 0 && map_has(m, 1) == FALSE);
+        map_destroy(m);
+}
+
+void test1_map_reserve() {
+        Map *m = NULL;
+        Status status;
+        m = map_create();
+        map_set(m, 1, 10);
+        map_set(m, 2, 20);
+        status = map_reserve(m, MANY_KEYS);
+        PRINT_TEST_RESULT(status == OK && map_get(m, 1) == 10 && map_get(m, 2) == 20 && map_get_n_keys(m) == 2);
+        map_destroy(m);
+}
+
+void test2_map_reserve() {
+        Map *m = NULL;
+        PRINT_TEST_RESULT(map_reserve(m, MANY_KEYS) == ERROR);
+}
+
+void test1_map_copy() {
+        Map *m = NULL, *copy = NULL;
+        int i, result = 1;
+        m = map_create();
+        copy = map_create();
+        for (i = 0; i < MANY_KEYS; i++) {
+                map_set(m, i + 1, 10 * i);
+        }
+        map_set(copy, MANY_KEYS + 1, 1);
+        if (map_copy(copy, m) == ERROR) result = 0;
+        for (i = 0; i < MANY_KEYS; i++) {
+                if (map_get(copy, i + 1) != 10 * i) result = 0;
+        }
+        PRINT_TEST_RESULT(result && map_get_n_keys(copy) == MANY_KEYS && map_has(copy, MANY_KEYS + 1) == FALSE);
+        map_destroy(m);
+        map_destroy(copy);
+}
+
+void test2_map_copy() {
+        Map *copy = NULL;
+        copy = map_create();
+        PRINT_TEST_RESULT(map_copy(copy, NULL) == ERROR);
+        map_destroy(copy);
+}
@@ -0,0 +1,387 @@
+/**
+ * @brief It implements the name index module
+ *
+ * @file name_index.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 12-05-2025
+ * @copyright GNU Public License
+ */
+
+#include "name_index.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @def INITIAL_SLOTS
+ * @brief Defines the number of slots reserved the first time a name is stored
+ */
+#define INITIAL_SLOTS 16
+
+/**
+ * @def FNV_OFFSET
+ * @brief Defines the initial value of the FNV-1a hash
+ */
+#define FNV_OFFSET 2166136261UL
+
+/**
+ * @def FNV_PRIME
+ * @brief Defines the multiplier of the FNV-1a hash
+ */
+#define FNV_PRIME 16777619UL
+
+/**
+ * @brief _Name_index private struct
+ *
+ * Open addressing with linear probing. The names are folded to lowercase once, when they are stored, so
+ * the lookups only have to fold the name being searched. A name may be stored once for each id that has it,
+ * all of them in the same cluster, and the one of the lowest sequence owns the name. A slot is free when its
+ * name is NULL, and the table doubles whenever it gets half full.
+ * */
+struct _Name_index {
+        char** names;     /**< Lowercase copy of the names, NULL marks a free slot*/
+        Id* ids;          /**< Id of each slot*/
+        long* sequences;  /**< Sequence of each slot, the lowest of a name owns it*/
+        int n_names;      /**< Number of names stored*/
+        int n_slots;      /**< Size of the table, always a power of two*/
+};
+
+/*
+Private functions
+*/
+
+/**
+ * @brief Computes the first slot of the table where a name should be looked for
+ * @author Abraham Martín
+ *
+ * @param ni Pointer to a name index with a table
+ * @param name Name to be hashed, in any case
+ * @return The position of the table
+ */
+int name_index_hash(const Name_index* ni, const char* name);
+
+/**
+ * @brief Compares a stored lowercase name with a name in any case
+ * @author Abraham Martín
+ *
+ * @param folded Name stored in the table
+ * @param name Name being looked for
+ * @return TRUE if both are the same name, FALSE otherwise
+ */
+Bool name_index_equal(const char* folded, const char* name);
+
+/**
+ * @brief Finds the slot that holds a name, for a given id or for the one that owns the name
+ * @author Abraham Martín
+ *
+ * @param ni Pointer to a name index
+ * @param name Name to be found
+ * @param id Id stored with the name, or NO_ID for the id of the lowest sequence
+ * @return The slot of the name, or -1 if it is not in the index
+ */
+int name_index_find_slot(const Name_index* ni, const char* name, Id id);
+
+/**
+ * @brief Moves every name to a bigger table
+ * @author Abraham Martín
+ *
+ * @param ni Pointer to a name index
+ * @param n_slots Size of the new table, a power of two bigger than the current one
+ * @return OK if the memory could be reserved, ERROR otherwise
+ */
+Status name_index_grow(Name_index* ni, int n_slots);
+
+Name_index* name_index_create(void) {
+        Name_index* ni = NULL;
+
+        ni = (Name_index*)malloc(sizeof(Name_index));
+        if (!ni) {
+                return NULL;
+        }
+        ni->names = NULL;
+        ni->ids = NULL;
+        ni->sequences = NULL;
+        ni->n_names = 0;
+        ni->n_slots = 0;
+
+        return ni;
+}
+
+Status name_index_destroy(Name_index* ni) {
+        int i;
+
+        if (ni) {
+                for (i = 0; i < ni->n_slots; i++) {
+                        free(ni->names[i]);
+                }
+                free(ni->names);
+                free(ni->ids);
+                free(ni->sequences);
+        }
+        free(ni);
+
+        return OK;
+}
+
+Status name_index_copy(Name_index* ni, const Name_index* source) {
+        char** names = NULL;
+        Id* ids = NULL;
+        long* sequences = NULL;
+        int i;
+
+        if (!ni || !source) {
+                return ERROR;
+        }
+
+        for (i = 0; i < ni->n_slots; i++) {
+                free(ni->names[i]);
+                ni->names[i] = NULL;
+        }
+        ni->n_names = 0;
+
+        /*The table takes the size of the source one, so every name stays in its slot and nothing is rehashed*/
+        if (ni->n_slots != source->n_slots) {
+                if (source->n_slots > 0) {
+                        names = (char**)malloc(source->n_slots * sizeof(char*));
+                        ids = (Id*)malloc(source->n_slots * sizeof(Id));
+                        sequences = (long*)malloc(source->n_slots * sizeof(long));
+                        if (!names || !ids || !sequences) {
+                                free(names);
+                                free(ids);
+                                free(sequences);
+                                return ERROR;
+                        }
+                }
+                free(ni->names);
+                free(ni->ids);
+                free(ni->sequences);
+                ni->names = names;
+                ni->ids = ids;
+                ni->sequences = sequences;
+                ni->n_slots = source->n_slots;
+                for (i = 0; i < ni->n_slots; i++) {
+                        ni->names[i] = NULL;
+                }
+        }
+
+        for (i = 0; i < source->n_slots; i++) {
+                if (source->names[i] != NULL) {
+                        ni->names[i] = (char*)malloc(strlen(source->names[i]) + 1);
+                        if (!ni->names[i]) {
+                                return ERROR;
+                        }
+                        strcpy(ni->names[i], source->names[i]);
+                        ni->n_names++;
+                }
+                ni->ids[i] = source->ids[i];
+                ni->sequences[i] = source->sequences[i];
+        }
+
+        return OK;
+}
+
+int name_index_get_n_names(const Name_index* ni) {
+        if (!ni) {
+                return -1;
+        }
+
+        return ni->n_names;
+}
+
+Status name_index_set(Name_index* ni, const char* name, Id id, long sequence) {
+        int slot, i;
+        char* folded = NULL;
+
+        if (!ni || !name || id == NO_ID) {
+                return ERROR;
+        }
+
+        slot = name_index_find_slot(ni, name, id);
+        if (slot != -1) {
+                ni->sequences[slot] = sequence;
+                return OK;
+        }
+
+        if (2 * (ni->n_names + 1) > ni->n_slots &&
+            name_index_grow(ni, ni->n_slots == 0 ? INITIAL_SLOTS : 2 * ni->n_slots) == ERROR) {
+                return ERROR;
+        }
+
+        folded = (char*)malloc(strlen(name) + 1);
+        if (!folded) {
+                return ERROR;
+        }
+        for (i = 0; name[i] != '\0'; i++) {
+                folded[i] = (char)tolower((unsigned char)name[i]);
+        }
+        folded[i] = '\0';
+
+        slot = name_index_hash(ni, folded);
+        while (ni->names[slot] != NULL) {
+                slot = (slot + 1) & (ni->n_slots - 1);
+        }
+        ni->names[slot] = folded;
+        ni->ids[slot] = id;
+        ni->sequences[slot] = sequence;
+        ni->n_names++;
+
+        return OK;
+}
+
+Id name_index_get(const Name_index* ni, const char* name) {
+        int slot;
+
+        if (!ni || !name) {
+                return NO_ID;
+        }
+
+        slot = name_index_find_slot(ni, name, NO_ID);
+        if (slot == -1) {
+                return NO_ID;
+        }
+
+        return ni->ids[slot];
+}
+
+Status name_index_del(Name_index* ni, const char* name, Id id) {
+        int slot, next, home;
+
+        if (!ni || !name || id == NO_ID) {
+                return ERROR;
+        }
+
+        slot = name_index_find_slot(ni, name, id);
+        if (slot == -1) {
+                return ERROR;
+        }
+
+        /*Backward shift deletion, the following names of the cluster are pulled back*/
+        free(ni->names[slot]);
+        ni->names[slot] = NULL;
+        ni->n_names--;
+        next = (slot + 1) & (ni->n_slots - 1);
+        while (ni->names[next] != NULL) {
+                home = name_index_hash(ni, ni->names[next]);
+                if (((next - home) & (ni->n_slots - 1)) >= ((next - slot) & (ni->n_slots - 1))) {
+                        ni->names[slot] = ni->names[next];
+                        ni->ids[slot] = ni->ids[next];
+                        ni->sequences[slot] = ni->sequences[next];
+                        ni->names[next] = NULL;
+                        slot = next;
+                }
+                next = (next + 1) & (ni->n_slots - 1);
+        }
+
+        return OK;
+}
+
+Status name_index_reserve(Name_index* ni, int n_names) {
+        int n_slots;
+
+        if (!ni || n_names < 0) {
+                return ERROR;
+        }
+
+        n_slots = ni->n_slots == 0 ? INITIAL_SLOTS : ni->n_slots;
+        while (2 * n_names > n_slots) {
+                n_slots *= 2;
+        }
+        if (n_slots == ni->n_slots) {
+                return OK;
+        }
+
+        return name_index_grow(ni, n_slots);
+}
+
+/**
+   Implementation of private functions
+*/
+
+int name_index_hash(const Name_index* ni, const char* name) {
+        unsigned long h = FNV_OFFSET;
+
+        /*FNV-1a over the lowercase bytes, so every spelling of a name lands on the same slot*/
+        for (; *name != '\0'; name++) {
+                h ^= (unsigned long)tolower((unsigned char)*name);
+                h = (h * FNV_PRIME) & 0xFFFFFFFFUL;
+        }
+
+        return (int)(h & (unsigned long)(ni->n_slots - 1));
+}
+
+Bool name_index_equal(const char* folded, const char* name) {
+        for (; *folded != '\0' && *folded == (char)tolower((unsigned char)*name); folded++, name++)
+                ;
+
+        return (*folded == '\0' && *name == '\0') ? TRUE : FALSE;
+}
+
+int name_index_find_slot(const Name_index* ni, const char* name, Id id) {
+        int slot, found = -1;
+
+        if (ni->n_names == 0) {
+                return -1;
+        }
+
+        /*Every id with the name is in the cluster of its slot, so the whole cluster is looked at for the owner*/
+        slot = name_index_hash(ni, name);
+        while (ni->names[slot] != NULL) {
+                if (name_index_equal(ni->names[slot], name) == TRUE) {
+                        if (id != NO_ID && ni->ids[slot] == id) {
+                                return slot;
+                        }
+                        if (id == NO_ID && (found == -1 || ni->sequences[slot] < ni->sequences[found])) {
+                                found = slot;
+                        }
+                }
+                slot = (slot + 1) & (ni->n_slots - 1);
+        }
+
+        return found;
+}
+
+Status name_index_grow(Name_index* ni, int n_slots) {
+        char** old_names = ni->names;
+        Id* old_ids = ni->ids;
+        long* old_sequences = ni->sequences;
+        int old_slots = ni->n_slots;
+        int i, slot;
+
+        ni->names = (char**)malloc(n_slots * sizeof(char*));
+        ni->ids = (Id*)malloc(n_slots * sizeof(Id));
+        ni->sequences = (long*)malloc(n_slots * sizeof(long));
+        if (!ni->names || !ni->ids || !ni->sequences) {
+                free(ni->names);
+                free(ni->ids);
+                free(ni->sequences);
+                ni->names = old_names;
+                ni->ids = old_ids;
+                ni->sequences = old_sequences;
+                return ERROR;
+        }
+        for (i = 0; i < n_slots; i++) {
+                ni->names[i] = NULL;
+        }
+        ni->n_slots = n_slots;
+
+        for (i = 0; i < old_slots; i++) {
+                if (old_names[i] != NULL) {
+                        slot = name_index_hash(ni, old_names[i]);
+                        while (ni->names[slot] != NULL) {
+                                slot = (slot + 1) & (n_slots - 1);
+                        }
+                        ni->names[slot] = old_names[i];
+                        ni->ids[slot] = old_ids[i];
+                        ni->sequences[slot] = old_sequences[i];
+                }
+        }
+
+        free(old_names);
+        free(old_ids);
+        free(old_sequences);
+
+        return OK;
+}
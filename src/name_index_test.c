@@ -0,0 +1,234 @@
+/**
+ * @brief It tests the name index module
+ *
+ * @file name_index_test.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 12-05-2025
+ * @copyright GNU Public License
+ */
+
+#include "name_index.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "name_index_test.h"
+#include "test.h"
+
+/**
+ * @def MAX_TESTS
+ * @brief Defines the maximum number of tests
+ */
+#define MAX_TESTS 17
+
+/**
+ * @def MANY_NAMES
+ * @brief Defines a number of names big enough to make the index grow several times
+ */
+#define MANY_NAMES 1000
+
+/**
+ * @brief Main function for NAME_INDEX unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv) {
+        int test = 0;
+        int all = 1;
+
+        if (argc < 2) {
+                printf("Running all test for module Name_index:\n");
+        } else {
+                test = atoi(argv[1]);
+                all = 0;
+                printf("Running test %d:\t", test);
+                if (test < 1 && test > MAX_TESTS) {
+                        printf("Error: unknown test %d\t", test);
+                        exit(EXIT_SUCCESS);
+                }
+        }
+
+        if (all || test == 1) test1_name_index_create();
+        if (all || test == 2) test1_name_index_set();
+        if (all || test == 3) test2_name_index_set();
+        if (all || test == 4) test3_name_index_set();
+        if (all || test == 5) test1_name_index_get();
+        if (all || test == 6) test2_name_index_get();
+        if (all || test == 7) test3_name_index_get();
+        if (all || test == 8) test1_name_index_del();
+        if (all || test == 9) test2_name_index_del();
+        if (all || test == 10) test3_name_index_del();
+        if (all || test == 11) test1_name_index_reserve();
+        if (all || test == 12) test2_name_index_reserve();
+        if (all || test == 13) test1_name_index_copy();
+        if (all || test == 14) test2_name_index_copy();
+        if (all || test == 15) test4_name_index_set();
+        if (all || test == 16) test5_name_index_set();
+        if (all || test == 17) test4_name_index_del();
+
+        PRINT_PASSED_PERCENTAGE;
+
+        return EXIT_SUCCESS;
+}
+
+void test1_name_index_create() {
+        Name_index *ni = NULL;
+        ni = name_index_create();
+        PRINT_TEST_RESULT(ni != NULL && name_index_get_n_names(ni) == 0);
+        name_index_destroy(ni);
+}
+
+void test1_name_index_set() {
+        Name_index *ni = NULL;
+        ni = name_index_create();
+        PRINT_TEST_RESULT(name_index_set(ni, "Beetle", 1, 0) == OK);
+        name_index_destroy(ni);
+}
+
+void test2_name_index_set() {
+        Name_index *ni = NULL;
+        ni = name_index_create();
+        PRINT_TEST_RESULT(name_index_set(ni, "Beetle", NO_ID, 0) == ERROR);
+        name_index_destroy(ni);
+}
+
+void test3_name_index_set() {
+        Name_index *ni = NULL;
+        ni = name_index_create();
+        name_index_set(ni, "Beetle", 1, 0);
+        name_index_set(ni, "BEETLE", 2, 1);
+        PRINT_TEST_RESULT(name_index_get_n_names(ni) == 2 && name_index_get(ni, "beetle") == 1);
+        name_index_destroy(ni);
+}
+
+void test1_name_index_get() {
+        Name_index *ni = NULL;
+        ni = name_index_create();
+        name_index_set(ni, "Lost_Ant", 7, 0);
+        PRINT_TEST_RESULT(name_index_get(ni, "lost_ANT") == 7);
+        name_index_destroy(ni);
+}
+
+void test2_name_index_get() {
+        Name_index *ni = NULL;
+        ni = name_index_create();
+        name_index_set(ni, "Beetle", 1, 0);
+        PRINT_TEST_RESULT(name_index_get(ni, "Beetles") == NO_ID);
+        name_index_destroy(ni);
+}
+
+void test3_name_index_get() {
+        Name_index *ni = NULL;
+        PRINT_TEST_RESULT(name_index_get(ni, "Beetle") == NO_ID);
+}
+
+void test1_name_index_del() {
+        Name_index *ni = NULL;
+        ni = name_index_create();
+        name_index_set(ni, "Beetle", 1, 0);
+        PRINT_TEST_RESULT(name_index_del(ni, "BeEtLe", 1) == OK && name_index_get(ni, "Beetle") == NO_ID);
+        name_index_destroy(ni);
+}
+
+void test2_name_index_del() {
+        Name_index *ni = NULL;
+        ni = name_index_create();
+        PRINT_TEST_RESULT(name_index_del(ni, "Beetle", 1) == ERROR);
+        name_index_destroy(ni);
+}
+
+void test3_name_index_del() {
+        Name_index *ni = NULL;
+        char name[16];
+        int i, result = 1;
+        ni = name_index_create();
+        for (i = 0; i < MANY_NAMES; i++) {
+                sprintf(name, "Ant_%d", i);
+                name_index_set(ni, name, i + 1, i);
+        }
+        for (i = 0; i < MANY_NAMES; i += 2) {
+                sprintf(name, "ANT_%d", i);
+                name_index_del(ni, name, i + 1);
+        }
+        for (i = 0; i < MANY_NAMES; i++) {
+                sprintf(name, "ant_%d", i);
+                if (name_index_get(ni, name) != (i % 2 ? i + 1 : NO_ID)) result = 0;
+        }
+        PRINT_TEST_RESULT(result && name_index_get_n_names(ni) == MANY_NAMES / 2);
+        name_index_destroy(ni);
+}
+
+void test1_name_index_reserve() {
+        Name_index *ni = NULL;
+        Status status;
+        ni = name_index_create();
+        name_index_set(ni, "Beetle", 1, 0);
+        status = name_index_reserve(ni, MANY_NAMES);
+        PRINT_TEST_RESULT(status == OK && name_index_get(ni, "beetle") == 1 && name_index_get_n_names(ni) == 1);
+        name_index_destroy(ni);
+}
+
+void test2_name_index_reserve() {
+        Name_index *ni = NULL;
+        PRINT_TEST_RESULT(name_index_reserve(ni, MANY_NAMES) == ERROR);
+}
+
+void test1_name_index_copy() {
+        Name_index *ni = NULL, *copy = NULL;
+        Status status;
+        ni = name_index_create();
+        copy = name_index_create();
+        name_index_set(ni, "Ant", 3, 0);
+        name_index_set(ni, "queen", 4, 0);
+        name_index_set(copy, "spider", 5, 0);
+        status = name_index_copy(copy, ni);
+        name_index_destroy(ni);
+        PRINT_TEST_RESULT(status == OK && name_index_get_n_names(copy) == 2 && name_index_get(copy, "ANT") == 3 &&
+                          name_index_get(copy, "Queen") == 4 && name_index_get(copy, "spider") == NO_ID);
+        name_index_destroy(copy);
+}
+
+void test2_name_index_copy() {
+        Name_index *copy = NULL;
+        copy = name_index_create();
+        PRINT_TEST_RESULT(name_index_copy(copy, NULL) == ERROR);
+        name_index_destroy(copy);
+}
+
+void test4_name_index_set() {
+        Name_index *ni = NULL;
+        ni = name_index_create();
+        name_index_set(ni, "Beetle", 1, 5);
+        name_index_set(ni, "beetle", 2, 3);
+        PRINT_TEST_RESULT(name_index_get(ni, "BEETLE") == 2);
+        name_index_destroy(ni);
+}
+
+void test5_name_index_set() {
+        Name_index *ni = NULL;
+        ni = name_index_create();
+        name_index_set(ni, "Beetle", 1, 0);
+        name_index_set(ni, "Beetle", 2, 1);
+        name_index_set(ni, "Beetle", 1, 2);
+        PRINT_TEST_RESULT(name_index_get_n_names(ni) == 2 && name_index_get(ni, "beetle") == 2);
+        name_index_destroy(ni);
+}
+
+void test4_name_index_del() {
+        Name_index *ni = NULL;
+        Status status;
+        ni = name_index_create();
+        name_index_set(ni, "Beetle", 1, 0);
+        name_index_set(ni, "Beetle", 2, 1);
+        name_index_set(ni, "Ant", 3, 2);
+        status = name_index_del(ni, "beetle", 1);
+        PRINT_TEST_RESULT(status == OK && name_index_get(ni, "Beetle") == 2 && name_index_get(ni, "ant") == 3 &&
+                          name_index_del(ni, "Beetle", 3) == ERROR);
+        name_index_destroy(ni);
+}
@@ -70,6 +70,23 @@ Status object_destroy(Object *object) {
         return OK;
 }
 
+Object *object_copy(const Object *object) {
+        Object *copy = NULL;
+
+        /*Error control*/
+        if (!object) {
+                return NULL;
+        }
+
+        copy = (Object *)malloc(sizeof(Object));
+        if (!copy) {
+                return NULL;
+        }
+        *copy = *object;
+
+        return copy;
+}
+
 Id object_get_id(const Object *object) {
         /*Error control*/
         if (!object) {
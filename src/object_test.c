@@ -21,7 +21,7 @@
  * @def MAX_TESTS
  * @brief Defines the number of tests
  */
-#define MAX_TESTS 10
+#define MAX_TESTS 32
 
 /**
  * @brief Main function for CHARACTER unit tests.
@@ -78,6 +78,8 @@ int main(int argc, char **argv) {
         if (all || test == 28) test2_object_set_dependency();
         if (all || test == 29) test1_object_get_dependency();
         if (all || test == 30) test2_object_get_dependency();
+        if (all || test == 31) test1_object_copy();
+        if (all || test == 32) test2_object_copy();
 
         PRINT_PASSED_PERCENTAGE;
 
@@ -217,3 +219,19 @@ void test1_object_get_dependency() {
 }
 
 void test2_object_get_dependency() { PRINT_TEST_RESULT(object_get_dependency(NULL) == NO_ID); }
+
+void test1_object_copy() {
+        Object *o = NULL, *copy = NULL;
+        o = object_create(5);
+        object_set_name(o, "leaf");
+        object_set_health(o, 3);
+        copy = object_copy(o);
+        PRINT_TEST_RESULT(copy != NULL && object_get_id(copy) == 5 && strcmp(object_get_name(copy), "leaf") == 0 &&
+                          object_get_health(copy) == 3);
+        object_destroy(o);
+        object_destroy(copy);
+}
+
+void test2_object_copy() {
+        PRINT_TEST_RESULT(object_copy(NULL) == NULL);
+}
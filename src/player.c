@@ -28,6 +28,7 @@ struct _Player {
         Inventory* backpack;             /**< Player's inventory for carrying objects*/
         char g_desc[P_GDESC_LENGTH + 1]; /**< Player's graphical description*/
         int damage;                      /**< Player's  damage when an attack succeeds*/
+        Set* followers;                  /**< Ids of the characters following the player*/
 };
 
 Player* player_create(Id id) {
@@ -45,6 +46,12 @@ Player* player_create(Id id) {
                 free(newPlayer);
                 return NULL;
         }
+        newPlayer->followers = set_create();
+        if (!newPlayer->followers) {
+                inventory_destroy(newPlayer->backpack);
+                free(newPlayer);
+                return NULL;
+        }
         /* Initialization of an empty player*/
         newPlayer->id = id;
         newPlayer->location = NO_ID;
@@ -55,12 +62,42 @@ Player* player_create(Id id) {
 }
 
 Status player_destroy(Player* player) {
-        if (player) inventory_destroy(player->backpack);
+        if (player) {
+                inventory_destroy(player->backpack);
+                set_destroy(player->followers);
+        }
         free(player);
 
         return OK;
 }
 
+Player* player_copy(const Player* player) {
+        Player* copy = NULL;
+        Inventory* backpack = NULL;
+        Set* followers = NULL;
+
+        if (!player) return NULL;
+
+        copy = player_create(player->id);
+        if (!copy) {
+                return NULL;
+        }
+
+        /*The plain fields are copied at once, the backpack and the followers keep their own sets*/
+        backpack = copy->backpack;
+        followers = copy->followers;
+        *copy = *player;
+        copy->backpack = backpack;
+        copy->followers = followers;
+        if (inventory_copy(copy->backpack, player->backpack) == ERROR ||
+            set_copy(copy->followers, player->followers) == ERROR) {
+                player_destroy(copy);
+                return NULL;
+        }
+
+        return copy;
+}
+
 Id player_get_id(const Player* player) {
         /*Error control*/
         if (!player) {
@@ -122,6 +159,14 @@ Id player_del_object(Player* player, Id id) {
         return inventory_del_object(player->backpack, id);
 }
 
+Status player_move_object(Player* player, Id id, int index) {
+        /*Error control*/
+        if (!player) {
+                return ERROR;
+        }
+        return inventory_move_object(player->backpack, id, index);
+}
+
 Id player_get_object_at_index(const Player* player, int index) {
         /*Error control*/
         if (!player || index == -1) {
@@ -131,6 +176,15 @@ Id player_get_object_at_index(const Player* player, int index) {
         return inventory_get_object_id_at_index(player->backpack, index);
 }
 
+const Set* player_get_objects(const Player* player) {
+        /*Error control*/
+        if (!player) {
+                return NULL;
+        }
+
+        return inventory_get_objects(player->backpack);
+}
+
 Status player_set_health(Player* player, int health) {
         /*Error control*/
         if (!player || health < 0) {
@@ -165,6 +219,11 @@ Status player_set_backpack_size(Player* player, int size) {
         return inventory_set_max_objs(player->backpack, size);
 }
 
+int player_get_backpack_size(const Player* player) {
+        if (!player) return -1;
+        return inventory_get_max_objs(player->backpack);
+}
+
 int player_get_num_objects(const Player* player) {
         if (!player) return 0;
         return inventory_get_num_objects(player->backpack);
@@ -196,6 +255,46 @@ int player_get_damage(const Player* player) {
         return player->damage;
 }
 
+Status player_add_follower(Player* player, Id id) {
+        if (!player || id == NO_ID) {
+                return ERROR;
+        }
+
+        return set_add(player->followers, id);
+}
+
+Id player_del_follower(Player* player, Id id) {
+        if (!player || id == NO_ID) {
+                return NO_ID;
+        }
+
+        return set_del(player->followers, id);
+}
+
+Status player_move_follower(Player* player, Id id, int index) {
+        if (!player || id == NO_ID) {
+                return ERROR;
+        }
+
+        return set_move(player->followers, id, index);
+}
+
+const Set* player_get_followers(const Player* player) {
+        if (!player) {
+                return NULL;
+        }
+
+        return player->followers;
+}
+
+int player_get_n_followers(const Player* player) {
+        if (!player) {
+                return -1;
+        }
+
+        return set_get_nIds(player->followers);
+}
+
 Status player_print(const Player* player) {
         if (!player) {
                 return ERROR;
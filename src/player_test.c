@@ -21,7 +21,7 @@
  * @def MAX_TESTS
  * @brief Defines the maximum number of tests
  */
-#define MAX_TESTS 30
+#define MAX_TESTS 53
 /**
  * @def MAX_IDS
  * @brief Defines the maximum number of ids
@@ -102,6 +102,16 @@ int main(int argc, char **argv) {
         if (all || test == 41) test2_player_set_damage();
         if (all || test == 42) test1_player_get_damage();
         if (all || test == 43) test2_player_get_damage();
+        if (all || test == 44) test1_player_add_follower();
+        if (all || test == 45) test2_player_add_follower();
+        if (all || test == 46) test1_player_del_follower();
+        if (all || test == 47) test1_player_get_n_followers();
+        if (all || test == 48) test1_player_get_backpack_size();
+        if (all || test == 49) test2_player_get_backpack_size();
+        if (all || test == 50) test1_player_copy();
+        if (all || test == 51) test2_player_copy();
+        if (all || test == 52) test1_player_move_object();
+        if (all || test == 53) test1_player_move_follower();
         PRINT_PASSED_PERCENTAGE;
 
         return EXIT_SUCCESS;
@@ -396,3 +406,90 @@ void test2_player_get_damage() {
         Player *p = NULL;
         PRINT_TEST_RESULT(player_get_damage(p) == -1);
 }
+
+void test1_player_add_follower() {
+        Player *p = NULL;
+        p = player_create(5);
+        PRINT_TEST_RESULT(player_add_follower(p, 21) == OK && set_has(player_get_followers(p), 21) == TRUE);
+        player_destroy(p);
+}
+
+void test2_player_add_follower() {
+        Player *p = NULL;
+        p = player_create(5);
+        PRINT_TEST_RESULT(player_add_follower(p, NO_ID) == ERROR);
+        player_destroy(p);
+}
+
+void test1_player_del_follower() {
+        Player *p = NULL;
+        p = player_create(5);
+        player_add_follower(p, 21);
+        PRINT_TEST_RESULT(player_del_follower(p, 21) == 21 && player_get_n_followers(p) == 0);
+        player_destroy(p);
+}
+
+void test1_player_get_n_followers() {
+        Player *p = NULL;
+        p = player_create(5);
+        player_add_follower(p, 21);
+        player_add_follower(p, 22);
+        player_add_follower(p, 21);
+        PRINT_TEST_RESULT(player_get_n_followers(p) == 2);
+        player_destroy(p);
+}
+
+void test1_player_get_backpack_size() {
+        Player *p = NULL;
+        p = player_create(5);
+        player_set_backpack_size(p, 4);
+        PRINT_TEST_RESULT(player_get_backpack_size(p) == 4);
+        player_destroy(p);
+}
+
+void test2_player_get_backpack_size() {
+        Player *p = NULL;
+        PRINT_TEST_RESULT(player_get_backpack_size(p) == -1);
+}
+
+void test1_player_copy() {
+        Player *p = NULL, *copy = NULL;
+        p = player_create(5);
+        player_set_health(p, 7);
+        player_set_backpack_size(p, 2);
+        player_add_object(p, 11);
+        player_add_follower(p, 21);
+        copy = player_copy(p);
+        player_del_object(copy, 11);
+        PRINT_TEST_RESULT(copy != NULL && player_get_health(copy) == 7 && player_get_backpack_size(copy) == 2 &&
+                          player_get_n_followers(copy) == 1 && player_has_object(copy, 11) == FALSE &&
+                          player_has_object(p, 11) == TRUE);
+        player_destroy(p);
+        player_destroy(copy);
+}
+
+void test2_player_copy() {
+        PRINT_TEST_RESULT(player_copy(NULL) == NULL);
+}
+
+void test1_player_move_object() {
+        Player *p = NULL;
+        p = player_create(5);
+        player_set_backpack_size(p, 2);
+        player_add_object(p, 11);
+        player_add_object(p, 12);
+        PRINT_TEST_RESULT(player_move_object(p, 12, 0) == OK && player_get_object_at_index(p, 0) == 12 &&
+                          player_get_object_at_index(p, 1) == 11);
+        player_destroy(p);
+}
+
+void test1_player_move_follower() {
+        Player *p = NULL;
+        p = player_create(5);
+        player_add_follower(p, 21);
+        player_add_follower(p, 22);
+        PRINT_TEST_RESULT(player_move_follower(p, 21, 1) == OK &&
+                          set_get_id_at_index(player_get_followers(p), 0) == 22 &&
+                          set_get_id_at_index(player_get_followers(p), 1) == 21);
+        player_destroy(p);
+}
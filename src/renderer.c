@@ -0,0 +1,184 @@
+/**
+ * @brief It implements the renderer interface and its text and null backends
+ *
+ * @file renderer.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 21-05-2025
+ * @copyright GNU Public License
+ */
+
+#include "renderer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "graphic_engine.h"
+
+/**
+ * @brief _Renderer private struct
+ * */
+struct _Renderer {
+        const Renderer_backend *backend; /**< Functions of the backend*/
+        void *engine;                    /**< Engine created by the backend*/
+};
+
+/*
+Private functions
+*/
+
+/**
+ * @brief Creates the engine of the text backend
+ * @author Abraham Martín
+ *
+ * @param out Ignored, the engine paints in the terminal
+ * @return Pointer to a new Graphic_engine
+ */
+void *renderer_text_create(FILE *out);
+
+/**
+ * @brief Frees the engine of the text backend
+ * @author Abraham Martín
+ *
+ * @param engine Pointer to a Graphic_engine
+ */
+void renderer_text_destroy(void *engine);
+
+/**
+ * @brief Paints a game with the engine of the text backend
+ * @author Abraham Martín
+ *
+ * @param engine Pointer to a Graphic_engine
+ * @param game Pointer to the game
+ */
+void renderer_text_paint(void *engine, Game *game);
+
+/**
+ * @brief Creates the engine of the null backend
+ * @author Abraham Martín
+ *
+ * @param out Ignored
+ * @return A pointer that is not NULL, the backend keeps no state
+ */
+void *renderer_null_create(FILE *out);
+
+/**
+ * @brief Does nothing
+ * @author Abraham Martín
+ *
+ * @param engine Ignored
+ */
+void renderer_null_destroy(void *engine);
+
+/**
+ * @brief Does nothing
+ * @author Abraham Martín
+ *
+ * @param engine Ignored
+ * @param game Ignored
+ */
+void renderer_null_paint(void *engine, Game *game);
+
+const Renderer_backend renderer_text_backend = {"text", renderer_text_create, renderer_text_destroy,
+                                                renderer_text_paint};
+
+const Renderer_backend renderer_null_backend = {"null", renderer_null_create, renderer_null_destroy,
+                                                renderer_null_paint};
+
+/**
+ * @brief Backends that can be chosen by name
+ */
+static const Renderer_backend *backends[] = {&renderer_text_backend, &renderer_null_backend, &renderer_json_backend,
+                                             NULL};
+
+Renderer *renderer_create(const char *name, FILE *out) {
+        int i;
+
+        if (!name) {
+                return NULL;
+        }
+
+        for (i = 0; backends[i]; i++) {
+                if (strcmp(backends[i]->name, name) == 0) {
+                        return renderer_create_from_backend(backends[i], out);
+                }
+        }
+
+        return NULL;
+}
+
+Renderer *renderer_create_from_backend(const Renderer_backend *backend, FILE *out) {
+        Renderer *renderer = NULL;
+
+        if (!backend || !backend->create || !backend->destroy || !backend->paint) {
+                return NULL;
+        }
+
+        renderer = (Renderer *)malloc(sizeof(Renderer));
+        if (!renderer) {
+                return NULL;
+        }
+        renderer->backend = backend;
+        renderer->engine = backend->create(out);
+        if (!renderer->engine) {
+                free(renderer);
+                return NULL;
+        }
+
+        return renderer;
+}
+
+void renderer_destroy(Renderer *renderer) {
+        if (!renderer) {
+                return;
+        }
+
+        renderer->backend->destroy(renderer->engine);
+        free(renderer);
+}
+
+void renderer_paint(Renderer *renderer, Game *game) {
+        if (!renderer || !game) {
+                return;
+        }
+
+        renderer->backend->paint(renderer->engine, game);
+}
+
+const char *renderer_get_name(const Renderer *renderer) {
+        if (!renderer) {
+                return NULL;
+        }
+
+        return renderer->backend->name;
+}
+
+/**
+   Implementation of private functions
+*/
+
+void *renderer_text_create(FILE *out) {
+        (void)out;
+
+        return graphic_engine_create();
+}
+
+void renderer_text_destroy(void *engine) { graphic_engine_destroy((Graphic_engine *)engine); }
+
+void renderer_text_paint(void *engine, Game *game) { graphic_engine_paint_game((Graphic_engine *)engine, game); }
+
+void *renderer_null_create(FILE *out) {
+        static char engine;
+        (void)out;
+
+        /*Any pointer but NULL will do, the backend keeps no state*/
+        return &engine;
+}
+
+void renderer_null_destroy(void *engine) { (void)engine; }
+
+void renderer_null_paint(void *engine, Game *game) {
+        (void)engine;
+        (void)game;
+}
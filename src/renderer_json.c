@@ -0,0 +1,216 @@
+/**
+ * @brief It implements the JSON backend of the renderer interface
+ *
+ * @file renderer_json.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 21-05-2025
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "command.h"
+#include "renderer.h"
+
+/**
+ * @brief Json_engine
+ *
+ * The state of the JSON backend: the stream every frame is written to.
+ * */
+typedef struct _Json_engine {
+        FILE *out; /**< Stream where the frames are written*/
+} Json_engine;
+
+/*
+Private functions
+*/
+
+/**
+ * @brief Creates the engine of the JSON backend
+ * @author Abraham Martín
+ *
+ * @param out Stream where the frames are written, stdout if it is NULL
+ * @return Pointer to a new Json_engine, NULL if there was any error
+ */
+void *renderer_json_create(FILE *out);
+
+/**
+ * @brief Frees the engine of the JSON backend, the stream is not closed
+ * @author Abraham Martín
+ *
+ * @param engine Pointer to a Json_engine
+ */
+void renderer_json_destroy(void *engine);
+
+/**
+ * @brief Writes the state of a game as one line with a JSON object
+ * @author Abraham Martín
+ *
+ * The object holds the turn, the last command, the players, the discovered spaces with their objects and the
+ * links leaving them, and the characters in them.
+ *
+ * @param engine Pointer to a Json_engine
+ * @param game Pointer to the game
+ */
+void renderer_json_paint(void *engine, Game *game);
+
+/**
+ * @brief Writes a JSON string, escaping the characters that need it
+ * @author Abraham Martín
+ *
+ * @param out Stream
+ * @param str String, NULL is written as an empty string
+ */
+void renderer_json_string(FILE *out, const char *str);
+
+/**
+ * @brief Writes the ids of a set as a JSON array
+ * @author Abraham Martín
+ *
+ * @param out Stream
+ * @param set Pointer to the set
+ */
+void renderer_json_ids(FILE *out, const Set *set);
+
+const Renderer_backend renderer_json_backend = {"json", renderer_json_create, renderer_json_destroy,
+                                                renderer_json_paint};
+
+/**
+   Implementation of private functions
+*/
+
+void *renderer_json_create(FILE *out) {
+        Json_engine *engine = NULL;
+
+        engine = (Json_engine *)malloc(sizeof(Json_engine));
+        if (!engine) {
+                return NULL;
+        }
+        engine->out = out ? out : stdout;
+
+        return engine;
+}
+
+void renderer_json_destroy(void *engine) { free(engine); }
+
+void renderer_json_paint(void *engine, Game *game) {
+        extern char *cmd_to_str[N_CMD][N_CMDT];
+        FILE *out = ((Json_engine *)engine)->out;
+        Command *command = NULL;
+        Player *player = NULL;
+        Space *space = NULL;
+        Character *character = NULL;
+        Link *link = NULL;
+        Id location = NO_ID;
+        int i, n = 0;
+
+        command = game_get_last_command((const Game *)game);
+        fprintf(out, "{\"turn\":%d,\"finished\":%s,\"command\":{\"name\":", game_get_current_turn((const Game *)game),
+                game_get_finished((const Game *)game) == TRUE ? "true" : "false");
+        renderer_json_string(out, cmd_to_str[command_get_code(command) - NO_CMD][CMDL]);
+        fprintf(out, ",\"arg\":");
+        renderer_json_string(out, command_get_arg(command));
+        fprintf(out, ",\"success\":%s}", command_get_success(command) == OK ? "true" : "false");
+
+        player = game_get_current_player((const Game *)game);
+        fprintf(out, ",\"current_player\":%ld,\"players\":[", player ? player_get_id(player) : NO_ID);
+        for (i = 0; i < game_get_n_players(game); i++) {
+                player = game_get_player_from_index((const Game *)game, i);
+                fprintf(out, "%s{\"id\":%ld,\"name\":", i ? "," : "", player_get_id(player));
+                renderer_json_string(out, player_get_name(player));
+                fprintf(out, ",\"gdesc\":");
+                renderer_json_string(out, player_get_gdesc(player));
+                fprintf(out, ",\"location\":%ld,\"health\":%d,\"objects\":", player_get_location(player),
+                        player_get_health(player));
+                renderer_json_ids(out, player_get_objects(player));
+                fprintf(out, "}");
+        }
+
+        /*Only what the players have discovered is shown*/
+        fprintf(out, "],\"spaces\":[");
+        for (i = 0, n = 0; i < game_get_n_spaces(game); i++) {
+                space = game_get_space_from_index(game, i);
+                if (space_get_discovered(space) == FALSE) {
+                        continue;
+                }
+                fprintf(out, "%s{\"id\":%ld,\"name\":", n++ ? "," : "", space_get_id(space));
+                renderer_json_string(out, space_get_name(space));
+                fprintf(out, ",\"objects\":");
+                renderer_json_ids(out, space_get_objects(space));
+                fprintf(out, "}");
+        }
+
+        fprintf(out, "],\"links\":[");
+        for (i = 0, n = 0; i < game_get_n_links(game); i++) {
+                link = game_get_link_from_index(game, i);
+                space = game_get_space((const Game *)game, link_get_origin(link));
+                if (!space || space_get_discovered(space) == FALSE) {
+                        continue;
+                }
+                fprintf(out, "%s{\"id\":%ld,\"origin\":%ld,\"destination\":%ld,\"direction\":%d,\"open\":%s}",
+                        n++ ? "," : "", link_get_id(link), link_get_origin(link), link_get_destination(link),
+                        (int)link_get_direction(link), link_get_open(link) == TRUE ? "true" : "false");
+        }
+
+        fprintf(out, "],\"characters\":[");
+        for (i = 0, n = 0; i < game_get_n_characters((const Game *)game); i++) {
+                character = game_get_character_from_index((const Game *)game, i);
+                location = game_get_character_location((const Game *)game, character_get_id(character));
+                space = game_get_space((const Game *)game, location);
+                if (!space || space_get_discovered(space) == FALSE) {
+                        continue;
+                }
+                fprintf(out, "%s{\"id\":%ld,\"name\":", n++ ? "," : "", character_get_id(character));
+                renderer_json_string(out, character_get_name(character));
+                fprintf(out, ",\"gdesc\":");
+                renderer_json_string(out, character_get_gdesc(character));
+                fprintf(out, ",\"location\":%ld,\"health\":%d,\"friendly\":%s}", location,
+                        character_get_health(character), character_get_friendly(character) == TRUE ? "true" : "false");
+        }
+        fprintf(out, "]}\n");
+
+        /*Each frame reaches the interface as soon as it is written*/
+        fflush(out);
+}
+
+void renderer_json_string(FILE *out, const char *str) {
+        fputc('"', out);
+        for (; str && *str; str++) {
+                switch (*str) {
+                        case '"':
+                                fputs("\\\"", out);
+                                break;
+                        case '\\':
+                                fputs("\\\\", out);
+                                break;
+                        case '\n':
+                                fputs("\\n", out);
+                                break;
+                        case '\t':
+                                fputs("\\t", out);
+                                break;
+                        default:
+                                if ((unsigned char)*str < ' ') {
+                                        fprintf(out, "\\u%04x", (unsigned)(unsigned char)*str);
+                                } else {
+                                        fputc(*str, out);
+                                }
+                }
+        }
+        fputc('"', out);
+}
+
+void renderer_json_ids(FILE *out, const Set *set) {
+        Set_iterator it;
+        Id id = NO_ID;
+        int n = 0;
+
+        fputc('[', out);
+        set_iterator_init(&it, set);
+        while (set_iterator_next(&it, &id)) {
+                fprintf(out, "%s%ld", n++ ? "," : "", id);
+        }
+        fputc(']', out);
+}
@@ -0,0 +1,140 @@
+/**
+ * @brief It implements the random number generator module
+ *
+ * @file rng.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 26-05-2025
+ * @copyright GNU Public License
+ */
+
+#include "rng.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @def MASK_32
+ * @brief Defines the bits of a word of the state, unsigned long may be wider than 32 bits
+ */
+#define MASK_32 0xFFFFFFFFUL
+
+/**
+ * @def GOLDEN_GAMMA
+ * @brief Defines the step of the sequence the seed is spread from (2^32 divided by the golden ratio)
+ */
+#define GOLDEN_GAMMA 0x9E3779B9UL
+
+/*
+Private functions
+*/
+
+/**
+ * @brief Rotates the bits of a 32 bit word to the left
+ * @author Abraham Martín
+ *
+ * @param x Word
+ * @param k Number of bits, from 1 to 31
+ * @return The rotated word
+ */
+unsigned long rng_rotl(unsigned long x, int k);
+
+/**
+ * @brief Takes the next value of a sequence and mixes its bits, to spread a seed over the words of the state
+ * @author Abraham Martín
+ *
+ * @param x Pointer to the value of the sequence, it is advanced
+ * @return A well mixed 32 bit word
+ */
+unsigned long rng_mix(unsigned long *x);
+
+Status rng_seed(Rng *rng, unsigned long seed) {
+        unsigned long x = seed & MASK_32;
+        int i;
+
+        if (!rng) {
+                return ERROR;
+        }
+
+        /*The mixed words of a sequence are never all 0*/
+        for (i = 0; i < RNG_STATE_SIZE; i++) {
+                rng->state[i] = rng_mix(&x);
+        }
+
+        return OK;
+}
+
+unsigned long rng_next(Rng *rng) {
+        unsigned long *s = NULL, result, t;
+
+        if (!rng) {
+                return 0;
+        }
+
+        s = rng->state;
+        result = (rng_rotl((s[1] * 5) & MASK_32, 7) * 9) & MASK_32;
+        t = (s[1] << 9) & MASK_32;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rng_rotl(s[3], 11);
+
+        return result;
+}
+
+int rng_next_int(Rng *rng, int n) {
+        unsigned long limit, x;
+
+        if (!rng || n <= 0) {
+                return 0;
+        }
+
+        /*The numbers over the last whole multiple of n are drawn again, so no value is more likely than the rest*/
+        limit = MASK_32 - (MASK_32 % (unsigned long)n + 1) % (unsigned long)n;
+        do {
+                x = rng_next(rng);
+        } while (x > limit);
+
+        return (int)(x % (unsigned long)n);
+}
+
+Status rng_set_state(Rng *rng, const unsigned long state[RNG_STATE_SIZE]) {
+        Bool zero = TRUE;
+        int i;
+
+        if (!rng || !state) {
+                return ERROR;
+        }
+        for (i = 0; i < RNG_STATE_SIZE; i++) {
+                if (state[i] > MASK_32) return ERROR;
+                if (state[i] != 0) zero = FALSE;
+        }
+        if (zero) {
+                return ERROR;
+        }
+
+        for (i = 0; i < RNG_STATE_SIZE; i++) {
+                rng->state[i] = state[i];
+        }
+
+        return OK;
+}
+
+/**
+   Implementation of private functions
+*/
+
+unsigned long rng_rotl(unsigned long x, int k) { return ((x << k) | (x >> (32 - k))) & MASK_32; }
+
+unsigned long rng_mix(unsigned long *x) {
+        unsigned long z;
+
+        *x = (*x + GOLDEN_GAMMA) & MASK_32;
+        z = *x;
+        z = ((z ^ (z >> 16)) * 0x85EBCA6BUL) & MASK_32;
+        z = ((z ^ (z >> 13)) * 0xC2B2AE35UL) & MASK_32;
+
+        return z ^ (z >> 16);
+}
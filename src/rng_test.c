@@ -0,0 +1,144 @@
+/**
+ * @brief It tests the random number generator module
+ *
+ * @file rng_test.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 26-05-2025
+ * @copyright GNU Public License
+ */
+
+#include "rng.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rng_test.h"
+#include "test.h"
+
+/**
+ * @def MAX_TESTS
+ * @brief Defines the maximum number of tests
+ */
+#define MAX_TESTS 9
+
+/**
+ * @def N_DRAWS
+ * @brief Defines the number of numbers drawn by the tests
+ */
+#define N_DRAWS 1000
+
+/**
+ * @brief Main function for RNG unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv) {
+        int test = 0;
+        int all = 1;
+
+        if (argc < 2) {
+                printf("Running all test for module Rng:\n");
+        } else {
+                test = atoi(argv[1]);
+                all = 0;
+                printf("Running test %d:\t", test);
+                if (test < 1 && test > MAX_TESTS) {
+                        printf("Error: unknown test %d\t", test);
+                        exit(EXIT_SUCCESS);
+                }
+        }
+
+        if (all || test == 1) test1_rng_seed();
+        if (all || test == 2) test2_rng_seed();
+        if (all || test == 3) test3_rng_seed();
+        if (all || test == 4) test1_rng_next();
+        if (all || test == 5) test2_rng_next();
+        if (all || test == 6) test1_rng_next_int();
+        if (all || test == 7) test2_rng_next_int();
+        if (all || test == 8) test1_rng_set_state();
+        if (all || test == 9) test2_rng_set_state();
+
+        PRINT_PASSED_PERCENTAGE;
+
+        return EXIT_SUCCESS;
+}
+
+void test1_rng_seed() {
+        Rng a, b;
+        int i, result = 1;
+        rng_seed(&a, 42);
+        rng_seed(&b, 42);
+        for (i = 0; i < N_DRAWS; i++) {
+                if (rng_next(&a) != rng_next(&b)) result = 0;
+        }
+        PRINT_TEST_RESULT(result);
+}
+
+void test2_rng_seed() {
+        Rng a, b;
+        rng_seed(&a, 1);
+        rng_seed(&b, 2);
+        PRINT_TEST_RESULT(rng_next(&a) != rng_next(&b));
+}
+
+void test3_rng_seed() { PRINT_TEST_RESULT(rng_seed(NULL, 1) == ERROR); }
+
+void test1_rng_next() {
+        Rng rng;
+        unsigned long state[RNG_STATE_SIZE] = {1, 2, 3, 4};
+        rng_set_state(&rng, state);
+        PRINT_TEST_RESULT(rng_next(&rng) == 11520);
+}
+
+void test2_rng_next() { PRINT_TEST_RESULT(rng_next(NULL) == 0); }
+
+void test1_rng_next_int() {
+        Rng rng;
+        int seen[6] = {0, 0, 0, 0, 0, 0};
+        int i, number, result = 1;
+        rng_seed(&rng, 7);
+        for (i = 0; i < N_DRAWS; i++) {
+                number = rng_next_int(&rng, 6);
+                if (number < 0 || number > 5) {
+                        result = 0;
+                } else {
+                        seen[number] = 1;
+                }
+        }
+        for (i = 0; i < 6; i++) {
+                if (!seen[i]) result = 0;
+        }
+        PRINT_TEST_RESULT(result);
+}
+
+void test2_rng_next_int() {
+        Rng rng;
+        rng_seed(&rng, 7);
+        PRINT_TEST_RESULT(rng_next_int(&rng, 0) == 0);
+}
+
+void test1_rng_set_state() {
+        Rng a, b;
+        int i, result = 1;
+        rng_seed(&a, 3);
+        for (i = 0; i < 10; i++) {
+                rng_next(&a);
+        }
+        result = rng_set_state(&b, a.state) == OK;
+        for (i = 0; i < N_DRAWS; i++) {
+                if (rng_next(&a) != rng_next(&b)) result = 0;
+        }
+        PRINT_TEST_RESULT(result);
+}
+
+void test2_rng_set_state() {
+        Rng rng;
+        unsigned long state[RNG_STATE_SIZE] = {0, 0, 0, 0};
+        PRINT_TEST_RESULT(rng_set_state(&rng, state) == ERROR);
+}
@@ -3,7 +3,7 @@
  *
  * @file set.c
  * @author Abraham Martín
- * @version 1.0
+ * @version 2.0
  * @date 21-02-2025
  * @copyright GNU Public License
  */
@@ -11,42 +11,133 @@
 #include "set.h"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 /**
- * @def MAX_IDS
- * @brief Defines the maximum number of ids
+ * @def INITIAL_CAPACITY
+ * @brief Defines the number of ids reserved the first time an id is added
  */
-#define MAX_IDS 50
+#define INITIAL_CAPACITY 4
+
+/**
+ * @def EMPTY_SLOT
+ * @brief Defines the value of a free position of the hash table
+ */
+#define EMPTY_SLOT 0
+
+/**
+ * @def HASH_MULTIPLIER
+ * @brief Defines the constant used to scatter the ids along the table (Fibonacci hashing), it fits in 32 bits as a long
+ * may be no longer
+ */
+#define HASH_MULTIPLIER 0x9E3779B1UL
+
+/**
+ * @def HASH_MASK
+ * @brief Defines the mask that keeps the hash in 32 bits whatever the size of long
+ */
+#define HASH_MASK 0xFFFFFFFFUL
 
 /**
  * @brief _Set private struct
+ *
+ * The ids are kept packed in insertion order so they can be walked in O(n), while the
+ * open addressing table (linear probing) finds the position of any id in O(1).
  * */
 struct _Set {
-        Id ids[MAX_IDS]; /**< Id array*/
-        int n_ids;       /**< Number of ids in the array*/
+        Id* ids;      /**< Packed id array*/
+        int n_ids;    /**< Number of ids in the array*/
+        int capacity; /**< Number of ids the array can hold before growing*/
+        int* slots;   /**< Hash table, each slot stores the position in ids plus one, or EMPTY_SLOT*/
+        int n_slots;  /**< Number of slots of the table, always a power of two and twice the capacity*/
 };
 
+/*
+Private functions
+*/
+
+/**
+ * @brief Finds the slot of the table that points to the given id
+ * @author Abraham Martín
+ *
+ * @param s Pointer to a set
+ * @param id Id to be found
+ * @return The slot of the id, or -1 if the id does not belong to the set
+ */
+int set_find_slot(const Set* s, Id id);
+
+/**
+ * @brief Doubles the capacity of the set, rebuilding its hash table
+ * @author Abraham Martín
+ *
+ * @param s Pointer to a set
+ * @return OK if the memory could be reserved, ERROR otherwise
+ */
+Status set_grow(Set* s);
+
 Set* set_create(void) {
         Set* s = NULL;
-        int i = 0;
         s = (Set*)malloc(sizeof(Set));
         /*Error control*/
         if (!s) {
                 return NULL;
         }
-        for (i = 0; i < MAX_IDS; i++) {
-                s->ids[i] = NO_ID;
-        }
+        /*The arrays are reserved on the first insertion, so empty sets (most of them) are cheap*/
+        s->ids = NULL;
         s->n_ids = 0;
+        s->capacity = 0;
+        s->slots = NULL;
+        s->n_slots = 0;
         return s;
 }
 
 Status set_destroy(Set* s) {
+        if (s) {
+                free(s->ids);
+                free(s->slots);
+        }
         free(s);
 
         return OK;
 }
 
+Status set_copy(Set* s, const Set* source) {
+        Id* ids = NULL;
+        int* slots = NULL;
+
+        /*Error control*/
+        if (!s || !source) {
+                return ERROR;
+        }
+
+        /*The table takes the size of the source one, so its slots are still right and nothing is rehashed*/
+        if (s->capacity != source->capacity) {
+                if (source->capacity > 0) {
+                        ids = (Id*)malloc(source->capacity * sizeof(Id));
+                        slots = (int*)malloc(source->n_slots * sizeof(int));
+                        if (!ids || !slots) {
+                                free(ids);
+                                free(slots);
+                                return ERROR;
+                        }
+                }
+                free(s->ids);
+                free(s->slots);
+                s->ids = ids;
+                s->slots = slots;
+                s->capacity = source->capacity;
+                s->n_slots = source->n_slots;
+        }
+        if (source->capacity > 0) {
+                memcpy(s->ids, source->ids, source->n_ids * sizeof(Id));
+                memcpy(s->slots, source->slots, source->n_slots * sizeof(int));
+        }
+        s->n_ids = source->n_ids;
+
+        return OK;
+}
+
 int set_get_nIds(const Set* s) {
         /*Error control*/
         if (!s) {
@@ -57,26 +148,33 @@ int set_get_nIds(const Set* s) {
 }
 
 Status set_add(Set* s, Id id) {
-        int i = 0;
+        int slot;
 
         /*Error control*/
-        if (!s || s->n_ids == MAX_IDS || id == NO_ID) {
+        if (!s || id == NO_ID) {
                 return ERROR;
         }
 #ifdef DEBUG
         printf("Set before adding %d.\n", (int)id);
         set_print(s);
 #endif
-        for (i = 0; i < s->n_ids; i++) {
-                if (id == s->ids[i]) {
+        if (set_find_slot(s, id) != -1) {
 #ifdef DEBUG
-                        printf("The element belongs to the set already.\n");
+                printf("The element belongs to the set already.\n");
 #endif
-                        return OK;
-                }
+                return OK;
+        }
+        if (s->n_ids == s->capacity && set_grow(s) == ERROR) {
+                return ERROR;
+        }
+
+        slot = set_hash_id(id, s->n_slots);
+        while (s->slots[slot] != EMPTY_SLOT) {
+                slot = (slot + 1) & (s->n_slots - 1);
         }
         s->ids[s->n_ids] = id;
         s->n_ids++;
+        s->slots[slot] = s->n_ids;
 #ifdef DEBUG
         printf("Set after adding %d.\n", (int)id);
         set_print(s);
@@ -85,7 +183,7 @@ Status set_add(Set* s, Id id) {
 }
 
 Id set_del(Set* s, Id id) {
-        int i = 0;
+        int slot, next, home, pos, last_slot;
         /*Error control*/
         if (!s || id == NO_ID) {
                 return NO_ID;
@@ -95,43 +193,91 @@ Id set_del(Set* s, Id id) {
         set_print(s);
 #endif
 
-        for (i = 0; i < s->n_ids; i++) {
-                if (s->ids[i] == id) {
-                        s->ids[i] = s->ids[s->n_ids - 1];
-                        s->ids[s->n_ids - 1] = NO_ID;
-                        s->n_ids--;
+        slot = set_find_slot(s, id);
+        if (slot == -1) {
 #ifdef DEBUG
-                        printf("Set after deleting %d.\n", (int)id);
-                        set_print(s);
+                printf("The element %d doesn't belong to the set.\n", (int)id);
 #endif
-                        return id;
+                return NO_ID;
+        }
+
+        /*The last id takes the place of the deleted one, so its slot has to point to its new position*/
+        pos = s->slots[slot] - 1;
+        if (pos != s->n_ids - 1) {
+                last_slot = set_find_slot(s, s->ids[s->n_ids - 1]);
+                s->ids[pos] = s->ids[s->n_ids - 1];
+                s->slots[last_slot] = pos + 1;
+        }
+        s->ids[s->n_ids - 1] = NO_ID;
+        s->n_ids--;
+
+        /*Backward shift deletion: pull back the following entries of the cluster, no tombstones are needed*/
+        s->slots[slot] = EMPTY_SLOT;
+        next = (slot + 1) & (s->n_slots - 1);
+        while (s->slots[next] != EMPTY_SLOT) {
+                home = set_hash_id(s->ids[s->slots[next] - 1], s->n_slots);
+                if (((next - home) & (s->n_slots - 1)) >= ((next - slot) & (s->n_slots - 1))) {
+                        s->slots[slot] = s->slots[next];
+                        s->slots[next] = EMPTY_SLOT;
+                        slot = next;
                 }
+                next = (next + 1) & (s->n_slots - 1);
         }
 #ifdef DEBUG
-        printf("The element %d doesn't belong to the set.\n", (int)id);
+        printf("Set after deleting %d.\n", (int)id);
+        set_print(s);
 #endif
 
-        return NO_ID;
+        return id;
 }
 
 Bool set_has(const Set* s, Id id) {
-        int i;
         if (!s || id == NO_ID) {
                 return FALSE;
         }
-        for (i = 0; i < s->n_ids; i++) {
-                if (s->ids[i] == id) {
-                        return TRUE;
-                }
-        }
-        return FALSE;
+        return set_find_slot(s, id) != -1 ? TRUE : FALSE;
 }
 
 Id set_get_id_at_index(const Set* set, int index) {
-        if (!set || index < 0 || index > set->n_ids) return NO_ID;
+        if (!set || index < 0 || index >= set->n_ids) return NO_ID;
         return set->ids[index];
 }
 
+int set_get_index(const Set* s, Id id) {
+        int slot;
+
+        if (!s || id == NO_ID || (slot = set_find_slot(s, id)) == -1) {
+                return -1;
+        }
+        return s->slots[slot] - 1;
+}
+
+Status set_move(Set* s, Id id, int index) {
+        int slot, other_slot, pos;
+
+        if (!s || id == NO_ID || index < 0 || index >= s->n_ids || (slot = set_find_slot(s, id)) == -1) {
+                return ERROR;
+        }
+
+        /*Both ids swap their positions, so the slots of both have to point to the new ones*/
+        pos = s->slots[slot] - 1;
+        if (pos != index) {
+                other_slot = set_find_slot(s, s->ids[index]);
+                s->ids[pos] = s->ids[index];
+                s->ids[index] = id;
+                s->slots[other_slot] = pos + 1;
+                s->slots[slot] = index + 1;
+        }
+
+        return OK;
+}
+
+int set_hash_id(Id id, int n_slots) {
+        unsigned long h = ((unsigned long)id * HASH_MULTIPLIER) & HASH_MASK;
+
+        return (int)((h ^ (h >> 16)) & (unsigned long)(n_slots - 1));
+}
+
 Status set_print(const Set* s) {
         int i = 0;
 
@@ -147,3 +293,74 @@ Status set_print(const Set* s) {
         printf("\n");
         return OK;
 }
+
+void set_iterator_init(Set_iterator* it, const Set* s) {
+        if (!it) return;
+        it->set = s;
+        it->index = 0;
+}
+
+Bool set_iterator_next(Set_iterator* it, Id* id) {
+        if (!it || !it->set || it->index >= it->set->n_ids) {
+                return FALSE;
+        }
+        if (id) {
+                *id = it->set->ids[it->index];
+        }
+        it->index++;
+        return TRUE;
+}
+
+/**
+   Implementation of private functions
+*/
+
+int set_find_slot(const Set* s, Id id) {
+        int slot;
+
+        if (s->n_ids == 0) {
+                return -1;
+        }
+        slot = set_hash_id(id, s->n_slots);
+        while (s->slots[slot] != EMPTY_SLOT) {
+                if (s->ids[s->slots[slot] - 1] == id) {
+                        return slot;
+                }
+                slot = (slot + 1) & (s->n_slots - 1);
+        }
+        return -1;
+}
+
+Status set_grow(Set* s) {
+        Id* ids = NULL;
+        int* slots = NULL;
+        int capacity, n_slots, i, slot;
+
+        capacity = s->capacity == 0 ? INITIAL_CAPACITY : 2 * s->capacity;
+        n_slots = 2 * capacity;
+
+        ids = (Id*)realloc(s->ids, capacity * sizeof(Id));
+        if (!ids) {
+                return ERROR;
+        }
+        s->ids = ids;
+
+        slots = (int*)calloc(n_slots, sizeof(int));
+        if (!slots) {
+                return ERROR;
+        }
+        free(s->slots);
+        s->slots = slots;
+        s->n_slots = n_slots;
+        s->capacity = capacity;
+
+        /*Rehash every id into the new table*/
+        for (i = 0; i < s->n_ids; i++) {
+                slot = set_hash_id(s->ids[i], s->n_slots);
+                while (s->slots[slot] != EMPTY_SLOT) {
+                        slot = (slot + 1) & (n_slots - 1);
+                }
+                s->slots[slot] = i + 1;
+        }
+        return OK;
+}
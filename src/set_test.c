@@ -21,13 +21,19 @@
  * @def MAX_TESTS
  * @brief Defines the maximum number of tests
  */
-#define MAX_TESTS 30
+#define MAX_TESTS 34
 /**
  * @def MAX_IDS
  * @brief Defines the maximum number of ids
  */
 #define MAX_IDS 50
 
+/**
+ * @def MANY_IDS
+ * @brief Defines a number of ids big enough to make the set grow several times
+ */
+#define MANY_IDS 1000
+
 /**
  * @brief Main function for SET unit tests.
  *
@@ -75,6 +81,18 @@ int main(int argc, char **argv) {
         if (all || test == 20) test2_set_get_id_at_index();
         if (all || test == 21) test3_set_get_id_at_index();
         if (all || test == 22) test4_set_get_id_at_index();
+        if (all || test == 23) test5_set_add();
+        if (all || test == 24) test6_set_del();
+        if (all || test == 25) test1_set_iterator_next();
+        if (all || test == 26) test2_set_iterator_next();
+        if (all || test == 27) test1_set_copy();
+        if (all || test == 28) test2_set_copy();
+        if (all || test == 29) test1_set_get_index();
+        if (all || test == 30) test2_set_get_index();
+        if (all || test == 31) test1_set_move();
+        if (all || test == 32) test2_set_move();
+        if (all || test == 33) test1_set_hash_id();
+        if (all || test == 34) test2_set_hash_id();
 
         PRINT_PASSED_PERCENTAGE;
 
@@ -245,3 +263,139 @@ void test4_set_get_id_at_index() {
         PRINT_TEST_RESULT(set_get_id_at_index(s, -2) == NO_ID);
         set_destroy(s);
 }
+
+void test5_set_add() {
+        Set *s;
+        int i, result = 1;
+        s = set_create();
+        for (i = 0; i < MANY_IDS; i++) {
+                if (set_add(s, i) == ERROR) result = 0;
+        }
+        for (i = 0; i < MANY_IDS; i++) {
+                if (set_has(s, i) == FALSE) result = 0;
+        }
+        PRINT_TEST_RESULT(result && set_get_nIds(s) == MANY_IDS);
+        set_destroy(s);
+}
+
+void test6_set_del() {
+        Set *s;
+        int i, result = 1;
+        s = set_create();
+        for (i = 0; i < MANY_IDS; i++) {
+                set_add(s, i);
+        }
+        for (i = 0; i < MANY_IDS; i += 2) {
+                if (set_del(s, i) != i) result = 0;
+        }
+        for (i = 0; i < MANY_IDS; i++) {
+                if (set_has(s, i) != (i % 2 ? TRUE : FALSE)) result = 0;
+        }
+        PRINT_TEST_RESULT(result && set_get_nIds(s) == MANY_IDS / 2);
+        set_destroy(s);
+}
+
+void test1_set_iterator_next() {
+        Set *s;
+        Set_iterator it;
+        Id id = NO_ID, sum = 0;
+        int n = 0;
+        s = set_create();
+        set_add(s, 3);
+        set_add(s, 7);
+        set_add(s, 11);
+        set_iterator_init(&it, s);
+        while (set_iterator_next(&it, &id)) {
+                sum += id;
+                n++;
+        }
+        PRINT_TEST_RESULT(n == 3 && sum == 21);
+        set_destroy(s);
+}
+
+void test2_set_iterator_next() {
+        Set *s;
+        Set_iterator it;
+        Id id = NO_ID;
+        s = set_create();
+        set_iterator_init(&it, s);
+        PRINT_TEST_RESULT(set_iterator_next(&it, &id) == FALSE);
+        set_destroy(s);
+}
+
+void test1_set_copy() {
+        Set *s = NULL, *copy = NULL;
+        s = set_create();
+        copy = set_create();
+        set_add(s, 5);
+        set_add(s, 7);
+        set_add(s, 9);
+        set_add(copy, 3);
+        PRINT_TEST_RESULT(set_copy(copy, s) == OK && set_get_nIds(copy) == 3 && set_get_id_at_index(copy, 0) == 5 &&
+                          set_get_id_at_index(copy, 2) == 9 && set_has(copy, 7) == TRUE && set_has(copy, 3) == FALSE);
+        set_destroy(s);
+        set_destroy(copy);
+}
+
+void test2_set_copy() {
+        Set *copy = NULL;
+        copy = set_create();
+        PRINT_TEST_RESULT(set_copy(copy, NULL) == ERROR);
+        set_destroy(copy);
+}
+
+void test1_set_get_index() {
+        Set *s = NULL;
+        s = set_create();
+        set_add(s, 5);
+        set_add(s, 7);
+        set_add(s, 9);
+        set_del(s, 5);
+        PRINT_TEST_RESULT(set_get_index(s, 9) == 0 && set_get_index(s, 7) == 1);
+        set_destroy(s);
+}
+
+void test2_set_get_index() {
+        Set *s = NULL;
+        s = set_create();
+        set_add(s, 5);
+        PRINT_TEST_RESULT(set_get_index(s, 7) == -1 && set_get_index(NULL, 5) == -1);
+        set_destroy(s);
+}
+
+void test1_set_move() {
+        Set *s = NULL;
+        s = set_create();
+        set_add(s, 5);
+        set_add(s, 7);
+        set_add(s, 9);
+        set_del(s, 5);
+        set_add(s, 5);
+        PRINT_TEST_RESULT(set_move(s, 5, 0) == OK && set_get_id_at_index(s, 0) == 5 && set_get_id_at_index(s, 1) == 7 &&
+                          set_get_id_at_index(s, 2) == 9 && set_get_index(s, 9) == 2 && set_has(s, 9) == TRUE);
+        set_destroy(s);
+}
+
+void test2_set_move() {
+        Set *s = NULL;
+        s = set_create();
+        set_add(s, 5);
+        set_add(s, 7);
+        PRINT_TEST_RESULT(set_move(s, 5, 2) == ERROR && set_move(s, 9, 0) == ERROR && set_get_id_at_index(s, 0) == 5);
+        set_destroy(s);
+}
+
+void test1_set_hash_id() {
+        PRINT_TEST_RESULT(set_hash_id(7, 8) >= 0 && set_hash_id(7, 8) < 8 && set_hash_id(7, 8) == set_hash_id(7, 8));
+}
+
+void test2_set_hash_id() {
+        int i;
+        Bool inside = TRUE;
+        for (i = 0; i < 1000; i++) {
+                if (set_hash_id(1234567L * i, 1024) < 0 || set_hash_id(1234567L * i, 1024) >= 1024) {
+                        inside = FALSE;
+                }
+        }
+        PRINT_TEST_RESULT(inside == TRUE && set_hash_id(-1, 16) >= 0 && set_hash_id(-1, 16) < 16);
+}
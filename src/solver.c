@@ -0,0 +1,1019 @@
+/**
+ * @brief It implements the solver, that finds the shortest list of commands that takes a game from its data file to
+ * a goal. It searches the games with A*, playing every command on a copy of the game, and a pool of workers plays
+ * the states of the same estimate and cost at the same time
+ *
+ * @file solver.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 27-05-2025
+ * @copyright GNU Public License
+ */
+
+/*The threads and the processor count are POSIX, not ANSI C*/
+#define _POSIX_C_SOURCE 200112L
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "command.h"
+#include "game.h"
+#include "game_actions.h"
+#include "game_rules.h"
+#include "types.h"
+#include "worker_pool.h"
+
+/**
+ * @def SOLVER_DEFAULT_DEPTH
+ * @brief Defines the max number of commands of a solution when no other is given
+ */
+#define SOLVER_DEFAULT_DEPTH 100
+
+/**
+ * @def SOLVER_MAX_DEPTH
+ * @brief Defines the max number of commands of a solution that may be asked for
+ */
+#define SOLVER_MAX_DEPTH 1000
+
+/**
+ * @def SOLVER_DEFAULT_STATES
+ * @brief Defines the max number of different states searched when no other number is given
+ */
+#define SOLVER_DEFAULT_STATES 1000000
+
+/**
+ * @def SOLVER_LINE_SIZE
+ * @brief Defines the max length of a command line tried by the solver
+ */
+#define SOLVER_LINE_SIZE 48
+
+/**
+ * @def SOLVER_MAX_COMMANDS
+ * @brief Defines the max number of commands tried from each state
+ */
+#define SOLVER_MAX_COMMANDS 64
+
+/**
+ * @def SOLVER_ROUND_SIZE
+ * @brief Defines the max number of states expanded in each round, the same whatever the number of workers, so the
+ * solution is too
+ */
+#define SOLVER_ROUND_SIZE 256
+
+/**
+ * @def SOLVER_TABLE_SIZE
+ * @brief Defines the number of entries of the table of states when it is created, it doubles when it is half full
+ */
+#define SOLVER_TABLE_SIZE 4096
+
+/**
+ * @def SOLVER_UNREACHABLE
+ * @brief Defines the estimate of a state from which the goal cannot be reached, and the distance between two spaces
+ * with no way from one to the other
+ */
+#define SOLVER_UNREACHABLE -1
+
+/**
+ * @brief Names of the directions, in the order of Direction
+ */
+const char *direction_names[NO_DIRECTION] = {"north", "south", "east", "west", "up", "down"};
+
+/**
+ * @brief Solver_node
+ *
+ * A state of the search: the command that got there from the state it comes from and what is known of its game.
+ * The game itself is not kept, a whole game is much bigger than the way to it: it is played again from the start
+ * when the state is expanded.
+ * */
+typedef struct _Solver_node {
+        Rule_state state;                /**< State of the rules of the game*/
+        int cost;                        /**< Number of commands played from the start*/
+        int estimate;                    /**< Least number of commands of a solution through the state*/
+        int step;                        /**< Position of the state in the steps of the solver*/
+        int parent;                      /**< Step of the state it comes from*/
+        int order;                       /**< Position of the command among the ones tried from the parent*/
+        char command[SOLVER_LINE_SIZE];  /**< Command that got to the state*/
+        Game_hash hash;                  /**< Hash of the game of the state*/
+        Bool goal;                       /**< TRUE if the state meets the goal*/
+        Bool dropped;                    /**< TRUE once a shorter way to the state has been found*/
+} Solver_node;
+
+/**
+ * @brief Solver_bucket
+ *
+ * The states waiting to be expanded that have the same estimate and cost.
+ * */
+typedef struct _Solver_bucket {
+        Solver_node **nodes;  /**< States of the bucket*/
+        int n_nodes;          /**< Number of states*/
+        int size;             /**< Number of states there is room for*/
+} Solver_bucket;
+
+/**
+ * @brief Solver_step
+ *
+ * What is kept of every state expanded, enough to write down the commands that lead to it.
+ * */
+typedef struct _Solver_step {
+        int parent;                      /**< Step it comes from, -1 for the start*/
+        char command[SOLVER_LINE_SIZE];  /**< Command that got to it*/
+} Solver_step;
+
+/**
+ * @brief Solver_entry
+ *
+ * An entry of the table of states found. Two states are the same if the hash of their games and the state of their
+ * rules match; the number of the turn is left out, as the rules only count it.
+ * */
+typedef struct _Solver_entry {
+        Game_hash hash;       /**< Hash of the game*/
+        int times_feeded;     /**< Times the queen ant has been fed*/
+        Bool spider_is_dead;  /**< TRUE when the spider enemy is defeated*/
+        int cost;             /**< Cost of the shortest way found to the state*/
+        int estimate;         /**< Estimate of the state along that way*/
+        int round;            /**< Round of the search the way was found in*/
+        Solver_node *node;    /**< State while it waits to be expanded, NULL once it has been*/
+        Bool used;            /**< TRUE if the entry holds a state*/
+} Solver_entry;
+
+/**
+ * @brief Solver
+ *
+ * The goal, the distances between the spaces, the states found and the buckets of the ones waiting. The states are
+ * expanded in rounds, taken from the bucket of the lowest estimate and, among the ones of the same estimate, of the
+ * highest cost, which is the closest to the goal. The workers share the table and the buckets, guarded by the lock;
+ * the states they expand are theirs alone.
+ * */
+typedef struct _Solver {
+        Id goal_space;              /**< Space some player must stand in, NO_ID if any*/
+        char *goal_character;       /**< Character that must be defeated, NULL if none*/
+        Bool adversarial;           /**< TRUE if every random number goes against the players*/
+        int max_depth;              /**< Max number of commands of a solution*/
+        int max_states;             /**< Max number of states found before giving up*/
+        Game *start;                /**< Game at the start, only read by the workers*/
+        Id *space_ids;              /**< Id of each space*/
+        int n_spaces;               /**< Number of spaces*/
+        int *distances;             /**< Least number of moves from each space to each other one*/
+        pthread_mutex_t lock;       /**< Lock of the fields below*/
+        Solver_entry *table;        /**< Table of the states found*/
+        int table_size;             /**< Number of entries of the table*/
+        int n_states;               /**< Number of states found*/
+        Solver_bucket *buckets;     /**< Buckets, by estimate and then by cost*/
+        int round;                  /**< Number of the round being played*/
+        int estimate;               /**< Estimate of the bucket being expanded*/
+        Bool pruned;                /**< TRUE if some state was left out for being too far from the goal*/
+        Bool failed;                /**< TRUE if the memory ran out*/
+        Solver_step *steps;         /**< Steps of every state expanded, in the order they were expanded*/
+        int n_steps;                /**< Number of steps*/
+        int steps_size;             /**< Number of steps there is room for*/
+} Solver;
+
+/*
+Private functions
+*/
+
+/**
+ * @brief Expands a state: plays every command that makes sense in it on its own copy of the game and adds the states
+ * to their buckets. It is the function of the pool
+ * @author Abraham Martín
+ *
+ * @param task Pointer to the node of the state
+ * @param context Pointer to the solver
+ */
+void solver_expand(void *task, void *context);
+
+/**
+ * @brief Plays again the commands that lead to a state, on a copy of the game at the start
+ * @author Abraham Martín
+ *
+ * @param solver Pointer to the solver
+ * @param node Pointer to the node of the state, its parent must be among the steps
+ * @return The game of the state, or NULL if there was any error
+ */
+Game *solver_replay(const Solver *solver, const Solver_node *node);
+
+/**
+ * @brief Plays a command line as the game loop does, with its rules
+ * @author Abraham Martín
+ *
+ * @param solver Pointer to the solver
+ * @param game Pointer to the game
+ * @param state Pointer to the state of the rules of the game
+ * @param line The command line
+ */
+void solver_play(const Solver *solver, Game *game, Rule_state *state, const char *line);
+
+/**
+ * @brief Writes the commands that make sense for the current player of a game
+ * @author Abraham Martín
+ *
+ * @param game Pointer to the game
+ * @param lines Array the commands are written to
+ * @return The number of commands
+ */
+int solver_get_commands(const Game *game, char lines[SOLVER_MAX_COMMANDS][SOLVER_LINE_SIZE]);
+
+/**
+ * @brief Checks if a game meets the goal of the solver
+ * @author Abraham Martín
+ *
+ * @param solver Pointer to the solver
+ * @param game Pointer to the game
+ * @return TRUE if it does, FALSE otherwise
+ */
+Bool solver_is_goal(const Solver *solver, Game *game);
+
+/**
+ * @brief Computes the distances between every two spaces, moving only through the links that are open. No command
+ * tried by the solver opens or closes a link, so they hold for every state
+ * @author Abraham Martín
+ *
+ * @param solver Pointer to the solver
+ * @param game Pointer to the game
+ * @return OK if everything goes well, ERROR otherwise
+ */
+Status solver_compute_distances(Solver *solver, Game *game);
+
+/**
+ * @brief Gets the distance from a space to another one
+ * @author Abraham Martín
+ *
+ * @param solver Pointer to the solver
+ * @param from Id of the first space
+ * @param to Id of the second space
+ * @return The least number of moves, or SOLVER_UNREACHABLE if there is no way
+ */
+int solver_get_distance(const Solver *solver, Id from, Id to);
+
+/**
+ * @brief Estimates the least number of commands left to the goal. A player that must play some commands of its own
+ * waits for the turns of the others before each one but the first. The estimate assumes the players alive stay
+ * alive, so it is never more than the real number unless some player dies on the way. With -a a hostile character
+ * cannot be defeated
+ * @author Abraham Martín
+ *
+ * @param solver Pointer to the solver
+ * @param game Pointer to the game
+ * @return The number of commands, or SOLVER_UNREACHABLE if the goal cannot be reached
+ */
+int solver_estimate(const Solver *solver, Game *game);
+
+/**
+ * @brief Adds a state to its bucket unless it was found before by a way as short. If it was found in the same round
+ * by a way as short, the command that comes earlier stays, so the solution does not depend on which worker goes
+ * first. The lock must be held
+ * @author Abraham Martín
+ *
+ * @param solver Pointer to the solver
+ * @param node Pointer to the node of the state, with its hash, its cost and the estimate of the commands left
+ * @return The node that is not kept, to be freed by the caller, or NULL if it is kept
+ */
+Solver_node *solver_add(Solver *solver, Solver_node *node);
+
+/**
+ * @brief Finds the entry of a state in the table of states found
+ * @author Abraham Martín
+ *
+ * @param solver Pointer to the solver
+ * @param node Pointer to the node of the state
+ * @return The entry of the state, or the free entry where it goes if it was not found
+ */
+Solver_entry *solver_find(const Solver *solver, const Solver_node *node);
+
+/**
+ * @brief Adds a node to the bucket of its estimate and cost. The lock must be held
+ * @author Abraham Martín
+ *
+ * @param solver Pointer to the solver
+ * @param node Pointer to the node
+ * @return OK if everything goes well, ERROR otherwise
+ */
+Status solver_push(Solver *solver, Solver_node *node);
+
+/**
+ * @brief Doubles the size of the table of states. The lock must be held
+ * @author Abraham Martín
+ *
+ * @param solver Pointer to the solver
+ * @return OK if everything goes well, ERROR otherwise
+ */
+Status solver_grow_table(Solver *solver);
+
+/**
+ * @brief Adds the step of a state to the solver, setting the step of the node
+ * @author Abraham Martín
+ *
+ * @param solver Pointer to the solver
+ * @param node Pointer to the node of the state
+ * @return OK if everything goes well, ERROR otherwise
+ */
+Status solver_add_step(Solver *solver, Solver_node *node);
+
+/**
+ * @brief Prints the commands that lead to a step, one for each line, from the first one
+ * @author Abraham Martín
+ *
+ * @param solver Pointer to the solver
+ * @param step Step of the last state
+ */
+void solver_print_solution(const Solver *solver, int step);
+
+/**
+ * @brief Compares two nodes by the step they come from and then by the order of their command, for qsort
+ * @author Abraham Martín
+ *
+ * @param a Pointer to the pointer to the first node
+ * @param b Pointer to the pointer to the second node
+ * @return A negative number, 0 or a positive number if the first one comes before, at the same place or after
+ */
+int solver_compare_nodes(const void *a, const void *b);
+
+/**
+ *@brief The main function of the solver.
+ *
+ * Use: solver <game_data_file> [-g <space_id>] [-k <character_name>] [-a] [-s <seed>] [-w <workers>]
+ * [-m <max_commands>] [-n <max_states>]. The goal is that some player stands in the space given with -g and that the
+ * character given with -k is defeated, at least one of them must be given. The random numbers come from the seed, as
+ * in the deterministic mode of the game, unless -a makes every combat go against the players, and then no hostile
+ * character can be defeated. The solution is written to the standard output, one command for each line, so it can be
+ * played with --headless.
+ */
+int main(int argc, char *argv[]) {
+        Solver solver;
+        Worker_pool *pool = NULL;
+        Solver_node *start = NULL;
+        Solver_bucket *bucket = NULL;
+        Solver_node *round[SOLVER_ROUND_SIZE];
+        Solver_entry *entry = NULL;
+        Game *game = NULL;
+        unsigned long seed = GAME_DEFAULT_SEED;
+        int n_workers = (int)sysconf(_SC_NPROCESSORS_ONLN);
+        int n_buckets, n_round, estimate, cost, i, solution = -1;
+        clock_t begin = clock();
+        time_t started = time(NULL);
+
+        if (argc < 2) {
+                fprintf(stderr,
+                        "Use: %s <game_data_file> [-g <space_id>] [-k <character_name>] [-a] [-s <seed>] [-w <workers>] "
+                        "[-m <max_commands>] [-n <max_states>]\n",
+                        argv[0]);
+                return 1;
+        }
+
+        memset(&solver, 0, sizeof(Solver));
+        solver.goal_space = NO_ID;
+        solver.adversarial = FALSE;
+        solver.max_depth = SOLVER_DEFAULT_DEPTH;
+        solver.max_states = SOLVER_DEFAULT_STATES;
+        for (i = 2; i < argc; i++) {
+                if (strcmp(argv[i], "-g") == 0 && i + 1 < argc) {
+                        solver.goal_space = atol(argv[++i]);
+                } else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc) {
+                        solver.goal_character = argv[++i];
+                } else if (strcmp(argv[i], "-a") == 0) {
+                        solver.adversarial = TRUE;
+                } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+                        seed = strtoul(argv[++i], NULL, 10);
+                } else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) {
+                        n_workers = atoi(argv[++i]);
+                } else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc) {
+                        solver.max_depth = atoi(argv[++i]);
+                } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+                        solver.max_states = atoi(argv[++i]);
+                } else {
+                        fprintf(stderr, "ERROR, unrecognized argument %s\n", argv[i]);
+                        fprintf(stderr,
+                                "Valid use: %s <game_data_file> [-g <space_id>] [-k <character_name>] [-a] [-s <seed>] "
+                                "[-w <workers>] [-m <max_commands>] [-n <max_states>]\n",
+                                argv[0]);
+                        return 1;
+                }
+        }
+        if (solver.goal_space == NO_ID && !solver.goal_character) {
+                fprintf(stderr, "ERROR, no goal given, use -g and/or -k\n");
+                return 1;
+        }
+        if (solver.max_depth < 0) {
+                solver.max_depth = 0;
+        } else if (solver.max_depth > SOLVER_MAX_DEPTH) {
+                solver.max_depth = SOLVER_MAX_DEPTH;
+        }
+        if (n_workers < 1) {
+                n_workers = 1;
+        } else if (n_workers > WORKER_POOL_MAX_WORKERS) {
+                n_workers = WORKER_POOL_MAX_WORKERS;
+        }
+        n_buckets = (solver.max_depth + 1) * (solver.max_depth + 1);
+
+        if (game_create_from_file(&game, argv[1]) == ERROR) {
+                fprintf(stderr, "Error while initializing game.\n");
+                game_destroy(game);
+                return 1;
+        }
+        game_set_deterministic_mode(game, 1);
+        game_set_seed(game, seed);
+        if (solver.goal_space != NO_ID && !game_get_space((const Game *)game, solver.goal_space)) {
+                fprintf(stderr, "ERROR, there is no space %ld\n", solver.goal_space);
+                game_destroy(game);
+                return 1;
+        }
+
+        if (pthread_mutex_init(&solver.lock, NULL) != 0 || solver_compute_distances(&solver, game) == ERROR ||
+            !(solver.table = (Solver_entry *)calloc(SOLVER_TABLE_SIZE, sizeof(Solver_entry))) ||
+            !(solver.buckets = (Solver_bucket *)calloc(n_buckets, sizeof(Solver_bucket))) ||
+            !(start = (Solver_node *)calloc(1, sizeof(Solver_node)))) {
+                fprintf(stderr, "Error while starting the solver.\n");
+                free(solver.space_ids);
+                free(solver.distances);
+                free(solver.table);
+                free(solver.buckets);
+                game_destroy(game);
+                return 1;
+        }
+        solver.table_size = SOLVER_TABLE_SIZE;
+
+        /*The start is the only state of the first bucket*/
+        solver.start = game;
+        start->state.turn = 1;
+        start->state.times_feeded = 0;
+        start->state.spider_is_dead = FALSE;
+        start->cost = 0;
+        start->estimate = solver_estimate(&solver, game);
+        start->parent = -1;
+        start->goal = solver_is_goal(&solver, game);
+        game_get_state_hash((const Game *)game, &start->hash);
+        free(solver_add(&solver, start));
+
+        if (!(pool = worker_pool_create(n_workers, solver_expand, &solver))) {
+                fprintf(stderr, "Error while starting the workers.\n");
+                solver.failed = TRUE;
+        }
+
+        /*No state waiting has a lower estimate than the bucket being expanded, so the first goal taken is the closest*/
+        estimate = 0;
+        while (estimate <= solver.max_depth && solution == -1 && !solver.failed) {
+                if (solver.n_states >= solver.max_states) {
+                        solver.pruned = TRUE;
+                        break;
+                }
+                for (cost = estimate; cost >= 0 && solver.buckets[estimate * (solver.max_depth + 1) + cost].n_nodes == 0;
+                     cost--)
+                        ;
+                if (cost < 0) {
+                        estimate++;
+                        continue;
+                }
+                bucket = &solver.buckets[estimate * (solver.max_depth + 1) + cost];
+
+                /*The order of a bucket does not depend on which worker got each state first. Every goal in the bucket
+                  is as close as any other*/
+                qsort(bucket->nodes, bucket->n_nodes, sizeof(Solver_node *), solver_compare_nodes);
+                for (i = 0; i < bucket->n_nodes && (bucket->nodes[i]->dropped || !bucket->nodes[i]->goal); i++)
+                        ;
+                if (i < bucket->n_nodes) {
+                        if (solver_add_step(&solver, bucket->nodes[i]) == ERROR) {
+                                solver.failed = TRUE;
+                        } else {
+                                solution = bucket->nodes[i]->step;
+                        }
+                        break;
+                }
+
+                /*The first states of the bucket are expanded, the children go deeper and the next round follows them*/
+                n_round = bucket->n_nodes < SOLVER_ROUND_SIZE ? bucket->n_nodes : SOLVER_ROUND_SIZE;
+                memcpy(round, bucket->nodes, n_round * sizeof(Solver_node *));
+                memmove(bucket->nodes, bucket->nodes + n_round, (bucket->n_nodes - n_round) * sizeof(Solver_node *));
+                bucket->n_nodes -= n_round;
+                solver.round++;
+                solver.estimate = estimate;
+
+                /*The workers read the steps while they replay the states, so every step of the round is added before
+                  the first state is handed out and the steps are not moved while they are read*/
+                for (i = 0; i < n_round && !solver.failed; i++) {
+                        if (round[i]->dropped) {
+                                continue;
+                        }
+                        entry = solver_find(&solver, round[i]);
+                        entry->node = NULL;
+                        if (solver_add_step(&solver, round[i]) == ERROR) {
+                                solver.failed = TRUE;
+                        }
+                }
+                for (i = 0; i < n_round && !solver.failed; i++) {
+                        if (!round[i]->dropped) {
+                                worker_pool_submit(pool, round[i]);
+                        }
+                }
+                worker_pool_wait(pool);
+                for (i = 0; i < n_round; i++) {
+                        free(round[i]);
+                }
+        }
+
+        worker_pool_destroy(pool);
+        for (i = 0; i < n_buckets; i++) {
+                for (cost = 0; cost < solver.buckets[i].n_nodes; cost++) {
+                        free(solver.buckets[i].nodes[cost]);
+                }
+                free(solver.buckets[i].nodes);
+        }
+
+        if (solution != -1) {
+                solver_print_solution(&solver, solution);
+        }
+        fprintf(stderr, "%s: %d states, %.2f s of processor, %ld s of wall clock\n",
+                solution != -1  ? "Solved"
+                : solver.failed ? "Out of memory"
+                : solver.pruned ? "Gave up"
+                                : "The goal cannot be reached",
+                solver.n_states, (double)(clock() - begin) / CLOCKS_PER_SEC, (long)(time(NULL) - started));
+
+        free(solver.buckets);
+        free(solver.table);
+        free(solver.steps);
+        free(solver.space_ids);
+        free(solver.distances);
+        game_destroy(solver.start);
+        pthread_mutex_destroy(&solver.lock);
+
+        return solution != -1 ? 0 : 1;
+}
+
+/**
+   Implementation of private functions
+*/
+
+void solver_expand(void *task, void *context) {
+        Solver_node *node = (Solver_node *)task, *child = NULL;
+        Solver *solver = (Solver *)context;
+        char lines[SOLVER_MAX_COMMANDS][SOLVER_LINE_SIZE];
+        Game *game = NULL, *copy = NULL;
+        int n_lines, i;
+
+        if (!(game = solver_replay(solver, node))) {
+                pthread_mutex_lock(&solver->lock);
+                solver->failed = TRUE;
+                pthread_mutex_unlock(&solver->lock);
+                return;
+        }
+
+        n_lines = solver_get_commands((const Game *)game, lines);
+        for (i = 0; i < n_lines; i++) {
+                if (!(child = (Solver_node *)calloc(1, sizeof(Solver_node))) ||
+                    game_clone((const Game *)game, &copy) == ERROR) {
+                        free(child);
+                        pthread_mutex_lock(&solver->lock);
+                        solver->failed = TRUE;
+                        pthread_mutex_unlock(&solver->lock);
+                        break;
+                }
+
+                child->state = node->state;
+                solver_play(solver, copy, &child->state, lines[i]);
+                strcpy(child->command, lines[i]);
+                child->cost = node->cost + 1;
+                child->parent = node->step;
+                child->order = i;
+                child->goal = solver_is_goal(solver, copy);
+                child->estimate = solver_estimate(solver, copy);
+                game_get_state_hash((const Game *)copy, &child->hash);
+
+                /*A game that is over is not searched further*/
+                if (game_get_finished((const Game *)copy) && !child->goal) {
+                        child->estimate = SOLVER_UNREACHABLE;
+                }
+                game_destroy(copy);
+                copy = NULL;
+
+                pthread_mutex_lock(&solver->lock);
+                child = solver_add(solver, child);
+                pthread_mutex_unlock(&solver->lock);
+                free(child);
+        }
+
+        game_destroy(game);
+}
+
+Game *solver_replay(const Solver *solver, const Solver_node *node) {
+        const char *lines[SOLVER_MAX_DEPTH + 1];
+        Rule_state state;
+        Game *game = NULL;
+        int n_lines = 0, step;
+
+        if (game_clone((const Game *)solver->start, &game) == ERROR) {
+                game_destroy(game);
+                return NULL;
+        }
+        if (node->parent == -1) {
+                return game;
+        }
+
+        /*The way is found from the end, it is played from the start*/
+        lines[n_lines++] = node->command;
+        for (step = node->parent; step != -1 && solver->steps[step].parent != -1 && n_lines <= SOLVER_MAX_DEPTH;
+             step = solver->steps[step].parent) {
+                lines[n_lines++] = solver->steps[step].command;
+        }
+
+        state.turn = 1;
+        state.times_feeded = 0;
+        state.spider_is_dead = FALSE;
+        while (n_lines > 0) {
+                solver_play(solver, game, &state, lines[--n_lines]);
+        }
+
+        return game;
+}
+
+void solver_play(const Solver *solver, Game *game, Rule_state *state, const char *line) {
+        char buffer[SOLVER_LINE_SIZE];
+        int draws[MAX_DRAWS];
+        Command *command = NULL;
+
+        /*Zero is the worst draw for the players: they lose every combat*/
+        if (solver->adversarial) {
+                memset(draws, 0, sizeof(draws));
+                game_set_forced_draws(game, draws, MAX_DRAWS);
+        }
+
+        /*The line is parsed in place*/
+        strcpy(buffer, line);
+        command = game_get_last_command((const Game *)game);
+        command_parse(command, buffer);
+        game_actions_update(game, command);
+        game_rule_update(game, command, state->turn, &state->times_feeded, &state->spider_is_dead);
+        state->turn++;
+}
+
+int solver_get_commands(const Game *game, char lines[SOLVER_MAX_COMMANDS][SOLVER_LINE_SIZE]) {
+        Player *player = game_get_current_player(game);
+        Space *space = NULL;
+        Object *object = NULL;
+        Character *character = NULL;
+        Set_iterator it;
+        Id location, id;
+        int n = 0, d;
+
+        if (!player || !(space = game_get_space(game, (location = player_get_location(player))))) {
+                return 0;
+        }
+
+        for (d = 0; d < NO_DIRECTION && n < SOLVER_MAX_COMMANDS; d++) {
+                if (game_get_connection(game, location, (Direction)d) != NO_ID &&
+                    game_connection_is_open(game, location, (Direction)d)) {
+                        sprintf(lines[n++], "move %s", direction_names[d]);
+                }
+        }
+
+        set_iterator_init(&it, space_get_objects(space));
+        while (n < SOLVER_MAX_COMMANDS && set_iterator_next(&it, &id)) {
+                if ((object = game_get_object_from_id(game, id)) &&
+                    strlen(object_get_name(object)) < SOLVER_LINE_SIZE - sizeof("take ")) {
+                        sprintf(lines[n++], "take %s", object_get_name(object));
+                }
+        }
+
+        /*Each object carried may be dropped or used, two lines for each*/
+        set_iterator_init(&it, player_get_objects(player));
+        while (n + 1 < SOLVER_MAX_COMMANDS && set_iterator_next(&it, &id)) {
+                if ((object = game_get_object_from_id(game, id)) &&
+                    strlen(object_get_name(object)) < SOLVER_LINE_SIZE - sizeof("drop ")) {
+                        sprintf(lines[n++], "drop %s", object_get_name(object));
+                        sprintf(lines[n++], "use %s", object_get_name(object));
+                }
+        }
+
+        set_iterator_init(&it, space_get_characters(space));
+        while (n < SOLVER_MAX_COMMANDS && set_iterator_next(&it, &id)) {
+                if (!(character = game_get_character_from_id(game, id)) || character_get_health(character) <= 0 ||
+                    strlen(character_get_name(character)) >= SOLVER_LINE_SIZE - sizeof("recruit ")) {
+                        continue;
+                }
+                if (character_get_friendly(character) == FALSE) {
+                        sprintf(lines[n++], "attack %s", character_get_name(character));
+                } else if (character_get_following(character) == NO_ID) {
+                        sprintf(lines[n++], "recruit %s", character_get_name(character));
+                }
+        }
+
+        set_iterator_init(&it, player_get_followers(player));
+        while (n < SOLVER_MAX_COMMANDS && set_iterator_next(&it, &id)) {
+                if ((character = game_get_character_from_id(game, id)) &&
+                    strlen(character_get_name(character)) < SOLVER_LINE_SIZE - sizeof("abandon ")) {
+                        sprintf(lines[n++], "abandon %s", character_get_name(character));
+                }
+        }
+
+        return n;
+}
+
+Bool solver_is_goal(const Solver *solver, Game *game) {
+        Player *player = NULL;
+        Character *character = NULL;
+        Bool reached = FALSE;
+        int i;
+
+        if (solver->goal_space != NO_ID) {
+                for (i = 0; i < game_get_n_alive_players((const Game *)game) && !reached; i++) {
+                        player = game_get_player_in_turn((const Game *)game, i);
+                        reached = player && player_get_location(player) == solver->goal_space ? TRUE : FALSE;
+                }
+                if (!reached) {
+                        return FALSE;
+                }
+        }
+
+        /*A defeated character may be renamed, so it is not found by its name any more*/
+        if (solver->goal_character && (character = game_get_character_from_name(game, solver->goal_character)) &&
+            character_get_health(character) > 0) {
+                return FALSE;
+        }
+
+        return TRUE;
+}
+
+Status solver_compute_distances(Solver *solver, Game *game) {
+        int *queue = NULL, *distances = NULL;
+        int first, last, from, to, d;
+        Id next;
+
+        solver->n_spaces = game_get_n_spaces(game);
+        solver->space_ids = (Id *)malloc((solver->n_spaces + 1) * sizeof(Id));
+        solver->distances = (int *)malloc((solver->n_spaces * solver->n_spaces + 1) * sizeof(int));
+        queue = (int *)malloc((solver->n_spaces + 1) * sizeof(int));
+        if (!solver->space_ids || !solver->distances || !queue) {
+                free(queue);
+                return ERROR;
+        }
+        for (from = 0; from < solver->n_spaces; from++) {
+                solver->space_ids[from] = space_get_id(game_get_space_from_index(game, from));
+        }
+
+        /*A breadth first search from each space, the spaces are few*/
+        for (from = 0; from < solver->n_spaces; from++) {
+                distances = &solver->distances[from * solver->n_spaces];
+                for (to = 0; to < solver->n_spaces; to++) {
+                        distances[to] = SOLVER_UNREACHABLE;
+                }
+                distances[from] = 0;
+                queue[0] = from;
+                for (first = 0, last = 1; first < last; first++) {
+                        for (d = 0; d < NO_DIRECTION; d++) {
+                                next = game_get_connection((const Game *)game, solver->space_ids[queue[first]], (Direction)d);
+                                if (next == NO_ID ||
+                                    !game_connection_is_open((const Game *)game, solver->space_ids[queue[first]], (Direction)d)) {
+                                        continue;
+                                }
+                                for (to = 0; to < solver->n_spaces && solver->space_ids[to] != next; to++)
+                                        ;
+                                if (to < solver->n_spaces && distances[to] == SOLVER_UNREACHABLE) {
+                                        distances[to] = distances[queue[first]] + 1;
+                                        queue[last++] = to;
+                                }
+                        }
+                }
+        }
+        free(queue);
+
+        return OK;
+}
+
+int solver_get_distance(const Solver *solver, Id from, Id to) {
+        int i, j;
+
+        for (i = 0; i < solver->n_spaces && solver->space_ids[i] != from; i++)
+                ;
+        for (j = 0; j < solver->n_spaces && solver->space_ids[j] != to; j++)
+                ;
+        if (i == solver->n_spaces || j == solver->n_spaces) {
+                return SOLVER_UNREACHABLE;
+        }
+
+        return solver->distances[i * solver->n_spaces + j];
+}
+
+int solver_estimate(const Solver *solver, Game *game) {
+        Player *player = NULL;
+        Character *character = NULL;
+        Id target = NO_ID;
+        int n_players = game_get_n_alive_players((const Game *)game);
+        int space_estimate = 0, character_estimate = 0, offset, moves, commands;
+
+        if (solver->goal_space != NO_ID) {
+                space_estimate = SOLVER_UNREACHABLE;
+                for (offset = 0; offset < n_players; offset++) {
+                        player = game_get_player_in_turn((const Game *)game, offset);
+                        moves = solver_get_distance(solver, player_get_location(player), solver->goal_space);
+                        if (moves == SOLVER_UNREACHABLE) {
+                                continue;
+                        }
+                        commands = moves == 0 ? 0 : offset + (moves - 1) * n_players + 1;
+                        if (space_estimate == SOLVER_UNREACHABLE || commands < space_estimate) {
+                                space_estimate = commands;
+                        }
+                }
+                if (space_estimate == SOLVER_UNREACHABLE) {
+                        return SOLVER_UNREACHABLE;
+                }
+        }
+
+        /*A hostile character is only hurt by a combat the players win, and with -a they lose every one*/
+        if (solver->adversarial && solver->goal_character &&
+            (character = game_get_character_from_name(game, solver->goal_character)) && character_get_health(character) > 0 &&
+            character_get_friendly(character) == FALSE) {
+                return SOLVER_UNREACHABLE;
+        }
+
+        /*The character must be attacked at least once where it stands*/
+        if (solver->goal_character && (character = game_get_character_from_name(game, solver->goal_character)) &&
+            character_get_health(character) > 0 &&
+            (target = game_get_character_location((const Game *)game, character_get_id(character))) != NO_ID) {
+                character_estimate = SOLVER_UNREACHABLE;
+                for (offset = 0; offset < n_players; offset++) {
+                        player = game_get_player_in_turn((const Game *)game, offset);
+                        moves = solver_get_distance(solver, player_get_location(player), target);
+                        if (moves == SOLVER_UNREACHABLE) {
+                                continue;
+                        }
+                        commands = offset + moves * n_players + 1;
+                        if (character_estimate == SOLVER_UNREACHABLE || commands < character_estimate) {
+                                character_estimate = commands;
+                        }
+                }
+                if (character_estimate == SOLVER_UNREACHABLE) {
+                        return SOLVER_UNREACHABLE;
+                }
+        }
+
+        return space_estimate > character_estimate ? space_estimate : character_estimate;
+}
+
+Solver_node *solver_add(Solver *solver, Solver_node *node) {
+        Solver_entry *entry = NULL;
+        Solver_node swap;
+
+        if (solver->failed) {
+                return node;
+        }
+
+        /*A state from which the goal is out of reach is not searched further*/
+        if (!node->goal && node->estimate == SOLVER_UNREACHABLE) {
+                return node;
+        }
+
+        /*No estimate falls below that of the bucket being expanded, even if a player died on the way*/
+        node->estimate = node->goal ? node->cost : node->cost + node->estimate;
+        if (node->estimate < solver->estimate) {
+                node->estimate = solver->estimate;
+        }
+        if (node->estimate > solver->max_depth) {
+                solver->pruned = TRUE;
+                return node;
+        }
+
+        if (2 * (solver->n_states + 1) > solver->table_size && solver_grow_table(solver) == ERROR) {
+                solver->failed = TRUE;
+                return node;
+        }
+
+        entry = solver_find(solver, node);
+        if (entry->used) {
+                if (node->cost > entry->cost) {
+                        return node;
+                }
+
+                /*Found again in the same round by a way as short: the command that comes first keeps the place*/
+                if (node->cost == entry->cost) {
+                        if (entry->round != solver->round || !entry->node || solver_compare_nodes(&node, &entry->node) >= 0) {
+                                return node;
+                        }
+                        swap = *entry->node;
+                        *entry->node = *node;
+                        *node = swap;
+                        return node;
+                }
+
+                /*A shorter way to a state still waiting takes it to the bucket of its new cost*/
+                if (entry->node) {
+                        entry->node->dropped = TRUE;
+                }
+        } else {
+                solver->n_states++;
+        }
+
+        if (solver_push(solver, node) == ERROR) {
+                solver->failed = TRUE;
+                return node;
+        }
+        entry->used = TRUE;
+        entry->hash = node->hash;
+        entry->times_feeded = node->state.times_feeded;
+        entry->spider_is_dead = node->state.spider_is_dead;
+        entry->cost = node->cost;
+        entry->estimate = node->estimate;
+        entry->round = solver->round;
+        entry->node = node;
+
+        return NULL;
+}
+
+Solver_entry *solver_find(const Solver *solver, const Solver_node *node) {
+        Solver_entry *entry = NULL;
+        int position;
+
+        position = (int)((node->hash.low ^ node->hash.high) & (unsigned long)(solver->table_size - 1));
+        while ((entry = &solver->table[position])->used) {
+                if (entry->hash.low == node->hash.low && entry->hash.high == node->hash.high &&
+                    entry->times_feeded == node->state.times_feeded && entry->spider_is_dead == node->state.spider_is_dead) {
+                        break;
+                }
+                position = (position + 1) & (solver->table_size - 1);
+        }
+
+        return entry;
+}
+
+Status solver_push(Solver *solver, Solver_node *node) {
+        Solver_bucket *bucket = &solver->buckets[node->estimate * (solver->max_depth + 1) + node->cost];
+        Solver_node **nodes = NULL;
+
+        if (bucket->n_nodes == bucket->size) {
+                nodes = (Solver_node **)realloc(bucket->nodes,
+                                                (bucket->size ? 2 * bucket->size : SOLVER_TABLE_SIZE) * sizeof(Solver_node *));
+                if (!nodes) {
+                        return ERROR;
+                }
+                bucket->nodes = nodes;
+                bucket->size = bucket->size ? 2 * bucket->size : SOLVER_TABLE_SIZE;
+        }
+        bucket->nodes[bucket->n_nodes++] = node;
+
+        return OK;
+}
+
+Status solver_grow_table(Solver *solver) {
+        Solver_entry *table = NULL;
+        int size = 2 * solver->table_size, i, position;
+
+        if (!(table = (Solver_entry *)calloc(size, sizeof(Solver_entry)))) {
+                return ERROR;
+        }
+        for (i = 0; i < solver->table_size; i++) {
+                if (!solver->table[i].used) {
+                        continue;
+                }
+                position = (int)((solver->table[i].hash.low ^ solver->table[i].hash.high) & (unsigned long)(size - 1));
+                while (table[position].used) {
+                        position = (position + 1) & (size - 1);
+                }
+                table[position] = solver->table[i];
+        }
+        free(solver->table);
+        solver->table = table;
+        solver->table_size = size;
+
+        return OK;
+}
+
+Status solver_add_step(Solver *solver, Solver_node *node) {
+        Solver_step *steps = NULL;
+
+        if (solver->n_steps == solver->steps_size) {
+                steps = (Solver_step *)realloc(solver->steps, (solver->steps_size ? 2 * solver->steps_size : SOLVER_TABLE_SIZE) *
+                                                                      sizeof(Solver_step));
+                if (!steps) {
+                        return ERROR;
+                }
+                solver->steps = steps;
+                solver->steps_size = solver->steps_size ? 2 * solver->steps_size : SOLVER_TABLE_SIZE;
+        }
+
+        solver->steps[solver->n_steps].parent = node->parent;
+        strcpy(solver->steps[solver->n_steps].command, node->command);
+        node->step = solver->n_steps++;
+
+        return OK;
+}
+
+void solver_print_solution(const Solver *solver, int step) {
+        if (solver->steps[step].parent == -1) {
+                return;
+        }
+
+        solver_print_solution(solver, solver->steps[step].parent);
+        printf("%s\n", solver->steps[step].command);
+}
+
+int solver_compare_nodes(const void *a, const void *b) {
+        const Solver_node *first = *(Solver_node *const *)a, *second = *(Solver_node *const *)b;
+
+        if (first->parent != second->parent) {
+                return first->parent < second->parent ? -1 : 1;
+        }
+
+        return first->order - second->order;
+}
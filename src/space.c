@@ -87,6 +87,33 @@ Status space_destroy(Space* space) {
         return OK;
 }
 
+Space* space_copy(const Space* space) {
+        Space* copy = NULL;
+        Set* objects = NULL;
+        Set* characters = NULL;
+
+        /* Error control */
+        if (!space) return NULL;
+
+        copy = space_create(space->id);
+        if (!copy) {
+                return NULL;
+        }
+
+        /* The name and the drawing are copied at once, the objects and characters keep their own sets*/
+        objects = copy->objects;
+        characters = copy->characters;
+        *copy = *space;
+        copy->objects = objects;
+        copy->characters = characters;
+        if (set_copy(copy->objects, space->objects) == ERROR || set_copy(copy->characters, space->characters) == ERROR) {
+                space_destroy(copy);
+                return NULL;
+        }
+
+        return copy;
+}
+
 Id space_get_id(const Space* space) {
         /* Error control */
         if (!space) {
@@ -154,6 +181,14 @@ Id space_del_object(Space* space, Id id) {
         return set_del(space->objects, id);
 }
 
+Status space_move_object(Space* space, Id id, int index) {
+        /* Error control */
+        if (!space || id == NO_ID) {
+                return ERROR;
+        }
+        return set_move(space->objects, id, index);
+}
+
 Status space_add_character(Space* space, Id id) {
         /* Error control */
         if (!space || id == NO_ID) {
@@ -177,6 +212,14 @@ Id space_del_character(Space* space, Id id) {
         return set_del(space->characters, id);
 }
 
+Status space_move_character(Space* space, Id id, int index) {
+        /* Error control */
+        if (!space || id == NO_ID) {
+                return ERROR;
+        }
+        return set_move(space->characters, id, index);
+}
+
 Status space_set_gdesc(Space* space, char gdesc[GDESC_LINES][LINE_LENGTH + 1]) {
         int i;
         if (!space || !gdesc) return ERROR;
@@ -193,6 +236,11 @@ const char* space_get_gdesc(const Space* space, int row_num) {
                 return space->gdesc[row_num];
 }
 
+const char* space_get_stored_gdesc(const Space* space, int row_num) {
+        if (!space || row_num < 0 || row_num >= GDESC_LINES) return EMPTY_ROW;
+        return space->gdesc[row_num];
+}
+
 int space_get_num_objects(const Space* space) {
         if (!space) return 0;
         return set_get_nIds(space->objects);
@@ -236,6 +284,16 @@ Id space_get_id_at_index(const Space* space, int index) {
         return set_get_id_at_index(space->objects, index);
 }
 
+const Set* space_get_objects(const Space* space) {
+        if (!space) return NULL;
+        return space->objects;
+}
+
+const Set* space_get_characters(const Space* space) {
+        if (!space) return NULL;
+        return space->characters;
+}
+
 Status space_print(const Space* space) {
         int i, j;
 
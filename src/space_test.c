@@ -84,6 +84,14 @@ int main(int argc, char **argv) {
         if (all || test == 34) test2_space_set_characters();
         if (all || test == 35) test1_space_get_id_at_index();
         if (all || test == 36) test2_space_get_id_at_index();
+        if (all || test == 37) test1_space_get_stored_gdesc();
+        if (all || test == 38) test2_space_get_stored_gdesc();
+        if (all || test == 39) test1_space_copy();
+        if (all || test == 40) test2_space_copy();
+        if (all || test == 41) test1_space_move_object();
+        if (all || test == 42) test2_space_move_object();
+        if (all || test == 43) test1_space_move_character();
+        if (all || test == 44) test2_space_move_character();
 
         PRINT_PASSED_PERCENTAGE;
 
@@ -350,3 +358,69 @@ void test2_space_get_id_at_index() {
         Space *s = NULL;
         PRINT_TEST_RESULT(space_get_id_at_index(s, 4) == NO_ID);
 }
+
+void test1_space_get_stored_gdesc() {
+        Space *s = NULL;
+        char gdesc_aux[GDESC_LINES][LINE_LENGTH + 1] = {"ABC"};
+        s = space_create(1);
+        space_set_gdesc(s, gdesc_aux);
+        PRINT_TEST_RESULT(strcmp(space_get_stored_gdesc(s, 0), "ABC") == 0);
+        space_destroy(s);
+}
+
+void test2_space_get_stored_gdesc() {
+        Space *s = NULL;
+        PRINT_TEST_RESULT(space_get_stored_gdesc(s, 0) != NULL);
+}
+
+void test1_space_copy() {
+        Space *s = NULL, *copy = NULL;
+        s = space_create(5);
+        space_set_name(s, "hola");
+        space_add_object(s, 11);
+        copy = space_copy(s);
+        space_add_object(copy, 12);
+        PRINT_TEST_RESULT(copy != NULL && space_get_id(copy) == 5 && strcmp(space_get_name(copy), "hola") == 0 &&
+                          space_has_object(copy, 11) == TRUE && space_get_num_objects(copy) == 2 &&
+                          space_get_num_objects(s) == 1);
+        space_destroy(s);
+        space_destroy(copy);
+}
+
+void test2_space_copy() {
+        PRINT_TEST_RESULT(space_copy(NULL) == NULL);
+}
+
+void test1_space_move_object() {
+        Space *s = NULL;
+        s = space_create(5);
+        space_add_object(s, 11);
+        space_add_object(s, 12);
+        space_add_object(s, 13);
+        PRINT_TEST_RESULT(space_move_object(s, 13, 0) == OK && set_get_id_at_index(space_get_objects(s), 0) == 13 &&
+                          set_get_id_at_index(space_get_objects(s), 2) == 11);
+        space_destroy(s);
+}
+
+void test2_space_move_object() {
+        Space *s = NULL;
+        s = space_create(5);
+        space_add_object(s, 11);
+        PRINT_TEST_RESULT(space_move_object(s, 12, 0) == ERROR);
+        space_destroy(s);
+}
+
+void test1_space_move_character() {
+        Space *s = NULL;
+        s = space_create(5);
+        space_add_character(s, 21);
+        space_add_character(s, 22);
+        PRINT_TEST_RESULT(space_move_character(s, 22, 0) == OK &&
+                          set_get_id_at_index(space_get_characters(s), 0) == 22 &&
+                          set_get_id_at_index(space_get_characters(s), 1) == 21);
+        space_destroy(s);
+}
+
+void test2_space_move_character() {
+        PRINT_TEST_RESULT(space_move_character(NULL, 21, 0) == ERROR);
+}
@@ -0,0 +1,158 @@
+/**
+ * @brief It implements the text builder module
+ *
+ * @file text_builder.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 20-05-2025
+ * @copyright GNU Public License
+ */
+
+#include "text_builder.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @def NUMBER_SIZE
+ * @brief Defines the room needed by the digits and the sign of a long
+ */
+#define NUMBER_SIZE 24
+
+/*
+Private functions
+*/
+
+/**
+ * @brief Appends the same character several times
+ * @author Abraham Martín
+ *
+ * @param tb Pointer to an initialized builder
+ * @param c Character to append
+ * @param n Number of times
+ * @return OK if they fitted, ERROR otherwise
+ */
+Status text_builder_fill(Text_builder *tb, char c, int n);
+
+Status text_builder_init(Text_builder *tb, char *buffer, int size) {
+        if (!tb || !buffer || size <= 0) {
+                return ERROR;
+        }
+
+        tb->buffer = buffer;
+        tb->size = size;
+        tb->length = 0;
+        tb->truncated = FALSE;
+        buffer[0] = '\0';
+
+        return OK;
+}
+
+Status text_builder_append(Text_builder *tb, const char *str) {
+        if (!str) {
+                return ERROR;
+        }
+
+        return text_builder_append_n(tb, str, (int)strlen(str));
+}
+
+Status text_builder_append_n(Text_builder *tb, const char *str, int n) {
+        int room, length = 0;
+
+        if (!tb || !str || n < 0) {
+                return ERROR;
+        }
+
+        while (length < n && str[length]) {
+                length++;
+        }
+
+        room = tb->size - 1 - tb->length;
+        if (length > room) {
+                length = room;
+                tb->truncated = TRUE;
+        }
+        memcpy(tb->buffer + tb->length, str, length);
+        tb->length += length;
+        tb->buffer[tb->length] = '\0';
+
+        return tb->truncated == TRUE ? ERROR : OK;
+}
+
+Status text_builder_append_padded(Text_builder *tb, const char *str, int width) {
+        int length;
+
+        if (!tb || !str) {
+                return ERROR;
+        }
+
+        length = (int)strlen(str);
+        if (width > length) {
+                text_builder_fill(tb, ' ', width - length);
+        }
+        text_builder_append_n(tb, str, length);
+        if (-width > length) {
+                text_builder_fill(tb, ' ', -width - length);
+        }
+
+        return tb->truncated == TRUE ? ERROR : OK;
+}
+
+Status text_builder_append_number(Text_builder *tb, long number, int width) {
+        char digits[NUMBER_SIZE];
+        unsigned long value;
+        int i = NUMBER_SIZE - 1;
+
+        if (!tb) {
+                return ERROR;
+        }
+
+        /*The digits are written backwards from the end of the buffer*/
+        digits[i] = '\0';
+        value = number < 0 ? 0UL - (unsigned long)number : (unsigned long)number;
+        do {
+                digits[--i] = (char)('0' + value % 10);
+                value /= 10;
+        } while (value > 0);
+        if (number < 0) {
+                digits[--i] = '-';
+        }
+
+        return text_builder_append_padded(tb, digits + i, width);
+}
+
+int text_builder_get_length(const Text_builder *tb) {
+        if (!tb) {
+                return -1;
+        }
+
+        return tb->length;
+}
+
+Bool text_builder_is_truncated(const Text_builder *tb) {
+        if (!tb) {
+                return TRUE;
+        }
+
+        return tb->truncated;
+}
+
+/**
+   Implementation of private functions
+*/
+
+Status text_builder_fill(Text_builder *tb, char c, int n) {
+        int room;
+
+        room = tb->size - 1 - tb->length;
+        if (n > room) {
+                n = room;
+                tb->truncated = TRUE;
+        }
+        memset(tb->buffer + tb->length, c, n);
+        tb->length += n;
+        tb->buffer[tb->length] = '\0';
+
+        return tb->truncated == TRUE ? ERROR : OK;
+}
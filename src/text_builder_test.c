@@ -0,0 +1,161 @@
+/**
+ * @brief It tests the text builder module
+ *
+ * @file text_builder_test.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 20-05-2025
+ * @copyright GNU Public License
+ */
+
+#include "text_builder.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+#include "text_builder_test.h"
+
+/**
+ * @def MAX_TESTS
+ * @brief Defines the maximum number of tests
+ */
+#define MAX_TESTS 12
+
+/**
+ * @brief Main function for TEXT_BUILDER unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv) {
+        int test = 0;
+        int all = 1;
+
+        if (argc < 2) {
+                printf("Running all test for module Text_builder:\n");
+        } else {
+                test = atoi(argv[1]);
+                all = 0;
+                printf("Running test %d:\t", test);
+                if (test < 1 && test > MAX_TESTS) {
+                        printf("Error: unknown test %d\t", test);
+                        exit(EXIT_SUCCESS);
+                }
+        }
+
+        if (all || test == 1) test1_text_builder_init();
+        if (all || test == 2) test2_text_builder_init();
+        if (all || test == 3) test1_text_builder_append();
+        if (all || test == 4) test2_text_builder_append();
+        if (all || test == 5) test3_text_builder_append();
+        if (all || test == 6) test1_text_builder_append_n();
+        if (all || test == 7) test2_text_builder_append_n();
+        if (all || test == 8) test1_text_builder_append_padded();
+        if (all || test == 9) test2_text_builder_append_padded();
+        if (all || test == 10) test3_text_builder_append_padded();
+        if (all || test == 11) test1_text_builder_append_number();
+        if (all || test == 12) test1_text_builder_is_truncated();
+
+        PRINT_PASSED_PERCENTAGE;
+
+        return EXIT_SUCCESS;
+}
+
+void test1_text_builder_init() {
+        char buffer[8] = "abc";
+        Text_builder tb;
+        PRINT_TEST_RESULT(text_builder_init(&tb, buffer, 8) == OK && buffer[0] == '\0' && text_builder_get_length(&tb) == 0);
+}
+
+void test2_text_builder_init() {
+        char buffer[8];
+        Text_builder tb;
+        PRINT_TEST_RESULT(text_builder_init(&tb, buffer, 0) == ERROR);
+}
+
+void test1_text_builder_append() {
+        char buffer[16];
+        Text_builder tb;
+        text_builder_init(&tb, buffer, 16);
+        text_builder_append(&tb, "ant");
+        text_builder_append(&tb, "hill");
+        PRINT_TEST_RESULT(strcmp(buffer, "anthill") == 0 && text_builder_get_length(&tb) == 7);
+}
+
+void test2_text_builder_append() {
+        char buffer[6];
+        Text_builder tb;
+        Status st;
+        text_builder_init(&tb, buffer, 6);
+        st = text_builder_append(&tb, "anthill");
+        PRINT_TEST_RESULT(st == ERROR && strcmp(buffer, "anthi") == 0 && text_builder_is_truncated(&tb) == TRUE);
+}
+
+void test3_text_builder_append() {
+        PRINT_TEST_RESULT(text_builder_append(NULL, "ant") == ERROR);
+}
+
+void test1_text_builder_append_n() {
+        char buffer[16];
+        Text_builder tb;
+        text_builder_init(&tb, buffer, 16);
+        text_builder_append_n(&tb, "spider", 3);
+        PRINT_TEST_RESULT(strcmp(buffer, "spi") == 0);
+}
+
+void test2_text_builder_append_n() {
+        char buffer[16];
+        Text_builder tb;
+        text_builder_init(&tb, buffer, 16);
+        text_builder_append_n(&tb, "ab", 3);
+        PRINT_TEST_RESULT(strcmp(buffer, "ab") == 0);
+}
+
+void test1_text_builder_append_padded() {
+        char buffer[16];
+        Text_builder tb;
+        text_builder_init(&tb, buffer, 16);
+        text_builder_append_padded(&tb, "ant", 6);
+        PRINT_TEST_RESULT(strcmp(buffer, "   ant") == 0);
+}
+
+void test2_text_builder_append_padded() {
+        char buffer[16];
+        Text_builder tb;
+        text_builder_init(&tb, buffer, 16);
+        text_builder_append_padded(&tb, "ant", -6);
+        PRINT_TEST_RESULT(strcmp(buffer, "ant   ") == 0);
+}
+
+void test3_text_builder_append_padded() {
+        char buffer[16];
+        Text_builder tb;
+        text_builder_init(&tb, buffer, 16);
+        text_builder_append_padded(&tb, "anthill", 3);
+        PRINT_TEST_RESULT(strcmp(buffer, "anthill") == 0);
+}
+
+void test1_text_builder_append_number() {
+        char buffer[32], expected[32];
+        Text_builder tb;
+        text_builder_init(&tb, buffer, 32);
+        text_builder_append_number(&tb, 7, 3);
+        text_builder_append_number(&tb, -120, 0);
+        text_builder_append_number(&tb, 0, -2);
+        text_builder_append_number(&tb, 123456, 3);
+        sprintf(expected, "%3ld%ld%-2ld%3ld", 7L, -120L, 0L, 123456L);
+        PRINT_TEST_RESULT(strcmp(buffer, expected) == 0);
+}
+
+void test1_text_builder_is_truncated() {
+        char buffer[8];
+        Text_builder tb;
+        text_builder_init(&tb, buffer, 8);
+        text_builder_append(&tb, "ant");
+        PRINT_TEST_RESULT(text_builder_is_truncated(&tb) == FALSE);
+}
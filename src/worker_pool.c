@@ -0,0 +1,349 @@
+/**
+ * @brief It implements the worker pool module
+ *
+ * @file worker_pool.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 25-05-2025
+ * @copyright GNU Public License
+ */
+
+/*The threads are POSIX, not ANSI C*/
+#define _POSIX_C_SOURCE 200112L
+
+#include "worker_pool.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Worker_queue
+ *
+ * The tasks waiting in a queue, kept in a ring that grows when it is full. Its worker takes the oldest task, so
+ * the tasks of a queue run in the order they came, and the other workers take the newest one.
+ * */
+typedef struct _Worker_queue {
+        pthread_mutex_t lock; /**< Lock of the queue, held only while a task is added or taken*/
+        void **tasks;         /**< Ring of tasks*/
+        int size;             /**< Number of tasks the ring has room for*/
+        int first;            /**< Position of the oldest task*/
+        int length;           /**< Number of tasks in the ring*/
+} Worker_queue;
+
+/**
+ * @brief Worker
+ *
+ * A thread of the pool and its queue.
+ * */
+typedef struct _Worker {
+        Worker_pool *pool;  /**< Pool the worker belongs to*/
+        int index;          /**< Position of the worker in the pool*/
+        pthread_t thread;   /**< Thread of the worker*/
+        Worker_queue queue; /**< Tasks of the worker*/
+} Worker;
+
+/**
+ * @brief _Worker_pool private struct
+ *
+ * The lock of the pool only guards the number of tasks not taken yet, so the workers that find every queue empty
+ * can wait until there is something to do.
+ * */
+struct _Worker_pool {
+        Worker workers[WORKER_POOL_MAX_WORKERS]; /**< Workers of the pool*/
+        int n_workers;                           /**< Number of workers*/
+        int n_threads;                           /**< Number of threads started*/
+        Worker_function function;                /**< Function run for each task*/
+        void *context;                           /**< Context given to function*/
+        pthread_mutex_t lock;                    /**< Lock of the fields below*/
+        pthread_cond_t ready;                    /**< Signaled when a task is submitted or the pool stops*/
+        pthread_cond_t idle;                     /**< Signaled when the last task submitted has been run*/
+        int n_pending;                           /**< Number of tasks in the queues*/
+        int n_unfinished;                        /**< Number of tasks submitted and not run to the end yet*/
+        int next;                                /**< Worker whose queue gets the next task*/
+        Bool stopping;                           /**< TRUE once the pool is being destroyed*/
+};
+
+/*
+Private functions
+*/
+
+/**
+ * @brief Main function of each thread: runs tasks until the pool stops and every queue is empty
+ * @author Abraham Martín
+ *
+ * @param arg Pointer to the worker
+ * @return NULL
+ */
+void *worker_pool_run(void *arg);
+
+/**
+ * @brief Takes a task, from the queue of the worker or else from the queue of any other
+ * @author Abraham Martín
+ *
+ * @param worker Pointer to the worker
+ * @return The task, or NULL if every queue is empty
+ */
+void *worker_pool_take(Worker *worker);
+
+/**
+ * @brief Adds a task at the end of a queue, growing it if it is full
+ * @author Abraham Martín
+ *
+ * @param queue Pointer to the queue
+ * @param task The task
+ * @return OK if everything goes well, ERROR otherwise
+ */
+Status worker_queue_push(Worker_queue *queue, void *task);
+
+/**
+ * @brief Takes a task from a queue
+ * @author Abraham Martín
+ *
+ * @param queue Pointer to the queue
+ * @param oldest TRUE to take the oldest task, FALSE to take the newest
+ * @return The task, or NULL if the queue is empty
+ */
+void *worker_queue_pop(Worker_queue *queue, Bool oldest);
+
+Worker_pool *worker_pool_create(int n_workers, Worker_function function, void *context) {
+        Worker_pool *pool = NULL;
+        int i;
+
+        if (n_workers < 1 || n_workers > WORKER_POOL_MAX_WORKERS || !function) {
+                return NULL;
+        }
+
+        pool = (Worker_pool *)calloc(1, sizeof(Worker_pool));
+        if (!pool) {
+                return NULL;
+        }
+        pool->function = function;
+        pool->context = context;
+        pool->stopping = FALSE;
+        if (pthread_mutex_init(&pool->lock, NULL) != 0) {
+                free(pool);
+                return NULL;
+        }
+        if (pthread_cond_init(&pool->ready, NULL) != 0) {
+                pthread_mutex_destroy(&pool->lock);
+                free(pool);
+                return NULL;
+        }
+        if (pthread_cond_init(&pool->idle, NULL) != 0) {
+                pthread_cond_destroy(&pool->ready);
+                pthread_mutex_destroy(&pool->lock);
+                free(pool);
+                return NULL;
+        }
+
+        /*Every queue is ready before any thread may steal from it*/
+        for (i = 0; i < n_workers; i++) {
+                pool->workers[i].pool = pool;
+                pool->workers[i].index = i;
+                pool->workers[i].queue.size = WORKER_QUEUE_SIZE;
+                pool->workers[i].queue.tasks = (void **)malloc(WORKER_QUEUE_SIZE * sizeof(void *));
+                if (!pool->workers[i].queue.tasks || pthread_mutex_init(&pool->workers[i].queue.lock, NULL) != 0) {
+                        free(pool->workers[i].queue.tasks);
+                        pool->workers[i].queue.tasks = NULL;
+                        break;
+                }
+                pool->n_workers++;
+        }
+        if (pool->n_workers < n_workers) {
+                worker_pool_destroy(pool);
+                return NULL;
+        }
+
+        for (i = 0; i < n_workers; i++) {
+                if (pthread_create(&pool->workers[i].thread, NULL, worker_pool_run, &pool->workers[i]) != 0) {
+                        worker_pool_destroy(pool);
+                        return NULL;
+                }
+                pool->n_threads++;
+        }
+
+        return pool;
+}
+
+void worker_pool_destroy(Worker_pool *pool) {
+        int i;
+
+        if (!pool) {
+                return;
+        }
+
+        pthread_mutex_lock(&pool->lock);
+        pool->stopping = TRUE;
+        pthread_cond_broadcast(&pool->ready);
+        pthread_mutex_unlock(&pool->lock);
+
+        for (i = 0; i < pool->n_threads; i++) {
+                pthread_join(pool->workers[i].thread, NULL);
+        }
+        for (i = 0; i < WORKER_POOL_MAX_WORKERS && pool->workers[i].queue.tasks; i++) {
+                pthread_mutex_destroy(&pool->workers[i].queue.lock);
+                free(pool->workers[i].queue.tasks);
+        }
+        pthread_cond_destroy(&pool->idle);
+        pthread_cond_destroy(&pool->ready);
+        pthread_mutex_destroy(&pool->lock);
+        free(pool);
+}
+
+Status worker_pool_submit(Worker_pool *pool, void *task) {
+        Worker *worker = NULL;
+
+        if (!pool || !task) {
+                return ERROR;
+        }
+
+        /*The task counts as unfinished before any worker can take it*/
+        pthread_mutex_lock(&pool->lock);
+        worker = &pool->workers[pool->next];
+        pool->next = (pool->next + 1) % pool->n_workers;
+        pool->n_unfinished++;
+        pthread_mutex_unlock(&pool->lock);
+
+        if (worker_queue_push(&worker->queue, task) == ERROR) {
+                pthread_mutex_lock(&pool->lock);
+                pool->n_unfinished--;
+                if (pool->n_unfinished == 0) {
+                        pthread_cond_broadcast(&pool->idle);
+                }
+                pthread_mutex_unlock(&pool->lock);
+                return ERROR;
+        }
+
+        pthread_mutex_lock(&pool->lock);
+        pool->n_pending++;
+        pthread_cond_signal(&pool->ready);
+        pthread_mutex_unlock(&pool->lock);
+
+        return OK;
+}
+
+void worker_pool_wait(Worker_pool *pool) {
+        if (!pool) {
+                return;
+        }
+
+        pthread_mutex_lock(&pool->lock);
+        while (pool->n_unfinished > 0) {
+                pthread_cond_wait(&pool->idle, &pool->lock);
+        }
+        pthread_mutex_unlock(&pool->lock);
+}
+
+int worker_pool_get_n_workers(const Worker_pool *pool) {
+        if (!pool) {
+                return -1;
+        }
+
+        return pool->n_workers;
+}
+
+/**
+   Implementation of private functions
+*/
+
+void *worker_pool_run(void *arg) {
+        Worker *worker = (Worker *)arg;
+        Worker_pool *pool = worker->pool;
+        void *task = NULL;
+
+        while (1) {
+                if ((task = worker_pool_take(worker)) != NULL) {
+                        pthread_mutex_lock(&pool->lock);
+                        pool->n_pending--;
+                        pthread_mutex_unlock(&pool->lock);
+
+                        pool->function(task, pool->context);
+
+                        pthread_mutex_lock(&pool->lock);
+                        pool->n_unfinished--;
+                        if (pool->n_unfinished == 0) {
+                                pthread_cond_broadcast(&pool->idle);
+                        }
+                        pthread_mutex_unlock(&pool->lock);
+                        continue;
+                }
+
+                /*Every queue looked empty: wait for a task unless some was added meanwhile*/
+                pthread_mutex_lock(&pool->lock);
+                while (pool->n_pending <= 0 && !pool->stopping) {
+                        pthread_cond_wait(&pool->ready, &pool->lock);
+                }
+                if (pool->n_pending <= 0 && pool->stopping) {
+                        pthread_mutex_unlock(&pool->lock);
+                        break;
+                }
+                pthread_mutex_unlock(&pool->lock);
+        }
+
+        return NULL;
+}
+
+void *worker_pool_take(Worker *worker) {
+        Worker_pool *pool = worker->pool;
+        void *task = NULL;
+        int i;
+
+        if ((task = worker_queue_pop(&worker->queue, TRUE)) != NULL) {
+                return task;
+        }
+
+        /*The queues are tried starting by the next one, so the thieves do not all go for the same victim*/
+        for (i = 1; i < pool->n_workers; i++) {
+                if ((task = worker_queue_pop(&pool->workers[(worker->index + i) % pool->n_workers].queue, FALSE))) {
+                        return task;
+                }
+        }
+
+        return NULL;
+}
+
+Status worker_queue_push(Worker_queue *queue, void *task) {
+        void **tasks = NULL;
+        int i;
+
+        pthread_mutex_lock(&queue->lock);
+        if (queue->length == queue->size) {
+                tasks = (void **)malloc(2 * queue->size * sizeof(void *));
+                if (!tasks) {
+                        pthread_mutex_unlock(&queue->lock);
+                        return ERROR;
+                }
+                for (i = 0; i < queue->length; i++) {
+                        tasks[i] = queue->tasks[(queue->first + i) % queue->size];
+                }
+                free(queue->tasks);
+                queue->tasks = tasks;
+                queue->size *= 2;
+                queue->first = 0;
+        }
+        queue->tasks[(queue->first + queue->length) % queue->size] = task;
+        queue->length++;
+        pthread_mutex_unlock(&queue->lock);
+
+        return OK;
+}
+
+void *worker_queue_pop(Worker_queue *queue, Bool oldest) {
+        void *task = NULL;
+
+        pthread_mutex_lock(&queue->lock);
+        if (queue->length > 0) {
+                if (oldest) {
+                        task = queue->tasks[queue->first];
+                        queue->first = (queue->first + 1) % queue->size;
+                } else {
+                        task = queue->tasks[(queue->first + queue->length - 1) % queue->size];
+                }
+                queue->length--;
+        }
+        pthread_mutex_unlock(&queue->lock);
+
+        return task;
+}
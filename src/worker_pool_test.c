@@ -0,0 +1,212 @@
+/**
+ * @brief It tests the worker pool module
+ *
+ * @file worker_pool_test.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 25-05-2025
+ * @copyright GNU Public License
+ */
+
+#include "worker_pool.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+#include "worker_pool_test.h"
+
+/**
+ * @def MAX_TESTS
+ * @brief Defines the maximum number of tests
+ */
+#define MAX_TESTS 11
+
+/**
+ * @def N_TASKS
+ * @brief Defines the number of tasks submitted by the tests
+ */
+#define N_TASKS 10000
+
+/**
+ * @def N_CHAINS
+ * @brief Defines the number of tasks that submit themselves again
+ */
+#define N_CHAINS 16
+
+/**
+ * @brief Pool the tasks that submit themselves again are submitted to
+ */
+Worker_pool *chain_pool = NULL;
+
+/**
+ * @brief Task of the tests: counts the times it is run
+ *
+ * @param task Pointer to the counter
+ * @param context Not used
+ */
+void worker_pool_test_count(void *task, void *context);
+
+/**
+ * @brief Task of the tests: counts down and submits itself again until the count ends
+ *
+ * @param task Pointer to the count, whose position N_CHAINS ahead counts the times it is run
+ * @param context Not used
+ */
+void worker_pool_test_chain(void *task, void *context);
+
+/**
+ * @brief Main function for WORKER_POOL unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv) {
+        int test = 0;
+        int all = 1;
+
+        if (argc < 2) {
+                printf("Running all test for module Worker_pool:\n");
+        } else {
+                test = atoi(argv[1]);
+                all = 0;
+                printf("Running test %d:\t", test);
+                if (test < 1 && test > MAX_TESTS) {
+                        printf("Error: unknown test %d\t", test);
+                        exit(EXIT_SUCCESS);
+                }
+        }
+
+        if (all || test == 1) test1_worker_pool_create();
+        if (all || test == 2) test2_worker_pool_create();
+        if (all || test == 3) test3_worker_pool_create();
+        if (all || test == 4) test1_worker_pool_submit();
+        if (all || test == 5) test2_worker_pool_submit();
+        if (all || test == 6) test3_worker_pool_submit();
+        if (all || test == 7) test4_worker_pool_submit();
+        if (all || test == 8) test1_worker_pool_get_n_workers();
+        if (all || test == 9) test2_worker_pool_get_n_workers();
+        if (all || test == 10) test1_worker_pool_wait();
+        if (all || test == 11) test2_worker_pool_wait();
+
+        PRINT_PASSED_PERCENTAGE;
+
+        return EXIT_SUCCESS;
+}
+
+void worker_pool_test_count(void *task, void *context) {
+        (void)context;
+        (*(int *)task)++;
+}
+
+void worker_pool_test_chain(void *task, void *context) {
+        int *count = (int *)task;
+
+        (void)context;
+        count[N_CHAINS]++;
+        if (--(*count) > 0) {
+                worker_pool_submit(chain_pool, task);
+        }
+}
+
+void test1_worker_pool_create() {
+        Worker_pool *pool = NULL;
+        pool = worker_pool_create(4, worker_pool_test_count, NULL);
+        PRINT_TEST_RESULT(pool != NULL);
+        worker_pool_destroy(pool);
+}
+
+void test2_worker_pool_create() { PRINT_TEST_RESULT(worker_pool_create(0, worker_pool_test_count, NULL) == NULL); }
+
+void test3_worker_pool_create() { PRINT_TEST_RESULT(worker_pool_create(4, NULL, NULL) == NULL); }
+
+void test1_worker_pool_submit() {
+        Worker_pool *pool = NULL;
+        int *counts = NULL;
+        int i, result = 1;
+        counts = (int *)calloc(N_TASKS, sizeof(int));
+        pool = worker_pool_create(4, worker_pool_test_count, NULL);
+        for (i = 0; i < N_TASKS; i++) {
+                if (worker_pool_submit(pool, &counts[i]) == ERROR) result = 0;
+        }
+        worker_pool_destroy(pool);
+        for (i = 0; i < N_TASKS; i++) {
+                if (counts[i] != 1) result = 0;
+        }
+        PRINT_TEST_RESULT(result);
+        free(counts);
+}
+
+void test2_worker_pool_submit() {
+        int counts[2 * N_CHAINS];
+        int i, result = 1;
+        chain_pool = worker_pool_create(4, worker_pool_test_chain, NULL);
+        for (i = 0; i < N_CHAINS; i++) {
+                counts[i] = 100;
+                counts[N_CHAINS + i] = 0;
+                worker_pool_submit(chain_pool, &counts[i]);
+        }
+        worker_pool_destroy(chain_pool);
+        chain_pool = NULL;
+        for (i = 0; i < N_CHAINS; i++) {
+                if (counts[i] != 0 || counts[N_CHAINS + i] != 100) result = 0;
+        }
+        PRINT_TEST_RESULT(result);
+}
+
+void test3_worker_pool_submit() {
+        int count = 0;
+        PRINT_TEST_RESULT(worker_pool_submit(NULL, &count) == ERROR);
+}
+
+void test4_worker_pool_submit() {
+        Worker_pool *pool = NULL;
+        pool = worker_pool_create(2, worker_pool_test_count, NULL);
+        PRINT_TEST_RESULT(worker_pool_submit(pool, NULL) == ERROR);
+        worker_pool_destroy(pool);
+}
+
+void test1_worker_pool_get_n_workers() {
+        Worker_pool *pool = NULL;
+        pool = worker_pool_create(3, worker_pool_test_count, NULL);
+        PRINT_TEST_RESULT(worker_pool_get_n_workers(pool) == 3);
+        worker_pool_destroy(pool);
+}
+
+void test2_worker_pool_get_n_workers() { PRINT_TEST_RESULT(worker_pool_get_n_workers(NULL) == -1); }
+
+void test1_worker_pool_wait() {
+        int counts[2 * N_CHAINS];
+        int i, result = 1;
+        chain_pool = worker_pool_create(4, worker_pool_test_chain, NULL);
+        for (i = 0; i < N_CHAINS; i++) {
+                counts[i] = 100;
+                counts[N_CHAINS + i] = 0;
+                worker_pool_submit(chain_pool, &counts[i]);
+        }
+        worker_pool_wait(chain_pool);
+        for (i = 0; i < N_CHAINS; i++) {
+                if (counts[i] != 0 || counts[N_CHAINS + i] != 100) result = 0;
+        }
+        /*The pool still runs the tasks submitted after the wait*/
+        counts[0] = 1;
+        worker_pool_submit(chain_pool, &counts[0]);
+        worker_pool_wait(chain_pool);
+        if (counts[N_CHAINS] != 101) result = 0;
+        worker_pool_destroy(chain_pool);
+        chain_pool = NULL;
+        PRINT_TEST_RESULT(result);
+}
+
+void test2_worker_pool_wait() {
+        Worker_pool *pool = NULL;
+        pool = worker_pool_create(2, worker_pool_test_count, NULL);
+        worker_pool_wait(pool);
+        worker_pool_wait(NULL);
+        PRINT_TEST_RESULT(pool != NULL);
+        worker_pool_destroy(pool);
+}
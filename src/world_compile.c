@@ -0,0 +1,33 @@
+/**
+ * @brief It compiles a game data file into a world image
+ *
+ * @file world_compile.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 17-05-2025
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "world_image.h"
+
+/**
+ * @brief Main function of the world compiler
+ *
+ * Use: world_compile <game_data_file> <image_file>. The image can be given to anthill instead of the .dat.
+ */
+int main(int argc, char **argv) {
+        if (argc != 3) {
+                fprintf(stderr, "Use: %s <game_data_file> <image_file>\n", argv[0]);
+                return 1;
+        }
+
+        if (world_image_compile(argv[1], argv[2]) == ERROR) {
+                fprintf(stderr, "Error while compiling %s.\n", argv[1]);
+                return 1;
+        }
+
+        return 0;
+}
@@ -0,0 +1,681 @@
+/**
+ * @brief It implements the world image module
+ *
+ * @file world_image.c
+ * @author Abraham Martín
+ * @version 1.0
+ * @date 17-05-2025
+ * @copyright GNU Public License
+ */
+
+/*mmap and the file descriptors are POSIX, not ANSI C*/
+#define _POSIX_C_SOURCE 200112L
+
+#include "world_image.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "character.h"
+#include "link.h"
+#include "object.h"
+#include "player.h"
+#include "space.h"
+
+/**
+ * @def MAGIC
+ * @brief Defines the bytes every world image starts with
+ */
+#define MAGIC "ANTWORLD"
+
+/**
+ * @def MAGIC_SIZE
+ * @brief Defines the number of bytes of MAGIC
+ */
+#define MAGIC_SIZE 8
+
+/**
+ * @def BYTE_ORDER_MARK
+ * @brief Defines a number stored in the header to reject images written by a machine with another byte order
+ */
+#define BYTE_ORDER_MARK 0x01020304L
+
+/**
+ * @def INITIAL_SLOTS
+ * @brief Defines the number of slots of the string table the first time a string is stored
+ */
+#define INITIAL_SLOTS 256
+
+/**
+ * @def INITIAL_STRINGS_SIZE
+ * @brief Defines the number of bytes reserved for the strings the first time one is stored
+ */
+#define INITIAL_STRINGS_SIZE 4096
+
+/**
+ * @def FNV_OFFSET
+ * @brief Defines the initial value of the FNV-1a hash
+ */
+#define FNV_OFFSET 2166136261UL
+
+/**
+ * @def FNV_PRIME
+ * @brief Defines the multiplier of the FNV-1a hash
+ */
+#define FNV_PRIME 16777619UL
+
+/**
+ * @brief Image_header
+ *
+ * First bytes of the image. It is followed by the records of the spaces, links, objects, characters and players,
+ * in that order, and then by the strings. Every number is a native long, so the image is only valid in machines
+ * like the one that wrote it.
+ */
+typedef struct _Image_header {
+        char magic[MAGIC_SIZE]; /**< MAGIC, without the final '\0'*/
+        long version;           /**< WORLD_IMAGE_VERSION*/
+        long long_size;         /**< sizeof(long) in the machine that wrote the image*/
+        long byte_order;        /**< BYTE_ORDER_MARK*/
+        long n_spaces;          /**< Number of space records*/
+        long n_objects;         /**< Number of object records*/
+        long n_characters;      /**< Number of character records*/
+        long n_links;           /**< Number of link records*/
+        long n_players;         /**< Number of player records*/
+        long strings_size;      /**< Number of bytes of the string table*/
+} Image_header;
+
+/**
+ * @brief Space_record
+ *
+ * A space of the image. The strings are offsets in the string table.
+ */
+typedef struct _Space_record {
+        long id;                 /**< Id of the space*/
+        long name;               /**< Name of the space*/
+        long discovered;         /**< Whether the space is discovered*/
+        long gdesc[GDESC_LINES]; /**< Rows of the graphic description*/
+} Space_record;
+
+/**
+ * @brief Object_record
+ *
+ * An object of the image. The strings are offsets in the string table.
+ */
+typedef struct _Object_record {
+        long id;          /**< Id of the object*/
+        long name;        /**< Name of the object*/
+        long location;    /**< Space where the object lies, NO_ID if none*/
+        long description; /**< Description of the object*/
+        long health;      /**< Health the object gives*/
+        long movable;     /**< Whether the object can be taken*/
+        long dependency;  /**< Object needed to take it*/
+        long open;        /**< Link opened by the object*/
+} Object_record;
+
+/**
+ * @brief Character_record
+ *
+ * A character of the image. The strings are offsets in the string table.
+ */
+typedef struct _Character_record {
+        long id;        /**< Id of the character*/
+        long name;      /**< Name of the character*/
+        long location;  /**< Space of the character, NO_ID if none*/
+        long friendly;  /**< Whether the character is friendly*/
+        long health;    /**< Health of the character*/
+        long gdesc;     /**< Graphic description of the character*/
+        long message;   /**< Message of the character*/
+        long following; /**< Player the character follows*/
+} Character_record;
+
+/**
+ * @brief Link_record
+ *
+ * A link of the image. The strings are offsets in the string table.
+ */
+typedef struct _Link_record {
+        long id;          /**< Id of the link*/
+        long name;        /**< Name of the link*/
+        long origin;      /**< Space where the link starts*/
+        long destination; /**< Space where the link ends*/
+        long direction;   /**< Direction of the link*/
+        long open;        /**< Whether the link is open*/
+} Link_record;
+
+/**
+ * @brief Player_record
+ *
+ * A player of the image. The strings are offsets in the string table.
+ */
+typedef struct _Player_record {
+        long id;            /**< Id of the player*/
+        long name;          /**< Name of the player*/
+        long gdesc;         /**< Graphic description of the player*/
+        long location;      /**< Space of the player*/
+        long health;        /**< Health of the player*/
+        long backpack_size; /**< Number of objects the player can carry*/
+} Player_record;
+
+/**
+ * @brief Image
+ *
+ * Pointers to each part of a mapped image.
+ */
+typedef struct _Image {
+        const Image_header *header;         /**< Header of the image*/
+        const Space_record *spaces;         /**< Space records*/
+        const Link_record *links;           /**< Link records*/
+        const Object_record *objects;       /**< Object records*/
+        const Character_record *characters; /**< Character records*/
+        const Player_record *players;       /**< Player records*/
+        const char *strings;                /**< String table*/
+} Image;
+
+/**
+ * @brief String_table
+ *
+ * The strings written to an image. Each different string is stored once, the slots are an open addressing table
+ * used to find the strings already stored.
+ */
+typedef struct _String_table {
+        char *data;     /**< Strings, one after another with their '\0'*/
+        long size;      /**< Number of bytes used of data*/
+        long max;       /**< Number of bytes reserved for data*/
+        long *slots;    /**< Offset of the string of each slot, -1 marks a free slot*/
+        long n_slots;   /**< Size of the table, always a power of two*/
+        long n_strings; /**< Number of different strings*/
+} String_table;
+
+/*
+Private functions
+*/
+
+/**
+ * @brief Computes the FNV-1a hash of a string
+ * @author Abraham Martín
+ *
+ * @param string String to be hashed
+ * @return The hash of the string
+ */
+unsigned long world_image_hash(const char *string);
+
+/**
+ * @brief Doubles the slots of a string table and puts back every string
+ * @author Abraham Martín
+ *
+ * @param table Pointer to the string table
+ * @return OK if the memory could be reserved, ERROR otherwise
+ */
+Status world_image_grow_slots(String_table *table);
+
+/**
+ * @brief Stores a string in the string table, unless it was already there
+ * @author Abraham Martín
+ *
+ * @param table Pointer to the string table
+ * @param string String to store, NULL is stored as an empty string
+ * @return The offset of the string in the table, or -1 if there was an error
+ */
+long world_image_intern(String_table *table, const char *string);
+
+/**
+ * @brief Retrieves a string of a mapped image checking that it lies inside the string table
+ * @author Abraham Martín
+ *
+ * @param image Pointer to the image
+ * @param offset Offset of the string
+ * @return Pointer to the string, or NULL if the offset is not valid
+ */
+char *world_image_string(const Image *image, long offset);
+
+/**
+ * @brief Adds to the game every entity of a mapped image
+ * @author Abraham Martín
+ *
+ * @param game Pointer to a game with room for the whole image
+ * @param image Pointer to the image
+ * @return OK if everything goes well and ERROR if it couldnt complete its task
+ */
+Status world_image_add_entities(Game *game, const Image *image);
+
+Status world_image_compile(char *dat_file, char *image_file) {
+        Game *game = NULL;
+        Image_header header;
+        Space_record *spaces = NULL;
+        Object_record *objects = NULL;
+        Character_record *characters = NULL;
+        Link_record *links = NULL;
+        Player_record *players = NULL;
+        String_table table;
+        Space *space = NULL;
+        Object *object = NULL;
+        Character *character = NULL;
+        Link *link = NULL;
+        Player *player = NULL;
+        Status status = OK;
+        FILE *f = NULL;
+        long i, j;
+
+        if (!dat_file || !image_file) {
+                return ERROR;
+        }
+
+        if (game_create_from_file(&game, dat_file) == ERROR) {
+                game_destroy(game);
+                return ERROR;
+        }
+
+        memcpy(header.magic, MAGIC, MAGIC_SIZE);
+        header.version = WORLD_IMAGE_VERSION;
+        header.long_size = (long)sizeof(long);
+        header.byte_order = BYTE_ORDER_MARK;
+        header.n_spaces = game_get_n_spaces(game);
+        header.n_objects = game_get_n_objects(game);
+        header.n_characters = game_get_n_characters(game);
+        header.n_links = game_get_n_links(game);
+        header.n_players = game_get_n_players(game);
+
+        table.data = NULL;
+        table.size = 0;
+        table.max = 0;
+        table.slots = NULL;
+        table.n_slots = 0;
+        table.n_strings = 0;
+
+        /*One more record than needed, so no array is empty*/
+        spaces = (Space_record *)malloc((header.n_spaces + 1) * sizeof(Space_record));
+        objects = (Object_record *)malloc((header.n_objects + 1) * sizeof(Object_record));
+        characters = (Character_record *)malloc((header.n_characters + 1) * sizeof(Character_record));
+        links = (Link_record *)malloc((header.n_links + 1) * sizeof(Link_record));
+        players = (Player_record *)malloc((header.n_players + 1) * sizeof(Player_record));
+        if (!spaces || !objects || !characters || !links || !players) {
+                status = ERROR;
+        }
+
+        for (i = 0; status == OK && i < header.n_spaces; i++) {
+                space = game_get_space_from_index(game, i);
+                spaces[i].id = space_get_id(space);
+                spaces[i].name = world_image_intern(&table, space_get_name(space));
+                spaces[i].discovered = space_get_discovered(space);
+                for (j = 0; j < GDESC_LINES; j++) {
+                        spaces[i].gdesc[j] = world_image_intern(&table, space_get_stored_gdesc(space, j));
+                        if (spaces[i].gdesc[j] == -1) status = ERROR;
+                }
+                if (spaces[i].name == -1) status = ERROR;
+        }
+        for (i = 0; status == OK && i < header.n_links; i++) {
+                link = game_get_link_from_index(game, i);
+                links[i].id = link_get_id(link);
+                links[i].name = world_image_intern(&table, link_get_name(link));
+                links[i].origin = link_get_origin(link);
+                links[i].destination = link_get_destination(link);
+                links[i].direction = link_get_direction(link);
+                links[i].open = link_get_open(link);
+                if (links[i].name == -1) status = ERROR;
+        }
+        for (i = 0; status == OK && i < header.n_objects; i++) {
+                object = game_get_object_from_index(game, i);
+                objects[i].id = object_get_id(object);
+                objects[i].name = world_image_intern(&table, object_get_name(object));
+                objects[i].location = game_get_object_location(game, object_get_id(object));
+                objects[i].description = world_image_intern(&table, object_get_description(object));
+                objects[i].health = object_get_health(object);
+                objects[i].movable = object_get_movable(object);
+                objects[i].dependency = object_get_dependency(object);
+                objects[i].open = object_get_open(object);
+                if (objects[i].name == -1 || objects[i].description == -1) status = ERROR;
+        }
+        for (i = 0; status == OK && i < header.n_characters; i++) {
+                character = game_get_character_from_index(game, i);
+                characters[i].id = character_get_id(character);
+                characters[i].name = world_image_intern(&table, character_get_name(character));
+                characters[i].location = game_get_character_location(game, character_get_id(character));
+                characters[i].friendly = character_get_friendly(character);
+                characters[i].health = character_get_health(character);
+                characters[i].gdesc = world_image_intern(&table, character_get_gdesc(character));
+                characters[i].message = world_image_intern(&table, character_get_message(character));
+                characters[i].following = character_get_following(character);
+                if (characters[i].name == -1 || characters[i].gdesc == -1 || characters[i].message == -1) status = ERROR;
+        }
+        for (i = 0; status == OK && i < header.n_players; i++) {
+                player = game_get_player_from_index(game, i);
+                players[i].id = player_get_id(player);
+                players[i].name = world_image_intern(&table, player_get_name(player));
+                players[i].gdesc = world_image_intern(&table, player_get_gdesc(player));
+                players[i].location = player_get_location(player);
+                players[i].health = player_get_health(player);
+                players[i].backpack_size = player_get_backpack_size(player);
+                if (players[i].name == -1 || players[i].gdesc == -1) status = ERROR;
+        }
+        header.strings_size = table.size;
+
+        if (status == OK) {
+                f = fopen(image_file, "wb");
+                if (!f) {
+                        status = ERROR;
+                }
+        }
+        if (status == OK) {
+                if (fwrite(&header, sizeof(Image_header), 1, f) != 1 ||
+                    fwrite(spaces, sizeof(Space_record), header.n_spaces, f) != (size_t)header.n_spaces ||
+                    fwrite(links, sizeof(Link_record), header.n_links, f) != (size_t)header.n_links ||
+                    fwrite(objects, sizeof(Object_record), header.n_objects, f) != (size_t)header.n_objects ||
+                    fwrite(characters, sizeof(Character_record), header.n_characters, f) != (size_t)header.n_characters ||
+                    fwrite(players, sizeof(Player_record), header.n_players, f) != (size_t)header.n_players ||
+                    fwrite(table.data, 1, table.size, f) != (size_t)table.size) {
+                        status = ERROR;
+                }
+                if (fclose(f) != 0) {
+                        status = ERROR;
+                }
+        }
+
+        free(spaces);
+        free(objects);
+        free(characters);
+        free(links);
+        free(players);
+        free(table.data);
+        free(table.slots);
+        game_destroy(game);
+
+        return status;
+}
+
+Bool world_image_is_image(char *file) {
+        char magic[MAGIC_SIZE];
+        FILE *f = NULL;
+        Bool is_image = FALSE;
+
+        if (!file) {
+                return FALSE;
+        }
+
+        f = fopen(file, "rb");
+        if (!f) {
+                return FALSE;
+        }
+        if (fread(magic, 1, MAGIC_SIZE, f) == MAGIC_SIZE && memcmp(magic, MAGIC, MAGIC_SIZE) == 0) {
+                is_image = TRUE;
+        }
+        fclose(f);
+
+        return is_image;
+}
+
+Status world_image_load(Game **game, char *image_file) {
+        Game_capacity capacity;
+        Image image;
+        struct stat info;
+        void *data = NULL;
+        long size, expected;
+        Status status = OK;
+        int fd;
+
+        if (!game || !image_file) {
+                return ERROR;
+        }
+
+        fd = open(image_file, O_RDONLY);
+        if (fd == -1) {
+                return ERROR;
+        }
+        if (fstat(fd, &info) == -1 || (long)info.st_size < (long)sizeof(Image_header)) {
+                close(fd);
+                return ERROR;
+        }
+        size = (long)info.st_size;
+        data = mmap(NULL, (size_t)size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED) {
+                return ERROR;
+        }
+
+        /*Every part of the image is checked before anything is read from it*/
+        image.header = (const Image_header *)data;
+        if (memcmp(image.header->magic, MAGIC, MAGIC_SIZE) != 0 || image.header->version != WORLD_IMAGE_VERSION ||
+            image.header->long_size != (long)sizeof(long) || image.header->byte_order != BYTE_ORDER_MARK ||
+            image.header->n_spaces < 0 || image.header->n_objects < 0 || image.header->n_characters < 0 ||
+            image.header->n_links < 0 || image.header->n_players < 0 || image.header->strings_size < 0) {
+                munmap(data, (size_t)size);
+                return ERROR;
+        }
+        expected = (long)sizeof(Image_header) + image.header->n_spaces * (long)sizeof(Space_record) +
+                   image.header->n_links * (long)sizeof(Link_record) +
+                   image.header->n_objects * (long)sizeof(Object_record) +
+                   image.header->n_characters * (long)sizeof(Character_record) +
+                   image.header->n_players * (long)sizeof(Player_record) + image.header->strings_size;
+        if (expected != size) {
+                munmap(data, (size_t)size);
+                return ERROR;
+        }
+        image.spaces = (const Space_record *)(image.header + 1);
+        image.links = (const Link_record *)(image.spaces + image.header->n_spaces);
+        image.objects = (const Object_record *)(image.links + image.header->n_links);
+        image.characters = (const Character_record *)(image.objects + image.header->n_objects);
+        image.players = (const Player_record *)(image.characters + image.header->n_characters);
+        image.strings = (const char *)(image.players + image.header->n_players);
+
+        capacity.n_spaces = (int)image.header->n_spaces;
+        capacity.n_objects = (int)image.header->n_objects;
+        capacity.n_characters = (int)image.header->n_characters;
+        capacity.n_links = (int)image.header->n_links;
+        capacity.n_players = (int)image.header->n_players;
+        if (game_create(game, &capacity) == ERROR) {
+                munmap(data, (size_t)size);
+                return ERROR;
+        }
+
+        status = world_image_add_entities(*game, &image);
+
+        munmap(data, (size_t)size);
+
+        return status;
+}
+
+/**
+   Implementation of private functions
+*/
+
+unsigned long world_image_hash(const char *string) {
+        unsigned long h = FNV_OFFSET;
+
+        for (; *string != '\0'; string++) {
+                h ^= (unsigned long)(unsigned char)*string;
+                h = (h * FNV_PRIME) & 0xFFFFFFFFUL;
+        }
+
+        return h;
+}
+
+Status world_image_grow_slots(String_table *table) {
+        long *slots = NULL;
+        long n_slots, i, slot;
+
+        n_slots = table->n_slots == 0 ? INITIAL_SLOTS : 2 * table->n_slots;
+        slots = (long *)malloc(n_slots * sizeof(long));
+        if (!slots) {
+                return ERROR;
+        }
+        for (i = 0; i < n_slots; i++) {
+                slots[i] = -1;
+        }
+
+        for (i = 0; i < table->n_slots; i++) {
+                if (table->slots[i] != -1) {
+                        slot = (long)(world_image_hash(table->data + table->slots[i]) & (unsigned long)(n_slots - 1));
+                        while (slots[slot] != -1) {
+                                slot = (slot + 1) & (n_slots - 1);
+                        }
+                        slots[slot] = table->slots[i];
+                }
+        }
+
+        free(table->slots);
+        table->slots = slots;
+        table->n_slots = n_slots;
+
+        return OK;
+}
+
+long world_image_intern(String_table *table, const char *string) {
+        char *data = NULL;
+        long slot, length, max, offset;
+
+        if (!string) {
+                string = "";
+        }
+
+        if (2 * (table->n_strings + 1) > table->n_slots && world_image_grow_slots(table) == ERROR) {
+                return -1;
+        }
+
+        slot = (long)(world_image_hash(string) & (unsigned long)(table->n_slots - 1));
+        while (table->slots[slot] != -1) {
+                if (strcmp(table->data + table->slots[slot], string) == 0) {
+                        return table->slots[slot];
+                }
+                slot = (slot + 1) & (table->n_slots - 1);
+        }
+
+        length = (long)strlen(string) + 1;
+        if (table->size + length > table->max) {
+                max = table->max == 0 ? INITIAL_STRINGS_SIZE : 2 * table->max;
+                if (max < table->size + length) max = table->size + length;
+                data = (char *)realloc(table->data, max);
+                if (!data) {
+                        return -1;
+                }
+                table->data = data;
+                table->max = max;
+        }
+
+        offset = table->size;
+        memcpy(table->data + offset, string, length);
+        table->size += length;
+        table->slots[slot] = offset;
+        table->n_strings++;
+
+        return offset;
+}
+
+char *world_image_string(const Image *image, long offset) {
+        long i;
+
+        if (offset < 0 || offset >= image->header->strings_size) {
+                return NULL;
+        }
+        /*The string has to end inside the table*/
+        for (i = offset; i < image->header->strings_size; i++) {
+                if (image->strings[i] == '\0') {
+                        return (char *)(image->strings + offset);
+                }
+        }
+
+        return NULL;
+}
+
+Status world_image_add_entities(Game *game, const Image *image) {
+        char gdesc[GDESC_LINES][LINE_LENGTH + 1];
+        char *name = NULL, *text = NULL, *message = NULL;
+        Space *space = NULL;
+        Object *object = NULL;
+        Character *character = NULL;
+        Link *link = NULL;
+        Player *player = NULL;
+        long i, j;
+
+        /*Spaces go first, so every link, object and character finds its space already loaded*/
+        for (i = 0; i < image->header->n_spaces; i++) {
+                for (j = 0; j < GDESC_LINES; j++) {
+                        if (!(text = world_image_string(image, image->spaces[i].gdesc[j]))) return ERROR;
+                        strncpy(gdesc[j], text, LINE_LENGTH);
+                        gdesc[j][LINE_LENGTH] = '\0';
+                }
+                if (!(name = world_image_string(image, image->spaces[i].name))) return ERROR;
+                space = space_create(image->spaces[i].id);
+                if (!space) return ERROR;
+                if (space_set_name(space, name) != OK || space_set_discovered(space, (Bool)image->spaces[i].discovered) != OK ||
+                    space_set_gdesc(space, gdesc) != OK || game_add_space(game, space) != OK) {
+                        space_destroy(space);
+                        return ERROR;
+                }
+        }
+
+        for (i = 0; i < image->header->n_links; i++) {
+                if (!(name = world_image_string(image, image->links[i].name))) return ERROR;
+                link = link_create(image->links[i].id);
+                if (!link) return ERROR;
+                if (link_set_name(link, name) != OK || link_set_origin(link, image->links[i].origin) != OK ||
+                    link_set_destination(link, image->links[i].destination) != OK ||
+                    link_set_direction(link, (Direction)image->links[i].direction) != OK ||
+                    link_set_open(link, (Bool)image->links[i].open) != OK || game_add_link(game, link) != OK) {
+                        link_destroy(link);
+                        return ERROR;
+                }
+        }
+
+        for (i = 0; i < image->header->n_objects; i++) {
+                if (!(name = world_image_string(image, image->objects[i].name))) return ERROR;
+                if (!(text = world_image_string(image, image->objects[i].description))) return ERROR;
+                object = object_create(image->objects[i].id);
+                if (!object) return ERROR;
+                if (object_set_name(object, name) != OK || object_set_description(object, text) != OK ||
+                    object_set_health(object, (int)image->objects[i].health) != OK ||
+                    object_set_movable(object, (Bool)image->objects[i].movable) != OK ||
+                    object_set_dependency(object, image->objects[i].dependency) != OK ||
+                    object_set_open(object, image->objects[i].open) != OK || game_add_object(game, object) != OK) {
+                        object_destroy(object);
+                        return ERROR;
+                }
+                if (image->objects[i].location != NO_ID &&
+                    game_set_object_location(game, image->objects[i].id, image->objects[i].location) == ERROR) {
+                        return ERROR;
+                }
+        }
+
+        for (i = 0; i < image->header->n_characters; i++) {
+                if (!(name = world_image_string(image, image->characters[i].name))) return ERROR;
+                if (!(text = world_image_string(image, image->characters[i].gdesc))) return ERROR;
+                if (!(message = world_image_string(image, image->characters[i].message))) return ERROR;
+                if (strlen(text) > GDESC_SIZE) return ERROR;
+                character = character_create(image->characters[i].id);
+                if (!character) return ERROR;
+                if (character_set_name(character, name) != OK ||
+                    character_set_friendly(character, (Bool)image->characters[i].friendly) != OK ||
+                    character_set_health(character, (int)image->characters[i].health) != OK ||
+                    character_set_gdesc(character, text) != OK || character_set_message(character, message) != OK ||
+                    character_set_following(character, image->characters[i].following) != OK ||
+                    game_add_character(game, character) != OK) {
+                        character_destroy(character);
+                        return ERROR;
+                }
+                if (image->characters[i].location != NO_ID &&
+                    game_set_character_location(game, image->characters[i].location, image->characters[i].id) == ERROR) {
+                        return ERROR;
+                }
+        }
+
+        for (i = 0; i < image->header->n_players; i++) {
+                if (!(name = world_image_string(image, image->players[i].name))) return ERROR;
+                if (!(text = world_image_string(image, image->players[i].gdesc))) return ERROR;
+                if (strlen(text) > P_GDESC_LENGTH) return ERROR;
+                player = player_create(image->players[i].id);
+                if (!player) return ERROR;
+                if (player_set_name(player, name) != OK || player_set_gdesc(player, text) != OK ||
+                    player_set_location(player, image->players[i].location) != OK ||
+                    player_set_health(player, (int)image->players[i].health) != OK ||
+                    player_set_backpack_size(player, (int)image->players[i].backpack_size) != OK ||
+                    game_add_player(game, player) != OK) {
+                        player_destroy(player);
+                        return ERROR;
+                }
+        }
+
+        return OK;
+}